@@ -0,0 +1,108 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+#include <testsuite/singleton.hpp>
+
+#include <core/collision.hpp>
+
+namespace {
+
+unsigned int const MAP_SIZE = 100u;
+std::size_t const NUM_REGULAR = 2000u;
+std::size_t const NUM_BULLETS = 500u;
+std::size_t const NUM_TICKS = 200u;
+
+}  // ::anon
+
+struct CollisionBenchFixture {
+	sf::Texture dummy;
+	core::LogContext log;
+	core::CollisionSender collision_sender;
+	core::MoveSender move_sender;
+	core::TeleportSender teleport_sender;
+	core::CollisionManager collision_manager;
+	core::DungeonSystem dungeon;
+	core::MovementManager movement_manager;
+	core::collision_impl::Broadphase broadphase;
+	core::collision_impl::Context context;
+
+	CollisionBenchFixture()
+		: dummy{}
+		, log{}
+		, collision_sender{}
+		, move_sender{}
+		, teleport_sender{}
+		, collision_manager{NUM_REGULAR + NUM_BULLETS}
+		, dungeon{}
+		, movement_manager{NUM_REGULAR + NUM_BULLETS}
+		, broadphase{}
+		, context{log, collision_sender, move_sender, teleport_sender,
+			  collision_manager, dungeon, movement_manager, broadphase} {
+		auto scene = dungeon.create(
+			dummy, sf::Vector2u{MAP_SIZE, MAP_SIZE}, sf::Vector2f{1.f, 1.f});
+		auto& d = dungeon[scene];
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < MAP_SIZE; ++pos.y) {
+			for (pos.x = 0u; pos.x < MAP_SIZE; ++pos.x) {
+				d.getTerrain(pos) = core::Terrain::Floor;
+			}
+		}
+		// monster packs and volleys in a deterministic pattern
+		for (core::ObjectID id = 1u; id <= NUM_REGULAR + NUM_BULLETS; ++id) {
+			bool is_bullet = id > NUM_REGULAR;
+			pos.x = (id * 37u) % MAP_SIZE;
+			pos.y = (id * 53u + id / 7u) % MAP_SIZE;
+			auto& c = collision_manager.acquire(id);
+			c.is_projectile = is_bullet;
+			c.radius = core::collision_impl::MAX_PROJECTILE_RADIUS;
+			auto& m = movement_manager.acquire(id);
+			m.pos = sf::Vector2f{pos};
+			if (is_bullet) {
+				m.pos += sf::Vector2f{0.3f, 0.6f};
+			}
+			m.target = pos;
+			m.scene = scene;
+			d.getCell(pos).entities.push_back(id);
+		}
+		// note: objects are placed without move events, like spawning
+		for (auto const& c : collision_manager) {
+			core::collision_impl::syncBroadphase(context, c.id);
+		}
+	}
+};
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(collision_benchmark)
+
+BOOST_AUTO_TEST_CASE(bullet_checks_cell_scan_vs_broadphase) {
+	auto& fix = Singleton<CollisionBenchFixture>::get();
+
+	std::size_t scan_count{0u}, broadphase_count{0u};
+	auto scan_result = benchmark::measure(NUM_TICKS, [&](std::size_t i) {
+		for (auto const& data : fix.collision_manager) {
+			if (data.is_projectile) {
+				scan_count += core::checkBulletCollision(fix.collision_manager,
+					fix.movement_manager, fix.dungeon, data).size();
+			}
+		}
+	});
+	auto broadphase_result = benchmark::measure(NUM_TICKS, [&](std::size_t i) {
+		std::vector<core::ObjectID> candidates, objects;
+		for (auto const& data : fix.collision_manager) {
+			if (data.is_projectile) {
+				objects.clear();
+				core::collision_impl::queryBullet(
+					fix.context, data, candidates, objects);
+				broadphase_count += objects.size();
+			}
+		}
+	});
+
+	benchmark::print("Bullet checks (cell scan)", scan_result);
+	benchmark::print("Bullet checks (broadphase)", broadphase_result);
+	benchmark::compare(
+		"Broadphase vs. cell scan", scan_result, broadphase_result);
+	BOOST_CHECK_EQUAL(scan_count, broadphase_count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
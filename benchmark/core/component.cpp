@@ -0,0 +1,103 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+#include <testsuite/singleton.hpp>
+
+#include <core/animation.hpp>
+#include <core/movement.hpp>
+
+namespace {
+
+std::size_t const NUM_OBJECTS = 10000u;
+std::size_t const NUM_FRAMES = 500u;
+std::size_t const MOVING_RATIO = 10u;  // every n-th object is moving
+unsigned int const ROW_SIZE = 100u;
+sf::Vector2u const GRID_SIZE{3u * ROW_SIZE, NUM_OBJECTS / ROW_SIZE + 2u};
+sf::Time const FRAMETIME = sf::milliseconds(16);
+
+}  // ::anon
+
+struct ComponentBenchFixture {
+	sf::Texture dummy;
+	core::LogContext log;
+	core::DungeonSystem dungeon;
+	core::MovementSystem movement;
+	core::AnimationSystem animation;
+
+	struct {
+		utils::ActionFrames legs;
+		utils::EnumMap<core::AnimationAction, utils::ActionFrames> torso;
+	} demo_template;
+
+	ComponentBenchFixture()
+		: dummy{}
+		, log{}
+		, dungeon{}
+		, movement{log, NUM_OBJECTS, dungeon}
+		, animation{log, NUM_OBJECTS}
+		, demo_template{} {
+		auto scene = dungeon.create(dummy, GRID_SIZE, sf::Vector2f{1.f, 1.f});
+		auto& d = dungeon[scene];
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < GRID_SIZE.y; ++pos.y) {
+			for (pos.x = 0u; pos.x < GRID_SIZE.x; ++pos.x) {
+				d.getTerrain(pos) = core::Terrain::Floor;
+			}
+		}
+
+		// create animation template
+		demo_template.legs.append({0, 0, 10, 5}, {1.f, 0.5f}, sf::milliseconds(50));
+		demo_template.legs.append({10, 0, 10, 5}, {1.f, 0.5f}, sf::milliseconds(50));
+		demo_template.legs.refresh();
+		for (auto& pair : demo_template.torso) {
+			pair.second.append({0, 5, 10, 5}, {1.f, 0.5f}, sf::milliseconds(80));
+			pair.second.append({10, 5, 10, 5}, {1.f, 0.5f}, sf::milliseconds(80));
+			pair.second.refresh();
+		}
+
+		for (core::ObjectID id = 1u; id <= NUM_OBJECTS; ++id) {
+			pos.x = ROW_SIZE + (id - 1u) % ROW_SIZE;
+			pos.y = 1u + (id - 1u) / ROW_SIZE;
+			bool moving = id % MOVING_RATIO == 0u;
+			sf::Vector2i dir{(id / MOVING_RATIO) % 2u == 0u ? 1 : -1, 0};
+
+			auto& m = movement.acquire(id);
+			m.pos = sf::Vector2f{pos};
+			m.target = pos;
+			m.scene = scene;
+			m.max_speed = 5.f;
+			d.getCell(pos).entities.push_back(id);
+			if (moving) {
+				m.next_move = dir;
+			}
+
+			auto& a = animation.acquire(id);
+			a.tpl.legs[core::SpriteLegLayer::Base] = &demo_template.legs;
+			a.tpl.torso[core::SpriteTorsoLayer::Base] = &demo_template.torso;
+			a.is_moving = moving;
+		}
+	}
+};
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(component_benchmark)
+
+BOOST_AUTO_TEST_CASE(movement_update_at_10k_objects) {
+	auto& fix = Singleton<ComponentBenchFixture>::get();
+
+	auto result = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		fix.movement.update(FRAMETIME);
+	});
+	benchmark::print("MovementSystem::update (10k objects)", result);
+}
+
+BOOST_AUTO_TEST_CASE(animation_update_at_10k_objects) {
+	auto& fix = Singleton<ComponentBenchFixture>::get();
+
+	auto result = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		fix.animation.update(FRAMETIME);
+	});
+	benchmark::print("AnimationSystem::update (10k objects)", result);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+#include <testsuite/singleton.hpp>
+
+#include <core/dungeon.hpp>
+
+namespace {
+
+sf::Vector2u const DUNGEON_SIZE{250u, 250u};
+std::size_t const NUM_SCANS = 200u;
+
+// dungeon cell containing all data, like before splitting
+struct PackedCell : core::BaseCell, core::RenderCell {
+	core::Terrain terrain;
+	std::vector<core::ObjectID> entities;
+};
+
+}  // ::anon
+
+struct DungeonBenchFixture {
+	sf::Texture dummy;
+	core::DungeonSystem dungeon;
+	std::vector<PackedCell> packed;
+
+	DungeonBenchFixture()
+		: dummy{}
+		, dungeon{}
+		, packed(DUNGEON_SIZE.x * DUNGEON_SIZE.y) {
+		auto scene = dungeon.create(dummy, DUNGEON_SIZE, sf::Vector2f{1.f, 1.f});
+		auto& d = dungeon[scene];
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < DUNGEON_SIZE.y; ++pos.y) {
+			for (pos.x = 0u; pos.x < DUNGEON_SIZE.x; ++pos.x) {
+				auto terrain = (pos.x % 7u == 0u || pos.y % 5u == 0u)
+					? core::Terrain::Wall : core::Terrain::Floor;
+				auto& p = packed[pos.x + pos.y * DUNGEON_SIZE.x];
+				d.getTerrain(pos) = terrain;
+				p.terrain = terrain;
+				if ((pos.x + pos.y) % 13u == 0u) {
+					d.getCell(pos).entities.push_back(1u);
+					p.entities.push_back(1u);
+				}
+			}
+		}
+	}
+};
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(dungeon_benchmark)
+
+BOOST_AUTO_TEST_CASE(dungeon_memory_report) {
+	auto& fix = Singleton<DungeonBenchFixture>::get();
+	auto memory = fix.dungeon[1u].getMemoryUsage();
+	auto packed = fix.packed.capacity() * sizeof(PackedCell);
+
+	std::cout << "[Benchmark] Dungeon " << DUNGEON_SIZE.x << "x"
+		<< DUNGEON_SIZE.y << ": " << sizeof(PackedCell) << " bytes per packed "
+		<< "cell, " << sizeof(core::Terrain) << " bytes per terrain, "
+		<< sizeof(core::DungeonCell) << " bytes per hot cell, "
+		<< sizeof(core::RenderCell) << " bytes per render cell\n"
+		<< "[Benchmark] Dungeon memory: packed " << packed / 1024u
+		<< " KiB, terrain " << memory.terrain_bytes / 1024u << " KiB, hot "
+		<< memory.hot_bytes / 1024u << " KiB, render "
+		<< memory.cold_bytes / 1024u << " KiB, entities "
+		<< memory.entity_bytes / 1024u << " KiB\n"
+		<< "[Benchmark] Terrain scans touch "
+		<< (packed - memory.terrain_bytes) / 1024u << " KiB less per dungeon\n";
+	BOOST_CHECK_LT(memory.terrain_bytes + memory.hot_bytes, packed);
+}
+
+BOOST_AUTO_TEST_CASE(collision_scan_packed_vs_split_cells) {
+	auto& fix = Singleton<DungeonBenchFixture>::get();
+	auto const& d = fix.dungeon[1u];
+
+	// count accessible cells like collision and navigation do
+	std::size_t packed_count{0u}, split_count{0u};
+	auto packed_result = benchmark::measure(NUM_SCANS, [&](std::size_t i) {
+		for (auto const& cell : fix.packed) {
+			if (cell.terrain == core::Terrain::Floor && cell.entities.empty()) {
+				++packed_count;
+			}
+		}
+	});
+	auto split_result = benchmark::measure(NUM_SCANS, [&](std::size_t i) {
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < DUNGEON_SIZE.y; ++pos.y) {
+			for (pos.x = 0u; pos.x < DUNGEON_SIZE.x; ++pos.x) {
+				if (d.getTerrain(pos) == core::Terrain::Floor
+					&& d.getCell(pos).entities.empty()) {
+					++split_count;
+				}
+			}
+		}
+	});
+
+	benchmark::print("Collision scan (packed cells)", packed_result);
+	benchmark::print("Collision scan (terrain plane)", split_result);
+	benchmark::compare("Terrain plane vs. packed cells", packed_result,
+		split_result);
+	BOOST_CHECK_EQUAL(split_count, packed_count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,231 @@
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+#include <testsuite/singleton.hpp>
+
+#include <core/focus.hpp>
+
+namespace {
+
+unsigned int const MAP_SIZE = 40u;
+std::size_t const NUM_RUNS = 20000u;
+float const DEPTH = 10.f;
+
+unsigned int const CROWD_MAP_SIZE = 100u;
+std::size_t const NUM_CROWD = 2000u;
+std::size_t const NUM_MOVES = 5000u;
+
+// previous traversal which used the out_of_range exception as loop exit
+core::ObjectID legacyTraverseCells(core::Dungeon const& dungeon,
+	sf::Vector2u pos, sf::Vector2i const& dir, float depth,
+	std::function<bool(core::ObjectID, int)> handle) {
+	int step = 0;
+	core::ObjectID found = 0u;
+	do {
+		try {
+			auto const& cell = dungeon.getCell(pos);
+			if (dungeon.getTerrain(pos) != core::Terrain::Floor) {
+				return found;
+			}
+			for (auto other : cell.entities) {
+				if (handle(other, step)) {
+					found = other;
+					break;
+				}
+			}
+		} catch (std::out_of_range const& e) {
+			break;
+		}
+		if (found > 0u) {
+			break;
+		}
+		pos = sf::Vector2u{sf::Vector2i{pos} + dir};
+		++step;
+	} while (step <= depth);
+
+	return found;
+}
+
+}  // ::anon
+
+struct FocusBenchFixture {
+	sf::Texture dummy;
+	core::DungeonSystem dungeon;
+	utils::SceneID scene;
+	std::vector<sf::Vector2u> border;
+
+	FocusBenchFixture()
+		: dummy{}
+		, dungeon{}
+		, scene{0u}
+		, border{} {
+		scene = dungeon.create(
+			dummy, sf::Vector2u{MAP_SIZE, MAP_SIZE}, sf::Vector2f{1.f, 1.f});
+		auto& d = dungeon[scene];
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < MAP_SIZE; ++pos.y) {
+			for (pos.x = 0u; pos.x < MAP_SIZE; ++pos.x) {
+				d.getTerrain(pos) = core::Terrain::Floor;
+			}
+		}
+		// cells close to the border, whose rays leave the map
+		for (unsigned int i = 0u; i < MAP_SIZE; ++i) {
+			border.emplace_back(i, 2u);
+			border.emplace_back(i, MAP_SIZE - 3u);
+			border.emplace_back(2u, i);
+			border.emplace_back(MAP_SIZE - 3u, i);
+		}
+	}
+
+	template <typename Traverse>
+	std::size_t run(Traverse traverse, std::size_t i) {
+		// cast one ray per direction, like focus_impl::onMove does
+		auto const& d = dungeon[scene];
+		auto const& pos = border[i % border.size()];
+		auto handle = [](core::ObjectID, int) { return false; };
+		std::size_t count{0u};
+		sf::Vector2i dir;
+		for (dir.y = -1; dir.y <= 1; ++dir.y) {
+			for (dir.x = -1; dir.x <= 1; ++dir.x) {
+				if (dir.x != 0 || dir.y != 0) {
+					count += traverse(d, pos, dir, DEPTH, handle);
+				}
+			}
+		}
+		return count;
+	}
+};
+
+struct CrowdBenchFixture {
+	sf::Texture dummy;
+	core::LogContext log;
+	core::FocusSender focus_sender;
+	core::FocusManager focus_manager;
+	core::DungeonSystem dungeon;
+	core::MovementManager movement_manager;
+	core::focus_impl::SightIndex sight_index;
+	core::focus_impl::Context context;
+	utils::SceneID scene;
+
+	CrowdBenchFixture()
+		: dummy{}
+		, log{}
+		, focus_sender{}
+		, focus_manager{NUM_CROWD}
+		, dungeon{}
+		, movement_manager{NUM_CROWD}
+		, sight_index{}
+		, context{log, focus_sender, focus_manager, dungeon, movement_manager,
+			  sight_index}
+		, scene{0u} {
+		scene = dungeon.create(dummy, sf::Vector2u{CROWD_MAP_SIZE, CROWD_MAP_SIZE},
+			sf::Vector2f{1.f, 1.f});
+		auto& d = dungeon[scene];
+		sf::Vector2u pos;
+		for (pos.y = 0u; pos.y < CROWD_MAP_SIZE; ++pos.y) {
+			for (pos.x = 0u; pos.x < CROWD_MAP_SIZE; ++pos.x) {
+				d.getTerrain(pos) = core::Terrain::Floor;
+			}
+		}
+		// spread monster packs in a deterministic pattern
+		for (core::ObjectID id = 1u; id <= NUM_CROWD; ++id) {
+			pos.x = (id * 37u) % CROWD_MAP_SIZE;
+			pos.y = (id * 53u + id / 7u) % CROWD_MAP_SIZE;
+			auto& f = focus_manager.acquire(id);
+			f.sight = 10.f;
+			f.display_name = "monster";
+			f.look = {static_cast<int>(id % 3u) - 1, 1};
+			auto& m = movement_manager.acquire(id);
+			m.pos = sf::Vector2f{pos};
+			m.target = pos;
+			m.scene = scene;
+			d.getCell(pos).entities.push_back(id);
+		}
+		// note: the crowd is placed without move events, like spawning
+		for (auto const& f : focus_manager) {
+			core::focus_impl::syncIndex(context, f.id);
+		}
+	}
+
+	template <typename Traverse>
+	std::size_t searchObservers(Traverse traverse, std::size_t i) {
+		// search observers like focus_impl::onMove does
+		auto id = static_cast<core::ObjectID>(1u + i % NUM_CROWD);
+		auto const& d = dungeon[scene];
+		auto const& pos = movement_manager.query(id).target;
+		std::size_t count{0u};
+		sf::Vector2i dir;
+		for (dir.y = -1; dir.y <= 1; ++dir.y) {
+			for (dir.x = -1; dir.x <= 1; ++dir.x) {
+				if (dir.x == 0 && dir.y == 0) {
+					continue;
+				}
+				traverse(d, pos, dir, [&](core::ObjectID other, int distance) {
+					if (other == id) {
+						return false;
+					}
+					auto const& tmp = focus_manager.query(other);
+					if (tmp.look == -dir && distance <= tmp.sight) {
+						++count;
+					}
+					return true;
+				});
+			}
+		}
+		return count;
+	}
+};
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(focus_benchmark)
+
+BOOST_AUTO_TEST_CASE(traverse_cells_near_map_border) {
+	auto& fix = Singleton<FocusBenchFixture>::get();
+
+	std::size_t legacy_count{0u}, current_count{0u};
+	auto legacy_result = benchmark::measure(NUM_RUNS, [&](std::size_t i) {
+		legacy_count += fix.run(legacyTraverseCells, i);
+	});
+	auto current_result = benchmark::measure(NUM_RUNS, [&](std::size_t i) {
+		current_count += fix.run(core::focus_impl::traverseCells, i);
+	});
+
+	benchmark::print("Focus rays near border (exception exit)", legacy_result);
+	benchmark::print("Focus rays near border (bounds check)", current_result);
+	benchmark::compare(
+		"Bounds check vs. exception exit", legacy_result, current_result);
+	BOOST_CHECK_EQUAL(legacy_count, current_count);
+}
+
+BOOST_AUTO_TEST_CASE(observer_search_in_crowded_scene) {
+	auto& fix = Singleton<CrowdBenchFixture>::get();
+
+	std::size_t cells_count{0u}, lane_count{0u};
+	auto cells_result = benchmark::measure(NUM_MOVES, [&](std::size_t i) {
+		cells_count += fix.searchObservers(
+			[&](core::Dungeon const& d, sf::Vector2u const& pos,
+				sf::Vector2i const& dir,
+				std::function<bool(core::ObjectID, int)> handle) {
+				return core::focus_impl::traverseCells(
+					d, pos, dir, core::MAX_SIGHT, handle);
+			}, i);
+	});
+	auto lane_result = benchmark::measure(NUM_MOVES, [&](std::size_t i) {
+		lane_count += fix.searchObservers(
+			[&](core::Dungeon const& d, sf::Vector2u const& pos,
+				sf::Vector2i const& dir,
+				std::function<bool(core::ObjectID, int)> handle) {
+				return core::focus_impl::traverseLane(
+					d, fix.sight_index, pos, dir, core::MAX_SIGHT, handle);
+			}, i);
+	});
+
+	benchmark::print("Observer search (ray casting)", cells_result);
+	benchmark::print("Observer search (sight index)", lane_result);
+	benchmark::compare(
+		"Sight index vs. ray casting", cells_result, lane_result);
+	BOOST_CHECK_EQUAL(cells_count, lane_count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+#include <testsuite/singleton.hpp>
+#include <Thor/Math/Random.hpp>
+
+#include <core/collision.hpp>
+#include <game/generator.hpp>
+#include <game/navigator.hpp>
+
+namespace {
+
+unsigned long const RANDOM_SEED = 1234ul;
+std::size_t const NUM_DUNGEONS = 4u;
+std::size_t const NUM_ACTORS = 60u;
+std::size_t const NUM_REQUESTS = 500u;
+sf::Vector2u const GRID_SIZE{155u, 155u};
+
+}  // ::anon
+
+struct NavigatorBenchFixture {
+	struct Request {
+		std::size_t scene;
+		core::ObjectID actor;
+		sf::Vector2u source, target;
+		std::size_t max_length;
+	};
+	
+	sf::Texture dummy;
+	core::LogContext log;
+	core::CollisionManager collision;
+	game::RoomTemplate room;
+	rpg::TilesetTemplate tileset;
+	game::DungeonGenerator generator;
+	
+	std::vector<std::unique_ptr<core::Dungeon>> dungeons;
+	std::vector<std::unique_ptr<game::NavigationScene>> scenes;
+	std::vector<Request> requests;
+	
+	NavigatorBenchFixture()
+		: dummy{}
+		, log{}
+		, collision{}
+		, room{}
+		, tileset{}
+		, generator{log}
+		, dungeons{}
+		, scenes{}
+		, requests{} {
+		thor::setRandomSeed(RANDOM_SEED);
+		
+		// create plain rooms
+		auto const cell_size = generator.settings.cell_size;
+		sf::Vector2u pos;
+		for (pos.y = 2u; pos.y + 2u < cell_size; ++pos.y) {
+			for (pos.x = 2u; pos.x + 2u < cell_size; ++pos.x) {
+				room.create(pos);
+			}
+		}
+		generator.rooms.push_back(&room);
+		tileset.tilesize = {16u, 16u};
+		tileset.floors.emplace_back(0u, 0u);
+		tileset.walls.emplace_back(16u, 0u);
+		tileset.tileset = &dummy;
+		
+		game::BuildSettings settings;
+		settings.cell_size = cell_size;
+		settings.random_transform = false;
+		
+		core::ObjectID next_id{1u};
+		for (auto i = 0u; i < NUM_DUNGEONS; ++i) {
+			// generate dungeon
+			auto grid_size = GRID_SIZE;
+			generator.layoutifySize(grid_size);
+			dungeons.push_back(std::make_unique<core::Dungeon>(i + 1u, dummy,
+				grid_size, sf::Vector2f{tileset.tilesize}));
+			auto& dungeon = *dungeons.back();
+			auto& data = generator.generate(i + 1u, grid_size);
+			data.builder(tileset, dungeon, settings);
+			scenes.push_back(std::make_unique<game::NavigationScene>(
+				collision, dungeon));
+			
+			// collect floor tiles
+			std::vector<sf::Vector2u> floors;
+			for (pos.y = 0u; pos.y < grid_size.y; ++pos.y) {
+				for (pos.x = 0u; pos.x < grid_size.x; ++pos.x) {
+					if (!core::checkTileCollision(dungeon.getTerrain(pos))) {
+						floors.push_back(pos);
+					}
+				}
+			}
+			BOOST_REQUIRE(!floors.empty());
+			
+			// spawn actors
+			std::vector<std::pair<core::ObjectID, sf::Vector2u>> actors;
+			for (auto j = 0u; j < NUM_ACTORS; ++j) {
+				auto id = next_id++;
+				auto spawn_pos = floors[thor::random(0u, floors.size() - 1u)];
+				collision.acquire(id);
+				dungeon.getCell(spawn_pos).entities.push_back(id);
+				actors.emplace_back(id, spawn_pos);
+			}
+			
+			// create requests similar to game::PathSystem
+			for (auto j = 0u; j < NUM_REQUESTS / NUM_DUNGEONS; ++j) {
+				auto const & actor = actors[thor::random(0u, actors.size() - 1u)];
+				Request request;
+				request.scene = i;
+				request.actor = actor.first;
+				request.source = actor.second;
+				request.target = floors[thor::random(0u, floors.size() - 1u)];
+				auto dist = static_cast<unsigned int>(std::ceil(
+					game::navigator_impl::distance(request.source, request.target)));
+				request.max_length = std::max(20u, dist * 3u);
+				requests.push_back(request);
+			}
+		}
+	}
+};
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(navigator_benchmark)
+
+BOOST_AUTO_TEST_CASE(narrowphase_pathfinder_comparison) {
+	auto& fix = Singleton<NavigatorBenchFixture>::get();
+	
+	using HashedFinder = utils::Pathfinder<game::NavigationScene, core::ObjectID>;
+	using GridFinder = utils::GridPathfinder<game::NavigationScene, core::ObjectID>;
+	
+	// note: pathfinders are created per scene, like game::Navigator does
+	std::vector<std::unique_ptr<HashedFinder>> hashed;
+	std::vector<std::unique_ptr<GridFinder>> grid;
+	for (auto const & scene: fix.scenes) {
+		hashed.push_back(std::make_unique<HashedFinder>(*scene));
+		grid.push_back(std::make_unique<GridFinder>(*scene));
+	}
+	std::size_t hashed_length{0u}, grid_length{0u};
+	auto hashed_result = benchmark::measure(fix.requests.size(), [&](std::size_t i) {
+		auto const & r = fix.requests[i];
+		auto path = (*hashed[r.scene])(r.actor, r.source, r.target, r.max_length);
+		hashed_length += path.size();
+	});
+	auto grid_result = benchmark::measure(fix.requests.size(), [&](std::size_t i) {
+		auto const & r = fix.requests[i];
+		auto path = (*grid[r.scene])(r.actor, r.source, r.target, r.max_length);
+		grid_length += path.size();
+	});
+	
+	benchmark::print("Pathfinder (unordered_set)", hashed_result);
+	benchmark::print("GridPathfinder (PathDict)", grid_result);
+	benchmark::compare("GridPathfinder vs. Pathfinder", hashed_result, grid_result);
+	std::cout << "[Benchmark] total path lengths: " << hashed_length << " vs. "
+		<< grid_length << "\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+
+#include <game/resources.hpp>
+
+namespace {
+
+std::size_t const NUM_EVENTS = 10000u;
+std::size_t const NUM_FRAMES = 100u;
+
+std::string const LUA_CODE =
+	"count = 0\n"
+	"onTileReached = function(self, pos)\n"
+	"	count = count + 1\n"
+	"end\n";
+
+}  // ::anon
+
+BOOST_AUTO_TEST_SUITE(script_benchmark)
+
+BOOST_AUTO_TEST_CASE(dispatch_by_name_vs_cached_handle) {
+	game::AiScript script;
+	BOOST_REQUIRE(script.loadFromMemory(LUA_CODE));
+	sf::Vector2u pos{3u, 4u};
+
+	auto by_name = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			script("onTileReached", 0, pos);
+		}
+	});
+	auto by_handle = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			script(game::AiCallback::onTileReached, 0, pos);
+		}
+	});
+
+	benchmark::print("Lua dispatch by name (10k events)", by_name);
+	benchmark::print("Lua dispatch by handle (10k events)", by_handle);
+	benchmark::compare("Cached handle vs. name lookup", by_name, by_handle);
+	BOOST_CHECK_EQUAL(script.get<std::size_t>("count"),
+		2u * NUM_FRAMES * NUM_EVENTS);
+}
+
+BOOST_AUTO_TEST_CASE(dispatch_of_undefined_callback) {
+	game::AiScript script;
+	BOOST_REQUIRE(script.loadFromMemory(LUA_CODE));
+	sf::Vector2u pos{3u, 4u};
+
+	// note: calling an undefined function by name fails inside sol
+	auto by_name = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			if (script.get<sol::object>("onTileLeft").get_type()
+				== sol::type::function) {
+				script("onTileLeft", 0, pos);
+			}
+		}
+	});
+	auto by_handle = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			script(game::AiCallback::onTileLeft, 0, pos);
+		}
+	});
+
+	benchmark::print("Undefined callback by name (10k events)", by_name);
+	benchmark::print("Undefined callback by handle (10k events)", by_handle);
+	benchmark::compare("Skipped handle vs. name lookup", by_name, by_handle);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
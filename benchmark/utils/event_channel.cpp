@@ -0,0 +1,89 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/benchmark.hpp>
+
+#include <utils/event_channel.hpp>
+#include <utils/event_system.hpp>
+
+namespace {
+
+std::size_t const NUM_EVENTS = 5000u;
+std::size_t const NUM_PRODUCERS = 20u;  // like movement chunks
+std::size_t const NUM_LISTENERS = 5u;
+std::size_t const NUM_FRAMES = 500u;
+
+struct BenchEvent {
+	std::size_t actor;
+	float x, y;
+	int type;
+
+	BenchEvent() : actor{0u}, x{0.f}, y{0.f}, type{0} {}
+};
+
+struct Counter {
+	std::size_t sum;
+
+	Counter() : sum{0u} {}
+
+	void handle(BenchEvent const& event) { sum += event.actor; }
+};
+
+}  // ::anon
+
+BOOST_AUTO_TEST_SUITE(event_channel_benchmark)
+
+BOOST_AUTO_TEST_CASE(merge_and_broadcast_sender_vs_channel) {
+	BenchEvent event;
+
+	// per-producer senders, merged into one sender, copied per listener
+	std::vector<utils::SingleEventSender<BenchEvent>> chunks(NUM_PRODUCERS);
+	utils::SingleEventSender<BenchEvent> sender;
+	std::vector<utils::SingleEventListener<BenchEvent>> listeners(NUM_LISTENERS);
+	for (auto& l : listeners) {
+		sender.bind(l);
+	}
+	std::vector<Counter> sender_counters(NUM_LISTENERS);
+	auto sender_result = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			event.actor = j;
+			chunks[j % NUM_PRODUCERS].send(event);
+		}
+		for (auto& chunk : chunks) {
+			for (auto const& e : chunk.data()) {
+				sender.send(e);
+			}
+			chunk.clear();
+		}
+		sender.propagate();
+		for (auto k = 0u; k < NUM_LISTENERS; ++k) {
+			listeners[k].dispatch(sender_counters[k]);
+		}
+	});
+
+	// per-producer buffers, published into one batch shared by all readers
+	utils::EventChannel<BenchEvent> channel{NUM_PRODUCERS};
+	std::vector<utils::EventChannel<BenchEvent>::Reader> readers(NUM_LISTENERS);
+	for (auto& r : readers) {
+		channel.bind(r);
+	}
+	std::vector<Counter> channel_counters(NUM_LISTENERS);
+	auto channel_result = benchmark::measure(NUM_FRAMES, [&](std::size_t i) {
+		for (auto j = 0u; j < NUM_EVENTS; ++j) {
+			event.actor = j;
+			channel[j % NUM_PRODUCERS].send(event);
+		}
+		channel.publish();
+		for (auto k = 0u; k < NUM_LISTENERS; ++k) {
+			readers[k].dispatch(channel_counters[k]);
+		}
+	});
+
+	benchmark::print("SingleEventSender (5k events, 5 listeners)", sender_result);
+	benchmark::print("EventChannel (5k events, 5 readers)", channel_result);
+	benchmark::compare("EventChannel vs. SingleEventSender", sender_result,
+		channel_result);
+	for (auto k = 0u; k < NUM_LISTENERS; ++k) {
+		BOOST_CHECK_EQUAL(sender_counters[k].sum, channel_counters[k].sum);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,17 +4,25 @@ function MoveAgent.new()
 	self.do_move = false;
 	self.pathfind = false;
 	self.pos = Position.new(0, 0);
+	self.target = 0;
 	
 	self.move = function(self, pos)
 		self.do_move = true;
+		self.target = 0;
 		if self.pos.x ~= pos.x or self.pos.y ~= pos.y then
 			self.pathfind = false;
 		end
 		self.pos = pos;
 	end
 	
+	self.chase = function(self, id)
+		self.do_move = true;
+		self.target = id;
+	end
+	
 	self.stop = function(self)
 		self.do_move = false;
+		self.target = 0;
 	end
 	
 	self.update = function(self, api)
@@ -22,7 +30,10 @@ function MoveAgent.new()
 			return
 		end
 		
-		if self.pathfind then
+		if self.target > 0 then
+			-- follow flow field shared by all chasers
+			api:chase(self.target)
+		elseif self.pathfind then
 			-- pathfind to given position
 			api:navigate(self.pos)
 		else
@@ -139,9 +150,7 @@ function Flock.new()
 			end
 			if self.angry or dist <= sight then
 				-- hunt enemy!
-				local mv = self.entities[api.id];
-				mv:move(api:getPosition(self.enemy));
-				mv.pathfind = true;
+				self.entities[api.id]:chase(self.enemy);
 				hunt = true;
 			else
 				-- ignore enemy
@@ -1,4 +1,6 @@
 #pragma once
+#include <utils/job_system.hpp>
+
 #include <core/common.hpp>
 #include <core/dungeon.hpp>
 #include <core/event.hpp>
@@ -8,6 +10,9 @@ namespace core {
 
 namespace animation_impl {
 
+// number of components per job if updated in parallel
+extern std::size_t const CHUNK_SIZE;
+
 /// helper structure to keep implementation signatures clean and tidy
 struct Context {
 	LogContext& log;
@@ -18,6 +23,13 @@ struct Context {
 		AnimationManager& animation_manager);
 };
 
+/// per-job buffers of a parallel update
+struct Chunk {
+	AnimationSender animation_sender;
+
+	Chunk();
+};
+
 }  // ::animation_impl
 
 // ---------------------------------------------------------------------------
@@ -51,6 +63,9 @@ struct Context {
  *	Additionally, each object's brightness and saturation can also be animated.
  *	AnimationEvents about actions and movement are forwarded one an animation
  *	stopped or was changed.
+ *	If a JobSystem is provided, large component sets are updated in chunks
+ *	across its threads. Each chunk collects its AnimationEvents on its own,
+ *	which are merged in chunk order before they are propagated.
  */
 class AnimationSystem
 	// Event API
@@ -62,9 +77,12 @@ class AnimationSystem
 
   protected:
 	animation_impl::Context context;
+	utils::JobSystem* jobs;
+	std::vector<animation_impl::Chunk> chunks;
 
   public:
-	AnimationSystem(LogContext& log, std::size_t max_objects);
+	AnimationSystem(LogContext& log, std::size_t max_objects,
+		utils::JobSystem* jobs=nullptr);
 
 	void handle(AnimationEvent const& event);
 
@@ -148,6 +166,35 @@ void trigger(Context& context, AnimationData& data, SpriteTorsoLayer layer,
  */
 void update(Context& context, AnimationData& data, sf::Time const& elapsed);
 
+/// Updates a range of components
+/**
+ *	@param context Animation context to work with
+ *	@param begin Iterator to the start of the component range
+ *	@param end Iterator to the end of the component range
+ *	@param elapsed Duration to use for processing the animation(s)
+ */
+void updateRange(Context& context, AnimationManager::iterator begin,
+	AnimationManager::iterator end, sf::Time const& elapsed);
+
+/// Updates a range of components using multiple threads
+/**
+ *	The range is split into chunks of `CHUNK_SIZE` components, which are
+ *	updated by the given job system using `updateRange`. Events are
+ *	collected per chunk and forwarded to the context's sender in chunk
+ *	order afterwards. So they are propagated in the same order as a
+ *	sequential update would do.
+ *
+ *	@param context Animation context to work with
+ *	@param jobs Job system to use
+ *	@param chunks Buffers per chunk, which are resized and reused
+ *	@param begin Iterator to the start of the component range
+ *	@param end Iterator to the end of the component range
+ *	@param elapsed Duration to use for processing the animation(s)
+ */
+void updateParallel(Context& context, utils::JobSystem& jobs,
+	std::vector<Chunk>& chunks, AnimationManager::iterator begin,
+	AnimationManager::iterator end, sf::Time const& elapsed);
+
 /// Trigger new action animation if the previous was finished
 /**
  *	This will trigger an idle animation if the previous animation was neither
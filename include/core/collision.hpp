@@ -1,4 +1,7 @@
 #pragma once
+#include <unordered_map>
+#include <vector>
+
 #include <core/common.hpp>
 #include <core/dungeon.hpp>
 #include <core/event.hpp>
@@ -16,8 +19,82 @@ extern float const MAX_PROJECTILE_RADIUS;
 float const MAX_COLLISION_RANGE =
 	REGULAR_COLLISION_RADIUS + MAX_PROJECTILE_RADIUS;
 
+/// edge length of a broadphase bucket in tiles
+extern unsigned int const BROADPHASE_BUCKET_SIZE;
+/// maximum step in tiles when sampling a bullet's path for terrain
+extern float const SWEEP_STEP;
+extern float const SWEEP_MARGIN;
+/// maximum distance between a collider and its broadphase position
+extern float const BROADPHASE_SLACK;
+
 // ---------------------------------------------------------------------------
 
+/// Uniform spatial hash of all regular (non-projectile) colliders
+/**
+ *	Each scene is divided into square buckets of `BROADPHASE_BUCKET_SIZE`
+ *	tiles. Each bucket lists the regular colliders whose position is located
+ *	inside. Bullets only consider these candidates, so neither bullets nor
+ *	objects without collision component are visited, and no collision
+ *	component needs to be queried per candidate.
+ *	The broadphase is updated by move events, spawns and releases only. So
+ *	a collider might have moved up to `BROADPHASE_SLACK` tiles away from the
+ *	position it was bucketed at. An object is only moved between buckets if
+ *	it crosses a bucket's border.
+ */
+class Broadphase {
+  public:
+	using Bucket = std::vector<ObjectID>;
+
+  private:
+	struct Entry {
+		utils::SceneID scene;
+		std::size_t bucket;
+	};
+
+	struct Grid {
+		sf::Vector2u scene_size, size;
+		std::vector<Bucket> buckets;
+	};
+
+	std::vector<Grid> scenes;
+	std::unordered_map<ObjectID, Entry> entries;
+
+	Grid& getGrid(Dungeon const& dungeon);
+	void erase(Entry const& entry, ObjectID id);
+
+  public:
+	Broadphase();
+
+	/// Move an object to the bucket of the given position
+	/**
+	 *	@param id Regular collider to update
+	 *	@param dungeon Scene the object is located at
+	 *	@param pos World position of the object
+	 */
+	void update(ObjectID id, Dungeon const& dungeon, sf::Vector2f const& pos);
+
+	/// Remove an object from the broadphase
+	/**
+	 *	@param id Object to remove, ignored if not tracked
+	 */
+	void remove(ObjectID id);
+
+	/// Fetch all objects from buckets that are touched by the given circle
+	/**
+	 *	The result is not sorted by distance and may contain objects outside
+	 *	the circle. Objects are appended to the given vector.
+	 *
+	 *	@param dungeon Scene to query
+	 *	@param pos Center of the circle
+	 *	@param radius Radius of the circle
+	 *	@param result Vector to append the candidates to
+	 */
+	void query(Dungeon const& dungeon, sf::Vector2f const& pos, float radius,
+		std::vector<ObjectID>& result) const;
+
+	std::size_t size() const;
+};
+
 /// helper structure to keep implementation signatures clean and tidy
 struct Context {
 	LogContext& log;
@@ -27,11 +104,12 @@ struct Context {
 	CollisionManager& collision_manager;
 	DungeonSystem& dungeon_system;
 	MovementManager const& movement_manager;
+	Broadphase& broadphase;
 
 	Context(LogContext& log, CollisionSender& collision_sender,
 		MoveSender& move_sender, TeleportSender& teleport_sender,
 		CollisionManager& collision_manager, DungeonSystem& dungeon_system,
-		MovementManager const& movement_manager);
+		MovementManager const& movement_manager, Broadphase& broadphase);
 };
 
 }  // ::collision_impl
@@ -46,10 +124,10 @@ struct Context {
  *	No actual data about the actor object is necessary, because each object
  *	will collide with non-accessible terrain.
  *
- *	@param cell To check for collision
+ *	@param terrain Terrain of the cell to check for collision
  *	@return true if a collision was detected
  */
-bool checkTileCollision(DungeonCell const& cell);
+bool checkTileCollision(Terrain terrain);
 
 /// Checks for a object collision
 /**
@@ -118,15 +196,32 @@ class CollisionSystem
 	  public CollisionManager {
 
   protected:
-	sf::Time passed;  // since last collision check
+	sf::Time passed;	// since last collision check
+	sf::Time interval;  // between two bullet checks
+	collision_impl::Broadphase broadphase;
 	collision_impl::Context context;
 
+	/// Add a spawned object to the broadphase
+	void onSpawned(CollisionData& data) override;
+
+	/// Remove a released object from the broadphase
+	void onReleased(CollisionData const& data) override;
+
   public:
 	CollisionSystem(LogContext& log, std::size_t max_objects, DungeonSystem& dungeon,
 		MovementManager const& movement);
 
 	void handle(MoveEvent const& event);
 
+	/// Set the interval between two bullet checks
+	/**
+	 *	Bullets' paths are swept, so the interval can be raised without
+	 *	missing any hits.
+	 *
+	 *	@param value Interval, which needs to be positive
+	 */
+	void setCheckInterval(sf::Time const& value);
+
 	void update(sf::Time const& elapsed);
 };
 
@@ -173,6 +268,9 @@ void onTileLeft(
  *	bullet object it will trigger a collision check to guarantee a collision
  *	free movement reaching the target position given by the event. In this
  *	case only terrain collisions are relevant.
+ *	Before a bullet's terrain collision is propagated, its path since the
+ *	last bullet check is swept. So objects passed by the bullet are hit
+ *	before the bullet stops at the wall.
  *	If no collision occured, the move event is forwarded to the context's
  *	move sender.
  *
@@ -181,7 +279,7 @@ void onTileLeft(
  *	@param event MoveEvent with additional information
  */
 void onTileReached(
-	Context& context, CollisionData const& data, MoveEvent const& event);
+	Context& context, CollisionData& data, MoveEvent const& event);
 
 /// Performs a bullet's object collision check
 /**
@@ -195,6 +293,103 @@ void onTileReached(
  */
 void onBulletCheck(Context& context, CollisionData& data);
 
+/// Checks whether a bullet ignores the given object
+/**
+ *	A bullet's ignore list is kept sorted, so it is searched binary.
+ *
+ *	@pre data.is_projectile
+ *	@param data CollisionData of the bullet object
+ *	@param id Object to check for
+ *	@return true if the object is ignored
+ */
+bool isIgnored(CollisionData const& data, ObjectID id);
+
+/// Propagates a bullet's object collisions and ignores the colliders
+/**
+ *	@param context Context of the collision scene
+ *	@param data CollisionData of the bullet object
+ *	@param objects Colliders hit by the bullet
+ */
+void onBulletHit(Context& context, CollisionData& data,
+	std::vector<ObjectID> const& objects);
+
+/// Computes the squared distance between a point and a line segment
+/**
+ *	@param from Start of the segment
+ *	@param to End of the segment
+ *	@param point Point to measure the distance for
+ *	@return squared distance between point and segment
+ */
+float getSweptDistance(sf::Vector2f const& from, sf::Vector2f const& to,
+	sf::Vector2f const& point);
+
+/// Clips a bullet's path at the first inaccessible cell
+/**
+ *	The path is sampled with a step of at most `SWEEP_STEP` tiles. The last
+ *	sample, that is located at an accessible cell, is returned. If the
+ *	starting cell is inaccessible, the start is returned.
+ *
+ *	@param dungeon Scene to check the terrain at
+ *	@param from Start of the bullet's path
+ *	@param to End of the bullet's path
+ *	@return End of the path's accessible part
+ */
+sf::Vector2f clipSweep(Dungeon const& dungeon, sf::Vector2f const& from,
+	sf::Vector2f const& to);
+
+/// Updates the broadphase entry of an object
+/**
+ *	The object is removed from the broadphase if it is a bullet, has no
+ *	collision component or is not located at any scene.
+ *
+ *	@param context Context of the collision scene
+ *	@param id Object to update
+ */
+void syncBroadphase(Context& context, ObjectID id);
+
+/// Marks the occupancy of an object's scene as modified
+/**
+ *	Whether an object blocks others depends on its collision component,
+ *	so acquiring or releasing it modifies the occupancy of the scene
+ *	the object is located at. Nothing is done if the object isn't
+ *	located at any scene.
+ *
+ *	@param context Context of the collision scene
+ *	@param id Object whose collision component changed
+ */
+void touchScene(Context& context, ObjectID id);
+
+/// Queries all regular objects hit by a bullet using the broadphase
+/**
+ *	The bullet's path since its last check is swept, so fast bullets and
+ *	long check intervals don't tunnel through objects. The path is clipped
+ *	at inaccessible terrain. Colliders' movement since the last check is
+ *	interpolated, so bullet and collider are compared at the same time. A
+ *	collider that wasn't located at the scene during the last check is
+ *	tested at its current position. If the bullet was not checked at its
+ *	current scene yet, only its current position is tested. Candidates,
+ *	which have left the bullet's scene since their last update, are skipped.
+ *
+ *	@pre data.is_projectile
+ *	@pre The broadphase is up to date with all move events
+ *	@param context Context of the collision scene
+ *	@param data CollisionData of the bullet object
+ *	@param candidates Buffer for the broadphase candidates
+ *	@param objects Vector to store the colliders at
+ */
+void queryBullet(Context const& context, CollisionData const& data,
+	std::vector<ObjectID>& candidates, std::vector<ObjectID>& objects);
+
+/// Performs all bullets' object collision checks in one batch
+/**
+ *	All bullets are queried against the broadphase. Afterwards, each
+ *	object's position is stored for the next sweep. If no bullet exists,
+ *	nothing is done at all.
+ *
+ *	@param context Context of the collision scene
+ */
+void checkBullets(Context& context);
+
 /// Checks whether the given object collides at the given position
 /**
  *	This function will check for object collision within the given context.
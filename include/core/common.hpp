@@ -39,8 +39,8 @@ ENUM(SpriteLegLayer, Base, (Base)(Armor))
 
 ENUM(SpriteTorsoLayer, Weapon, (Weapon)(Shield)(Base)(Helmet)(Armor))
 
-// tile terrains
-ENUM(Terrain, Void, (Void)(Wall)(Floor))
+// tile terrains (a single byte, so a dungeon's terrain plane stays dense)
+ENUM_TYPED(Terrain, std::uint8_t, Void, (Void)(Wall)(Floor))
 
 // object layer (for sprites)
 ENUM(ObjectLayer, Bottom, (Bottom)(Middle)(Top))
@@ -18,27 +18,174 @@ struct BaseTrigger {
 	virtual bool isExpired() const = 0;
 };
 
+/// Cell data used by the simulation, besides the terrain
 struct BaseCell {
-	Terrain terrain;
-	utils::OrthoTile tile;
 	std::unique_ptr<BaseTrigger> trigger;
-	std::vector<sf::Sprite> ambiences;
 
 	BaseCell();
 };
 
+/// Cell data used for rendering only
+struct RenderCell {
+	utils::OrthoTile tile;
+	std::vector<sf::Sprite> ambiences;
+
+	RenderCell();
+};
+
 using DungeonCell = utils::SpatialCell<BaseCell, ObjectID>;
-using Dungeon =
-	utils::SpatialScene<BaseCell, ObjectID, utils::GridMode::Orthogonal>;
+using Dungeon = utils::SpatialScene<BaseCell, ObjectID,
+	utils::GridMode::Orthogonal, RenderCell, Terrain>;
+
+/// Compact copy of a dungeon's render cells
+/**
+ *	Tiles are stored by their tileset offset, shading and transparency,
+ *	ambiences by their texture and transformation. This is a fraction of
+ *	the render cells' memory, which can be released while no one looks at
+ *	the dungeon.
+ */
+struct RenderSnapshot {
+	struct Tile {
+		std::uint16_t x, y;
+		utils::ShadingCase shading;
+		std::uint8_t alpha;
+		bool has_edges, valid;
+
+		Tile();
+	};
+
+	struct Ambience {
+		sf::Vector2u cell;
+		sf::Texture const * texture;
+		sf::Vector2f position, origin;
+		float rotation;
+		sf::Color color;
+
+		Ambience();
+	};
+
+	std::vector<Tile> tiles;
+	std::vector<Ambience> ambiences;
+
+	RenderSnapshot();
+
+	/// Add an ambience sprite
+	/**
+	 *	@param cell Position of the cell the sprite belongs to
+	 *	@param sprite Sprite with texture and transformation
+	 */
+	void add(sf::Vector2u const & cell, sf::Sprite const & sprite);
+
+	std::size_t getMemoryUsage() const;
+};
+
+namespace dungeon_impl {
+
+/// edge length of a terrain chunk in tiles
+extern unsigned int const TERRAIN_CHUNK_SIZE;
+
+/// Copy the dungeon's render cells into a snapshot
+/**
+ *	@pre dungeon.hasColdCells()
+ *	@param dungeon Dungeon to copy from
+ *	@param snapshot Snapshot to write to
+ */
+void takeSnapshot(Dungeon const & dungeon, RenderSnapshot& snapshot);
+
+/// Rebuild the dungeon's render cells from a snapshot
+/**
+ *	@pre dungeon.hasColdCells()
+ *	@param dungeon Dungeon to rebuild
+ *	@param snapshot Snapshot to read from
+ */
+void applySnapshot(Dungeon& dungeon, RenderSnapshot const & snapshot);
+
+}  // ::dungeon_impl
 
 // ---------------------------------------------------------------------------
 
+/// Terrain vertices of a square block of cells
+struct TerrainChunk {
+	utils::EnumMap<Terrain, sf::VertexArray> terrain;
+	bool dirty;
+
+	TerrainChunk();
+};
+
+/// Cache of a dungeon's terrain vertices
+/**
+ *	The terrain is split into chunks of TERRAIN_CHUNK_SIZE² cells. Each
+ *	chunk's vertices are fetched once and reused, until the chunk is
+ *	invalidated. So culling the terrain only depends on the number of
+ *	visible chunks instead of visible tiles. Everyone who modifies a tile
+ *	after it was rendered needs to invalidate it.
+ */
+class TerrainCache {
+  private:
+	std::vector<TerrainChunk> chunks;
+	sf::Vector2u num_chunks;
+
+  public:
+	/// Create an invalidated cache
+	/**
+	 *	@param scene_size Number of cells per dimension
+	 */
+	TerrainCache(sf::Vector2u const & scene_size);
+
+	/// Query number of chunks per dimension
+	sf::Vector2u getNumChunks() const;
+
+	/// Determine the chunk which contains the given cell
+	/**
+	 *	@param pos Cell position
+	 *	@return chunk position
+	 */
+	sf::Vector2u getChunkPos(sf::Vector2u const & pos) const;
+
+	/// Mark the chunk of the given cell to be fetched again
+	/**
+	 *	@param pos Cell position
+	 */
+	void invalidate(sf::Vector2u const & pos);
+
+	/// Mark all chunks to be fetched again and release their vertices
+	void invalidateAll();
+
+	/// Fetch a chunk's vertices if it was invalidated
+	/**
+	 *	@pre dungeon.hasColdCells()
+	 *	@param dungeon Dungeon to fetch tiles from
+	 *	@param chunk Chunk position
+	 *	@return number of vertices fetched, zero if the chunk was valid
+	 */
+	std::size_t update(Dungeon const & dungeon, sf::Vector2u const & chunk);
+
+	/// Query a chunk
+	/**
+	 *	@param chunk Chunk position
+	 *	@return const reference to the chunk
+	 */
+	TerrainChunk const & operator[](sf::Vector2u const & chunk) const;
+};
+
+// ---------------------------------------------------------------------------
+
+/// Owner of all dungeons
+/**
+ *	Dungeons that are not watched by any player can be evicted: Their
+ *	render cells are replaced by a snapshot, while their simulation cells
+ *	remain resident. So objects on evicted dungeons are still simulated.
+ *	Evicted dungeons are restored before they are rendered or targeted by
+ *	a teleport.
+ */
 class DungeonSystem {
   private:
 	using container = std::vector<std::unique_ptr<Dungeon>>;
 	using const_iterator = container::const_iterator;
 	
 	container scenes;
+	std::vector<std::unique_ptr<RenderSnapshot>> snapshots;
+	std::vector<TerrainCache> terrains;
 
   public:
 	DungeonSystem();
@@ -49,6 +196,43 @@ class DungeonSystem {
 	Dungeon& operator[](utils::SceneID scene_id);
 	Dungeon const& operator[](utils::SceneID scene_id) const;
 	
+	/// Replace a dungeon's render cells by a snapshot
+	/**
+	 *	Nothing is done if the dungeon is already evicted.
+	 *
+	 *	@param scene_id Scene ID of the dungeon
+	 */
+	void evict(utils::SceneID scene_id);
+	
+	/// Rebuild a dungeon's render cells from its snapshot
+	/**
+	 *	Nothing is done if the dungeon is resident.
+	 *
+	 *	@param scene_id Scene ID of the dungeon
+	 */
+	void restore(utils::SceneID scene_id);
+	
+	bool isResident(utils::SceneID scene_id) const;
+	
+	/// Query the terrain cache of a dungeon
+	/**
+	 *	@param scene_id Scene ID of the dungeon
+	 *	@return reference to the dungeon's terrain cache
+	 */
+	TerrainCache& getTerrain(utils::SceneID scene_id);
+	
+	/// Add an ambience sprite to a resident or evicted dungeon
+	/**
+	 *	@param scene_id Scene ID of the dungeon
+	 *	@param pos Position of the cell the sprite belongs to
+	 *	@param sprite Sprite to add
+	 */
+	void addAmbience(utils::SceneID scene_id, sf::Vector2u const & pos,
+		sf::Sprite const & sprite);
+	
+	/// Determine memory used by all snapshots
+	std::size_t getSnapshotMemory() const;
+	
 	const_iterator begin() const;
 	const_iterator end() const;
 	
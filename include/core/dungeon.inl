@@ -6,7 +6,9 @@ template <typename... Args>
 utils::SceneID DungeonSystem::create(Args&&... args) {
 	utils::SceneID id = scenes.size() + 1u;
 	auto uptr = std::make_unique<Dungeon>(id, std::forward<Args>(args)...);
+	terrains.emplace_back(uptr->getSize());
 	scenes.push_back(std::move(uptr));
+	snapshots.push_back(nullptr);
 	return id;
 }
 
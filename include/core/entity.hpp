@@ -22,7 +22,9 @@ namespace core {
 struct CollisionData : ComponentData {
 	bool is_projectile;
 	float radius;				   // projectile only
-	std::vector<ObjectID> ignore;  // ignored during collision
+	std::vector<ObjectID> ignore;  // ignored during collision (sorted)
+	sf::Vector2f last_pos;		   // pos at last bullet check
+	utils::SceneID last_scene;	   // scene at last bullet check
 
 	CollisionData();
 };
@@ -1,5 +1,9 @@
 #pragma once
+#include <array>
 #include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <core/common.hpp>
 #include <core/dungeon.hpp>
@@ -13,6 +17,82 @@ extern float const MAX_SIGHT;
 
 namespace focus_impl {
 
+/// Line-of-sight index of all focus objects per scene
+/**
+ *	Each scene is split into lanes: rows, columns, diagonals and
+ *	anti-diagonals. Each lane holds the objects located on it, sorted by
+ *	their coordinate along the lane. Moving an object only touches the lanes
+ *	it leaves or enters, so searching the nearest object in one of the eight
+ *	directions does not require visiting every cell in between.
+ *	The index is a hint: callers need to check the referred cells, because
+ *	objects might have been moved or released since the last update.
+ */
+class SightIndex {
+  public:
+	/// (coordinate along the lane, object) pairs sorted by coordinate
+	using Lane = std::vector<std::pair<unsigned int, ObjectID>>;
+
+  private:
+	enum Family { Row = 0u, Column, Diagonal, AntiDiagonal, NumFamilies };
+
+	struct Entry {
+		utils::SceneID scene;
+		sf::Vector2u pos;
+	};
+
+	struct Lanes {
+		sf::Vector2u size;
+		std::array<std::vector<Lane>, NumFamilies> lanes;
+	};
+
+	std::vector<Lanes> scenes;
+	std::unordered_map<ObjectID, Entry> entries;
+
+	Lanes& getLanes(Dungeon const& dungeon);
+	static std::pair<std::size_t, unsigned int> locate(
+		sf::Vector2u const& size, sf::Vector2u const& pos, std::size_t family);
+	void erase(Entry const& entry, ObjectID id, std::size_t family);
+	void insert(Entry const& entry, ObjectID id, std::size_t family);
+
+  public:
+	SightIndex();
+
+	/// Move an object to the given position
+	/**
+	 *	Only the lanes, which the object leaves or enters, are modified.
+	 *
+	 *	@param id Object to update
+	 *	@param dungeon Scene the object is located at
+	 *	@param pos Cell position of the object
+	 */
+	void update(ObjectID id, Dungeon const& dungeon, sf::Vector2u const& pos);
+
+	/// Remove an object from the index
+	/**
+	 *	@param id Object to remove, ignored if not indexed
+	 */
+	void remove(ObjectID id);
+
+	/// Remove all objects without focus component
+	/**
+	 *	@param focus_manager Focus components to keep
+	 */
+	void prune(FocusManager const& focus_manager);
+
+	/// Query the lane starting at a position into the given direction
+	/**
+	 *	@param dungeon Scene to query
+	 *	@param pos Starting position
+	 *	@param dir Direction to walk along the lane
+	 *	@param coord Will be set to the starting coordinate along the lane
+	 *	@return pointer to the lane or nullptr if the scene is not indexed
+	 */
+	Lane const* getLane(Dungeon const& dungeon, sf::Vector2u const& pos,
+		sf::Vector2i const& dir, unsigned int& coord) const;
+
+	std::size_t size() const;
+};
+
 /// helper structure to keep implementation signatures clean and tidy
 struct Context {
 	LogContext& log;
@@ -20,10 +100,11 @@ struct Context {
 	FocusManager& focus_manager;
 	DungeonSystem& dungeon_system;
 	MovementManager const& movement_manager;
+	SightIndex& sight_index;
 
 	Context(LogContext& log, FocusSender& focus_sender,
 		FocusManager& focus_manager, DungeonSystem& dungeon_system,
-		MovementManager const& movement_manager);
+		MovementManager const& movement_manager, SightIndex& sight_index);
 };
 
 }  // ::focus_impl
@@ -52,8 +133,15 @@ class FocusSystem
 	  public FocusManager {
 
   protected:
+	focus_impl::SightIndex sight_index;
 	focus_impl::Context context;
 
+	/// Add a spawned object to the sight index
+	void onSpawned(FocusData& data) override;
+
+	/// Remove a released object from the sight index
+	void onReleased(FocusData const& data) override;
+
   public:
 	FocusSystem(LogContext& log, std::size_t max_objects, DungeonSystem& dungeon,
 		MovementManager const& movement_manager);
@@ -89,6 +177,34 @@ ObjectID traverseCells(Dungeon const& dungeon, sf::Vector2u pos,
 	sf::Vector2i const& dir, float depth,
 	std::function<bool(ObjectID, int)> handle);
 
+/// Searches along a lane of the sight index and applies the handle
+/**
+ *	This behaves like `traverseCells` but only visits cells that are
+ *	referred by the sight index. The terrain in between is still checked,
+ *	so walls block the sight. If the scene is not indexed, this falls back
+ *	to `traverseCells`.
+ *
+ *	@param dungeon Corresponding spatial scene to search at
+ *	@param index Sight index of the focus objects
+ *	@param pos Starting position for the traversal
+ *	@param dir Traversal direction to step from cell to cell
+ *	@param depth Maximum traversal depth
+ *	@param handle Lambda to determine whether an object is appropriate
+ *	@return Object's id or 0 if none found
+ */
+ObjectID traverseLane(Dungeon const& dungeon, SightIndex const& index,
+	sf::Vector2u pos, sf::Vector2i const& dir, float depth,
+	std::function<bool(ObjectID, int)> handle);
+
+/// Updates the sight index entry of an object
+/**
+ *	The object is removed from the index if it is not located at any scene.
+ *
+ *	@param context Focusing context to work with
+ *	@param id Object to update
+ */
+void syncIndex(Context& context, ObjectID id);
+
 void setFocus(Context const& context, FocusData& observer, FocusData* observed);
 
 /// Updates all focusing if an object changed its looking direction
@@ -1,4 +1,7 @@
 #pragma once
+#include <utils/event_channel.hpp>
+#include <utils/job_system.hpp>
+
 #include <core/common.hpp>
 #include <core/dungeon.hpp>
 #include <core/event.hpp>
@@ -24,6 +27,28 @@ extern float const CELL_CENTER_DIVERGENCE;
 // determines maximum step (with lowest frametime)
 float const MAX_SPEED = MAX_TILE_STEP / (MAX_FRAMETIME_MS * MOVEMENT_VELOCITY);
 
+// number of components per job if updated in parallel
+extern std::size_t const CHUNK_SIZE;
+
+/// trigger, which was reached while updating in parallel
+struct PendingTrigger {
+	ObjectID actor;
+	utils::SceneID scene;
+	sf::Vector2u pos;
+
+	PendingTrigger(ObjectID actor, utils::SceneID scene, sf::Vector2u const& pos);
+};
+
+/// object found apart from its cell while updating in parallel
+struct Misplacement {
+	ObjectID actor;
+	sf::Vector2f pos;
+	sf::Vector2u source;
+
+	Misplacement(ObjectID actor, sf::Vector2f const& pos,
+		sf::Vector2u const& source);
+};
+
 /// helper structure to keep implementation signatures clean and tidy
 struct Context {
 	LogContext& log;
@@ -31,10 +56,34 @@ struct Context {
 	MovementManager& movement_manager;
 	DungeonSystem& dungeon_system;
 
+	// if set, reached triggers are collected instead of executed
+	std::vector<PendingTrigger>* triggers;
+	// if set, misplaced objects are collected instead of logged
+	std::vector<Misplacement>* misplaced;
+
 	Context(LogContext& log, MoveSender& move_sender,
 		MovementManager& movement_manager, DungeonSystem& dungeon_system);
 };
 
+/// per-job buffers of a parallel update
+struct Chunk {
+	std::vector<PendingTrigger> triggers;
+	std::vector<Misplacement> misplaced;
+
+	Chunk();
+};
+
+using MoveChannel = utils::EventChannel<MoveEvent>;
+
+/// buffers of a parallel update, which are reused by later updates
+struct ParallelBuffers {
+	std::vector<Chunk> chunks;
+	MoveChannel events;			// one producer per chunk
+	MoveChannel::Reader reader;	// forwards to the context's sender
+
+	ParallelBuffers();
+};
+
 enum class MoveStyle {
 	Forward, Sideward, Backward
 };
@@ -69,6 +118,11 @@ enum class MoveStyle {
  *	is done via dirty flag. The dirty flag is set by the movement system after
  *	it changed a world position. If not, the flag isn't set. It is reset by
  *	the render system after processing the new position.
+ *	If a JobSystem is provided, large component sets are interpolated in
+ *	chunks across its threads. Each chunk sends its MoveEvents to its own
+ *	producer buffer of an event channel and collects reached triggers on its
+ *	own. Afterwards, the events are published and the triggers are executed
+ *	in chunk order, so the outcome does not depend on the thread scheduling.
  */
 class MovementSystem
 	// Event API
@@ -80,9 +134,12 @@ class MovementSystem
 
   protected:
 	movement_impl::Context context;
+	utils::JobSystem* jobs;
+	movement_impl::ParallelBuffers buffers;
 
   public:
-	MovementSystem(LogContext& log, std::size_t max_objects, DungeonSystem& dungeon);
+	MovementSystem(LogContext& log, std::size_t max_objects,
+		DungeonSystem& dungeon, utils::JobSystem* jobs=nullptr);
 
 	void handle(InputEvent const& event);
 	void handle(CollisionEvent const& event);
@@ -110,6 +167,52 @@ namespace movement_impl {
 void updateRange(Context& context, MovementManager::iterator begin,
 	MovementManager::iterator end, sf::Time const& elapsed);
 
+/// This will update a range of components using multiple threads
+/**
+ *	The range is split into chunks of `CHUNK_SIZE` components, which are
+ *	updated by the given job system using `updateRange`. Each chunk sends its
+ *	events to its producer buffer of the channel. Reached triggers are
+ *	collected per chunk, as well as misplaced objects because the log is not
+ *	thread-safe. Once all chunks are done, the channel publishes the events
+ *	in chunk order and its reader forwards them to the context's sender.
+ *	Then the misplaced objects are logged and the triggers are executed in
+ *	chunk order. So the events are propagated in the same order as a
+ *	sequential update would do.
+ *
+ *	@param context Movement context to work with
+ *	@param jobs Job system to use
+ *	@param buffers Buffers of the update, which are resized and reused
+ *	@param begin Iterator to the start of the component range
+ *	@param end Iterator to the end of the component range
+ *	@param elapsed Duration that is used for interpolation
+ */
+void updateParallel(Context& context, utils::JobSystem& jobs,
+	ParallelBuffers& buffers, MovementManager::iterator begin,
+	MovementManager::iterator end, sf::Time const& elapsed);
+
+/// This will execute the trigger at the given position
+/**
+ *	Expired triggers are deleted afterwards. If the position has no trigger,
+ *	nothing is done.
+ *
+ *	@param context Movement context to work with
+ *	@param actor Object that reached the position
+ *	@param scene Scene of the position
+ *	@param pos Reached position
+ */
+void executeTrigger(Context& context, ObjectID actor, utils::SceneID scene,
+	sf::Vector2u const& pos);
+
+/// This will log an object, which is located apart from its cell
+/**
+ *	@param context Movement context to work with
+ *	@param actor Misplaced object
+ *	@param pos Position of the object
+ *	@param source Cell the object is assigned to
+ */
+void logMisplacement(Context& context, ObjectID actor, sf::Vector2f const& pos,
+	sf::Vector2u const& source);
+
 /// This will trigger or schedule a new movement for the given object
 /**
  *	Applying a new movement direction while moving is dangerous, because this
@@ -191,6 +294,19 @@ float calcSpeedFactor(MovementData const& data);
  */
 void interpolate(Context& context, MovementData& data, sf::Time const& elapsed);
 
+/// Predict an object's position ahead of the last interpolation
+/**
+ *	This applies the same step as `interpolate` but without modifying the
+ *	component or propagating any events. The predicted position does not
+ *	exceed the movement's target. It is used to render objects between two
+ *	simulation ticks.
+ *
+ *	@param data Component data to predict
+ *	@param ahead Duration to predict
+ *	@return predicted world position
+ */
+sf::Vector2f predictPosition(MovementData const& data, sf::Time const& ahead);
+
 }  // ::movement_impl
 
 }  // ::core
@@ -16,21 +16,44 @@ using Renderables = std::vector<RenderData const*>;
 /// Contains all data that has been collected through culling
 struct CullingBuffer {
 	// basic rendering
-	utils::EnumMap<Terrain, sf::VertexArray> terrain;
+	std::vector<TerrainChunk const *> chunks;
 	utils::EnumMap<ObjectLayer, Renderables> objects;
 	// ambiences
 	std::vector<sf::Sprite const *> ambiences;
-	// lighting
+	// lighting (edges are merged once, each light refers to its range of
+	// edge indices)
 	std::vector<utils::Edge> edges;
+	std::vector<std::size_t> edge_indices;
 	std::vector<utils::Light> lights;
+	std::vector<utils::EdgeRange> shadows;
 	// player highlighting
 	std::vector<sf::Sprite const*> highlights;
 	// debugging
 	sf::VertexArray grid;
+	// sprites of one object layer (refilled while drawing)
+	utils::SpriteBatch sprites;
 
 	CullingBuffer();
 };
 
+/// Statistics of the most recent culling
+struct Stats {
+	std::size_t chunks;            // terrain chunks culled
+	std::size_t terrain_vertices;  // vertices fetched into chunks
+	std::size_t objects;           // objects culled for drawing
+	std::size_t rejected;          // objects skipped as not visible
+	std::size_t sprites;           // object sprites drawn
+	std::size_t batches;           // groups the sprites were drawn in
+	std::size_t draw_calls;        // draw calls of terrain, ambiences,
+	                               // highlightings and sprites
+	std::size_t lights;            // lights culled for drawing
+	std::size_t discarded;         // lights skipped as not influencing
+	std::size_t edges;             // edges merged for shadowcasting
+	std::size_t light_edges;       // edge/light pairs for shadowcasting
+
+	Stats();
+};
+
 /// helper structure to keep implementation signatures clean and tidy
 struct Context {
 	LogContext& log;
@@ -42,8 +65,10 @@ struct Context {
 	utils::LightingSystem& lighting_system;
 
 	mutable std::vector<CullingBuffer> buffers;
+	mutable Stats stats;
 	sf::Color grid_color;
 	bool cast_shadows;
+	sf::Time lookahead;
 	mutable sf::Shader sprite_shader;
 
 	Context(LogContext& log, RenderManager& render_manager,
@@ -98,10 +123,25 @@ class RenderSystem : public sf::Drawable
 	void setCastShadows(bool flag);
 	void setGridColor(sf::Color color);
 
+	/// Set time the rendering is ahead of the simulation
+	/**
+	 *	Moving objects and cameras are drawn at their predicted position,
+	 *	so the rendering stays smooth between two fixed simulation ticks.
+	 *
+	 *	@param ahead Time since the last simulation tick
+	 */
+	void setLookahead(sf::Time const& ahead);
+
 	void handle(SpriteEvent const& event);
 
 	void update(sf::Time const& elapsed);
 	void cull();
+	
+	/// Query statistics of the most recent culling
+	/**
+	 *	@return const reference to the statistics
+	 */
+	render_impl::Stats const & getStats() const;
 };
 
 namespace render_impl {
@@ -173,7 +213,8 @@ void applyAnimation(AnimationData const& ani_data, RenderData& data);
  *	component's data. This results in a new transformation matrix and/or
  *	updated sprite states (rectangle and origin) per layer. Those data are
  *	only applied if the corresponding components' dirtyflags are set.
- *	Otherwise the object will remain it its previous state.
+ *	Otherwise the object will remain it its previous state. If the context
+ *	has a lookahead, moving objects are transformed each time.
  *
  *	@pre The object is assigned to a dungeon.
  *	@param context Rendering context to work with
@@ -181,6 +222,19 @@ void applyAnimation(AnimationData const& ani_data, RenderData& data);
  */
 void updateObject(Context& context, RenderData& data);
 
+/// Determine an object's screen position
+/**
+ *	The object's position is predicted by the context's lookahead.
+ *
+ *	@pre The object is assigned to a dungeon.
+ *	@param context Rendering context to work with
+ *	@param move_data Movement component of the object
+ *	@param dungeon Dungeon the object is assigned to
+ *	@return screen position of the object
+ */
+sf::Vector2f getScreenPos(Context const& context, MovementData const& move_data,
+	Dungeon const& dungeon);
+
 /// Updates all cameras position and zoom
 /**
  *	This is used to update all cameras position and zoom since the last update.
@@ -198,12 +252,23 @@ void updateObject(Context& context, RenderData& data);
  */
 void updateCameras(Context& context, sf::Time const& elapsed);
 
+/// Centers all cameras at their objects' predicted positions
+/**
+ *	This is used before culling if the rendering is ahead of the simulation.
+ *	The zoom is not changed.
+ *
+ *	@pre Each camera has at least one object.
+ *	@pre Each camera's object is assigned to a dungeon.
+ *	@param context Rendering context to work with
+ */
+void centerCameras(Context& context);
+
 // --------------------------------------------------------------------
 
 // Cull ambiences of the given tile
 /// @param buffer CullingBuffer to write to
-/// @param cell Dungeon cell to cull from
-void cullAmbiences(CullingBuffer& buffer, DungeonCell const & cell);
+/// @param cell Render cell to cull from
+void cullAmbiences(CullingBuffer& buffer, RenderCell const & cell);
 
 /// Collect edges from an entity for causing shadows
 /// The entity's sprite's rect is used as edge. Also the entity's
@@ -214,6 +279,61 @@ void cullAmbiences(CullingBuffer& buffer, DungeonCell const & cell);
 /// @param edges Out parameter for edges
 void addEdges(Context const & context, RenderData const & data, std::vector<utils::Edge>& edges);
 
+/// Determine whether an object would be visible
+/**
+ *	An object is not visible if none of its layers is occupied, if all
+ *	occupied layers are fully transparent or if its bounds are located
+ *	outside the view rectangle.
+ *
+ *	@param data RenderData of the object with updated transformation
+ *	@param view Rectangle of the visible area in scene coordinates
+ *	@return true if the object needs to be drawn
+ */
+bool isVisible(RenderData const & data, sf::FloatRect const & view);
+
+/// Collect edges which may cast the shadows of the lights
+/**
+ *	Only the edges of those cells (and the objects inside them) are
+ *	collected which are within the shadow range of any shadowcasting light.
+ *	So the dungeon's grid is used to query the edges near the lights. Each
+ *	cell is visited once, even if the shadow ranges overlap.
+ *
+ *	@param context Const reference to underlying context
+ *	@param dungeon Dungeon which contains the lights
+ *	@param lights Light sources with their radius scaled to pixels
+ *	@param edges Out parameter for edges
+ */
+void addShadowEdges(Context const & context, Dungeon const & dungeon,
+	std::vector<utils::Light> const & lights, std::vector<utils::Edge>& edges);
+
+/// Cull the lights that influence the visible area
+/**
+ *	All lights within the maximum light radius around the visible area are
+ *	considered. Lights whose lit square does not intersect the view are
+ *	discarded. If shadowcasting is enabled, the edges near all remaining
+ *	lights are collected and merged once. Then each light is given the
+ *	indices of the merged edges near it.
+ *
+ *	@param context Rendering context to work with
+ *	@param buffer CullingBuffer to write to
+ *	@param dungeon Dungeon to cull the lights of
+ *	@param view Rectangle of the visible area in scene coordinates
+ */
+void cullLights(Context& context, CullingBuffer& buffer, Dungeon& dungeon,
+	sf::FloatRect const & view);
+
+/// Cull the terrain chunks that intersect the visible area
+/**
+ *	Invalidated chunks are fetched again, all others are reused. The
+ *	visible area is given by the dungeon's current view and padding.
+ *
+ *	@param context Rendering context to work with
+ *	@param buffer CullingBuffer to write to
+ *	@param dungeon Dungeon to cull the terrain of
+ */
+void cullTerrain(Context& context, CullingBuffer& buffer,
+	Dungeon const & dungeon);
+
 /// Culls all relevant data for a specific camera to a buffer
 /**
  *	This is used to cull all relevant data (terrain tiles, layer-sorted
@@ -255,15 +375,19 @@ void drawHighlightings(CullingBuffer const & buffer, sf::RenderTarget& target);
 /// Draw all sprites to the render target
 /**
  *	This is used to draw all renderables to the given target. Each renderable
- *	contains of multiple layered sprites. While drawing, the entire rendering
- *	state (including colorization) is used by applying a suitable shader.
+ *	contains of multiple layered sprites. Those are collected by the given
+ *	sprite batch in the objects' order, so consecutive sprite layers of the
+ *	same texture are drawn at once without changing the painting order.
+ *	While drawing, the entire rendering state (including
+ *	colorization) is used by applying a suitable shader.
  *
  *	@param context Rendering context to work with
  *	@param objects Array of render components to draw
+ *	@param batch SpriteBatch to collect the sprites with
  *	@param target RenderTarget to draw to
  */
 void drawSprites(Context const& context, Renderables const& objects,
-	sf::RenderTarget& target);
+	utils::SpriteBatch& batch, sf::RenderTarget& target);
 
 /// Draw the entire scene to the render target
 /**
@@ -106,7 +106,8 @@ class TeleportTrigger : public BaseTrigger {
 	 *	This will move the specified actor from its current position and
 	 *	dungeon to the specified ones. If the specified position is not
 	 *	accessable, a near by location is searched. If found, the telport
-	 *	is executed.
+	 *	is executed. If the target dungeon was evicted, its render cells
+	 *	are restored first.
 	 *	The MoveSender is notified about entering the new tile. In order
 	 *	to make the focus system able to renew the focus, a TileLeft is
 	 *	propagated. The object is stopped on teleport.
@@ -17,7 +17,15 @@ struct AiSystem
 	game::PathSystem path;
 	game::NavigationSystem navigation;
 
-	AiSystem(core::LogContext& log, std::size_t max_objects);
+	/// Create AI with the given number of pathfinding threads
+	/**
+	 *	@param log Logging context
+	 *	@param max_objects Maximum number of objects
+	 *	@param path_workers Number of pathfinding worker threads, 0
+	 *		calculates all paths on the game's thread
+	 */
+	AiSystem(core::LogContext& log, std::size_t max_objects,
+		std::size_t path_workers);
 	~AiSystem();
 	
 	void connect(MultiEventListener& listener);
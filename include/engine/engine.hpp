@@ -1,4 +1,7 @@
 #pragma once
+#include <functional>
+#include <string>
+
 #include <core/dungeon.hpp>
 #include <rpg/combat.hpp>
 #include <game/mod.hpp>
@@ -25,9 +28,33 @@ sf::Texture const& get_lightmap(
 
 // ---------------------------------------------------------------------------
 
+/// Random streams which are derived from a single seed
+/**
+ *	Each subsystem draws from a stream of its own, so their random numbers
+ *	do not depend on each other. New streams need to be appended here, so
+ *	no index is used twice.
+ */
+enum class SeedStream : std::uint32_t {
+	Generator = 0u, Factory, Combat, Script, Input, Audio, Placement
+};
+
+/// Derive the seed of a subsystem's random stream
+/**
+ *	@param seed Seed of the game
+ *	@param stream Stream to derive the seed for
+ *	@return seed of the stream
+ */
+std::uint32_t deriveSeed(std::uint32_t seed, SeedStream stream);
+
+// ---------------------------------------------------------------------------
+
 struct Engine {
+	/// Callback to record how long a system took, e.g. "physics"
+	using Recorder = std::function<void(std::string const&, sf::Time const&)>;
+
 	core::IdManager id_manager;
 	core::DungeonSystem dungeon;
+	utils::JobSystem jobs;
 
 	engine::PhysicsSystem physics;
 	engine::AvatarSystem avatar;
@@ -43,9 +70,51 @@ struct Engine {
 	game::Factory factory;
 
 	Engine(core::LogContext& log, std::size_t max_objects, sf::Vector2u const& screen_size,
-		float zoom, unsigned int poolsize, game::Mod& mod,
-		game::ResourceCache& cache, game::Localization& locale);
+		float zoom, unsigned int poolsize, std::size_t path_workers,
+		game::Mod& mod, game::ResourceCache& cache,
+		game::Localization& locale);
 	
+	/// Release all objects that were marked for removal
+	/**
+	 *	This should be called once per frame, before the simulation ticks.
+	 */
+	void cleanup();
+
+	/// Run one simulation tick of all systems
+	/**
+	 *	The systems are updated in a fixed order. The time each of them
+	 *	took is passed to the recorder (behavior, physics, avatar, ui,
+	 *	combat and ai).
+	 *
+	 *	@param elapsed Duration of the tick
+	 *	@param use_autocam Whether the autocam is enabled
+	 *	@param record Callback to record the systems' timings
+	 */
+	void update(sf::Time const& elapsed, bool use_autocam,
+		Recorder const& record);
+
+	/// Seed all reproducible random streams
+	/**
+	 *	Each of generator, factory, combat, scripts, input and audio uses a
+	 *	stream of its own, which is derived from the given seed using
+	 *	`deriveSeed`. So the same
+	 *	seed yields the same dungeons and fights, if the same actions are
+	 *	performed.
+	 *
+	 *	@param seed Seed to use
+	 */
+	void setSeed(std::uint32_t seed);
+
+	/// Evict dungeons which are not watched by any camera
+	/**
+	 *	Only the render cells of those dungeons are released, so their
+	 *	objects are still simulated. Their terrain, entities, triggers and
+	 *	navigation data stay resident for the same reason. Each call evicts
+	 *	at most one dungeon, so taking snapshots is spread over several
+	 *	frames. Watched dungeons are restored immediately.
+	 */
+	void pageDungeons();
+
 	void connect(MultiEventListener& listener);
 	void disconnect(MultiEventListener& listener);
 	
@@ -19,7 +19,8 @@ struct PhysicsSystem : utils::EventListener<core::InputEvent> {
 	core::FocusSystem focus;
 	rpg::ProjectileSystem projectile;
 
-	PhysicsSystem(core::LogContext& log, std::size_t max_objects, core::DungeonSystem& dungeon);
+	PhysicsSystem(core::LogContext& log, std::size_t max_objects,
+		core::DungeonSystem& dungeon, utils::JobSystem* jobs=nullptr);
 	
 	void connect(MultiEventListener& listener);
 	void disconnect(MultiEventListener& listener);
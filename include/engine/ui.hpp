@@ -46,7 +46,7 @@ struct UiSystem
 		core::DungeonSystem& dungeon, rpg::StatsManager const& stats,
 		rpg::ItemManager const & item, rpg::PlayerManager const & player,
 		game::Localization& locale, std::string const & music_base,
-		std::string const & music_ext);
+		std::string const & music_ext, utils::JobSystem* jobs=nullptr);
 	
 	void connect(MultiEventListener& listener);
 	void disconnect(MultiEventListener& listener);
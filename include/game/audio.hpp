@@ -1,5 +1,6 @@
 #pragma once
 #include <utils/enum_map.hpp>
+#include <utils/random.hpp>
 
 #include <core/entity.hpp>
 #include <core/event.hpp>
@@ -22,6 +23,7 @@ struct Context {
 	utils::EnumMap<rpg::FeedbackType, std::vector<sf::SoundBuffer const *>> feedback;
 	std::vector<std::string> music;
 	std::vector<sf::SoundBuffer const *> levelup, powerup;
+	utils::RandomStream rng; // sound and music variants
 	
 	Context(core::LogContext& log, core::SoundManager const & sounds,
 		rpg::ItemManager const & items, rpg::PlayerManager const & players,
@@ -64,6 +66,12 @@ class AudioSystem
 	void addLevelup(sf::SoundBuffer const & buffer);
 	void addPowerup(sf::SoundBuffer const & buffer);
 	
+	/// Restart the random stream used to pick sound and music variants
+	/**
+	 *	@param seed Seed to use
+	 */
+	void setSeed(std::uint32_t seed);
+	
 	void handle(core::MusicEvent const & event);
 	void handle(core::MoveEvent const & event);
 	void handle(rpg::ItemEvent const & event);
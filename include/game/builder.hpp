@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 
+#include <utils/random.hpp>
 #include <core/dungeon.hpp>
 #include <rpg/resources.hpp>
 #include <game/resources.hpp>
@@ -9,6 +10,9 @@ namespace game {
 
 namespace dungeon_impl {
 
+/// Number of rows that are processed by a single job
+extern unsigned int const STRIPE_HEIGHT;
+
 /// Returns true if the specified tile is pure void
 /**
  *	@param dungeon DungeonBuilder to query at
@@ -66,9 +70,39 @@ void placeWall(core::Dungeon& dungeon, sf::Vector2u const& pos);
  *	@param tileset Tileset to ue for tile seleciton
  *	@param dungeon DungeonBuilder to prepare at
  *	@param pos Position to prepare at
+ *	@param rng Random stream to pick the tile with
  */
 void prepareTile(rpg::TilesetTemplate const& tileset, core::Dungeon& dungeon,
-	sf::Vector2u const& pos);
+	sf::Vector2u const& pos, utils::RandomStream& rng);
+
+/// Find wall positions within a range of rows
+/**
+ *	Each void tile next to a floor tile is reported, but the dungeon is not
+ *	modified. So multiple row ranges can be searched in parallel.
+ *
+ *	@param dungeon Dungeon to search in
+ *	@param first First row to search
+ *	@param last Row after the last row to search
+ *	@param walls Vector to append the positions to
+ */
+void findWalls(core::Dungeon const& dungeon, unsigned int first,
+	unsigned int last, std::vector<sf::Vector2u>& walls);
+
+/// Prepare all tiles within a range of rows
+/**
+ *	Each row uses a random stream derived from the given seed and the row
+ *	index, so the tiles do not depend on how the rows are split. Since only
+ *	the tiles of the given rows are modified, multiple row ranges can be
+ *	prepared in parallel once all walls are placed.
+ *
+ *	@param tileset Tileset to use for tile selection
+ *	@param dungeon Dungeon to prepare at
+ *	@param seed Seed to derive the rows' random streams from
+ *	@param first First row to prepare
+ *	@param last Row after the last row to prepare
+ */
+void prepareTiles(rpg::TilesetTemplate const& tileset, core::Dungeon& dungeon,
+	std::uint32_t seed, unsigned int first, unsigned int last);
 
 void makeTransparent(core::Dungeon& dungeon, sf::Vector2u const & pos, bool transparent=true);
 
@@ -90,6 +124,7 @@ void transform(sf::Vector2i& dir, float angle, bool flip_x, bool flip_y);
 struct BuildSettings {
 	unsigned int cell_size, path_width;
 	bool random_transform, editor_mode;
+	std::uint32_t seed; // used to pick tile variants
 	
 	BuildSettings();
 };
@@ -191,10 +226,26 @@ struct DungeonBuilder {
 
 	DungeonBuilder(sf::Vector2u const& grid_size);
 
+	/// Place the floor tiles of all rooms and paths
+	/// This resets and populates the build information.
+	/// @pre grid_size == dungeon size
+	/// @param dungeon Dungeon to populate
+	/// @param settings BuildSettings to use
+	void placeFloors(core::Dungeon& dungeon, BuildSettings const & settings);
+
+	/// Make the corridors and the given auto-walls semi-transparent
+	/// This is used in editor mode, after all tiles were prepared.
+	/// @param dungeon Dungeon to modify
+	/// @param autowalls Positions of the walls placed next to floors
+	void highlight(core::Dungeon& dungeon,
+		std::vector<sf::Vector2u> const & autowalls) const;
+
 	/// Dig all rooms and paths inside the dungeon
 	/// This will dig all rooms and paths inside the dungeon. First all floor
 	/// tiles are placed. After that a thin border of wall tiles is placed
-	/// next to each bordering floor tile.
+	/// next to each bordering floor tile. All steps are done by the calling
+	/// thread, see Factory::createDungeons for building multiple dungeons
+	/// in parallel.
 	/// @pre grid_size == dungeon size
 	/// @pre All rooms are valid referring to the dungeon's size
 	/// @pre All paths are valid referring to the dungeon's size and path's
@@ -16,6 +16,14 @@ unsigned int const FADE_DELAY = 1000;
 // used for pathfinding
 ENUM(PathPhase, Broad, (Broad)(Narrow))
 
+// known callbacks of an ai script
+ENUM(AiCallback, onInit, (onInit)(onUpdate)(onIdle)(onTeleport)
+	(onObjectCollision)(onTileCollision)(onTileLeft)(onTileReached)
+	(onGotFocus)(onLostFocus)(onWasFocused)(onWasUnfocused)
+	(onEffectReceived)(onEffectFaded)(onEffectInflicted)(onStatsReceived)
+	(onStatsInflicted)(onDeath)(onEnemyKilled)(onSpawned)(onCausedSpawn)
+	(onFeedback)(onPathFailed))
+
 using Path = std::vector<sf::Vector2u>;
 
 /// Interface of Pathfinding API
@@ -49,5 +57,7 @@ target) = 0;
 }  // ::rage
 
 ENUM_STREAM(game::PathPhase)
+ENUM_STREAM(game::AiCallback)
 
 SET_ENUM_LIMITS(game::PathPhase::Broad, game::PathPhase::Narrow)
+SET_ENUM_LIMITS(game::AiCallback::onInit, game::AiCallback::onPathFailed)
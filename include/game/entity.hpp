@@ -10,6 +10,8 @@
 
 namespace game {
 
+struct AiScript;
+
 struct HudData : core::ComponentData {
 	std::unique_ptr<ui::PlayerHud> hud;
 
@@ -19,7 +21,8 @@ struct HudData : core::ComponentData {
 struct ScriptData : core::ComponentData {
 	bool is_active;
 	std::unique_ptr<LuaApi> api;
-	utils::Script const* script;
+	AiScript const* script;
+	sf::Time next_update;  // zero if not scheduled yet
 
 	ScriptData();
 };
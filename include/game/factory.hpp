@@ -2,6 +2,7 @@
 #include <functional>
 
 #include <utils/delay_system.hpp>
+#include <utils/job_system.hpp>
 #include <core/entity.hpp>
 #include <core/event.hpp>
 #include <rpg/entity.hpp>
@@ -28,6 +29,15 @@ extern std::size_t const MAX_POWERUP_SPAWN_DRIFT;
 
 using BuilderModifier = std::function<void(DungeonBuilder& builder)>;
 
+/// Description of a dungeon that is created along with others
+struct DungeonRequest {
+	rpg::TilesetTemplate const * tileset;
+	sf::Vector2u grid_size;
+	BuildSettings settings;
+
+	DungeonRequest();
+};
+
 // --------------------------------------------------------------------
 
 namespace factory_impl {
@@ -60,6 +70,7 @@ class Factory
 	};
 	
 	core::LogContext& log;
+	utils::JobSystem* jobs;
 	std::size_t const max_num_players;
 	Session& session;
 	Mod& mod;
@@ -69,10 +80,13 @@ class Factory
 	rpg::PlayerID latest_player;
 
 	void setupObject(core::ObjectID id, rpg::EntityTemplate const & entity);
+	void createEntities(utils::SceneID id, DungeonBuilder const & builder,
+		BuildSettings const & settings);
 
   public:
 	sf::Texture const * blood_texture;
 	rpg::EntityTemplate const * gem_tpl;
+	utils::RandomStream rng; // build seeds, ambiences and powerups
 	
 	/// Create a new factory
 	/**
@@ -81,9 +95,11 @@ class Factory
 	 *
 	 *	@param log Reference to the logging context
 	 *	@param session Reference to active session
-	/// @param mod Reference to mod manager
+	 *	@param mod Reference to mod manager
+	 *	@param jobs Optional job system to build multiple dungeons with
 	 */
-	Factory(core::LogContext& log, Session& session, Mod& mod);
+	Factory(core::LogContext& log, Session& session, Mod& mod,
+		utils::JobSystem* jobs=nullptr);
 
 	/// Handle bullet explosion
 	/**
@@ -99,7 +115,10 @@ class Factory
 	/// Create a new dungeon
 	/// This creates a new dungeon. The dungeon content will be randomly
 	/// generated. The modifier callback is supposed to be used in
-	/// editor mode.
+	/// editor mode. Like each floor of `createDungeons`, the layout and
+	/// the rooms' transformations use a stream seeded by the generator's
+	/// stream. The builder's seed is drawn from the factory's stream, so
+	/// the given settings' seed is ignored.
 	/// @param tileset Tileset reference to use
 	/// @param grid_size Total dungeon size
 	/// @param settings BuildSettings to use for dungeon
@@ -109,6 +128,18 @@ class Factory
 		sf::Vector2u grid_size, BuildSettings const & settings,
 		BuilderModifier modifier=[](DungeonBuilder&){});
 
+	/// Create multiple dungeons at once
+	/// Layout generation, tile preparation and navigation are spread
+	/// across the job system's threads, both across the dungeons and
+	/// in stripes of rows within each dungeon. Only the dungeons'
+	/// entities are spawned by the calling thread. Each dungeon draws
+	/// its seeds from the generator's and factory's streams in request
+	/// order, so the result does not depend on the thread scheduling.
+	/// @param requests Dungeons to create
+	/// @return scene ids in request order
+	std::vector<utils::SceneID> createDungeons(
+		std::vector<DungeonRequest> const & requests);
+
 	/// Create an ambience sprite
 	/// The sprite will get a random offset and rotation
 	/// @param texture Texture to use
@@ -162,7 +193,7 @@ class Factory
 	 */
 	core::ObjectID createBot(BotTemplate const& bot,
 		rpg::SpawnMetaData const& data, std::size_t level,
-		utils::Script const& script, bool hostile, float difficulty=1.f);
+		AiScript const& script, bool hostile, float difficulty=1.f);
 
 	/// Create a new player object
 	/// This creates a new player object. A corresponding base object is
@@ -3,6 +3,7 @@
 #include <memory>
 #include <SFML/System/Vector2.hpp>
 
+#include <utils/random.hpp>
 #include <game/builder.hpp>
 #include <game/navigator.hpp>
 #include <game/resources.hpp>
@@ -38,14 +39,34 @@ class DungeonGenerator {
   public:
 	GeneratorSettings settings;
 	std::vector<RoomTemplate const*> rooms;
+	utils::RandomStream rng;
 	
 	DungeonGenerator(core::LogContext& log);
 	
 	void layoutifySize(sf::Vector2u& grid_size);
 	
+	/// Allocate empty dungeon data
+	/// This verifies the settings and rooms and creates the data for
+	/// the given scene, which is populated afterwards.
+	/// @pre !all_rooms.empty()
+	/// @pre each room template is valid
+	/// @param id Scene ID of the dungeon
+	/// @param grid_size Total size used for the dungeon
+	/// @return empty dungeon data
+	DungeonData& allocate(utils::SceneID id, sf::Vector2u grid_size);
+	
+	/// Populate dungeon data
+	/// This creates the dungeon's graph, rooms and paths. Since neither
+	/// the generator nor other dungeons' data are modified, multiple
+	/// dungeons can be populated in parallel, each with its own stream.
+	/// @param result Allocated dungeon data
+	/// @param rng Random stream to use
+	/// @return false if not all nodes could be placed
+	bool populate(DungeonData& result, utils::RandomStream& rng) const;
+	
 	/// Generate dungeon data
-	/// This generates dungeon data for the given settings. All
-	/// randomization is done here.
+	/// This allocates and populates dungeon data for the given settings.
+	/// All randomization is done here, using the generator's random stream.
 	/// @pre !all_rooms.empty()
 	/// @pre each room template is valid
 	/// @param grid_size Total size used for the dungeon
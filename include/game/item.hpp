@@ -1,12 +1,15 @@
 #pragma once
+#include <utils/random.hpp>
 #include <rpg/resources.hpp>
 
 namespace game {
 
-void randomize(float& factor, float min_base, float max_base, float exp);
-void randomize(
-	std::uint32_t& factor, float min_base, float max_base, float exp);
+void randomize(utils::RandomStream& rng, float& factor, float min_base,
+	float max_base, float exp);
+void randomize(utils::RandomStream& rng, std::uint32_t& factor,
+	float min_base, float max_base, float exp);
 
-void randomize(rpg::ItemTemplate& item, std::size_t level);
+void randomize(
+	utils::RandomStream& rng, rpg::ItemTemplate& item, std::size_t level);
 
 }  // ::rage
@@ -29,11 +29,13 @@ struct LuaApi {
 	core::LogContext& log;
 	core::ObjectID const id;
 	bool hostile;
+	sf::Time tick_rate;
 	rpg::Session const& session;
 	ScriptManager const& script;
 	core::InputSender& input_sender;
 	rpg::ActionSender& action_sender;
 	rpg::ItemSender& item_sender;
+	NavigationSystem& navigation;
 
 	PathTracer tracer;
 
@@ -53,11 +55,22 @@ struct LuaApi {
 	 *	@param input_sender InputEvent sender that is bound
 	 *	@param action_sender ActionEvent sender that is bound
 	 *	@param path Reference to PathSystem that will be used
+	 *	@param navigation Reference to NavigationSystem providing flow
+	 *		fields
 	 */
 	LuaApi(core::LogContext& log, core::ObjectID actor, bool hostile,
 		rpg::Session const& session, ScriptManager const& script,
 		core::InputSender& input_sender, rpg::ActionSender& action_sender,
-		rpg::ItemSender& item_sender, PathSystem& path);
+		rpg::ItemSender& item_sender, PathSystem& path,
+		NavigationSystem& navigation);
+
+	/// Set the interval between two onUpdate calls
+	/**
+	 *	A zero interval resets the tick rate to the scheduler's default.
+	 *
+	 *	@param ms Interval in milliseconds
+	 */
+	void setTickRate(unsigned int ms);
 
 	/// Query whether object is hostile towards players
 	bool isHostile(core::ObjectID target) const;
@@ -237,6 +250,18 @@ struct LuaApi {
 	 */
 	void navigate(sf::Vector2u const & target);
 
+	/// Move the actor towards another object
+	/**
+	 *	This navigates using a flow field towards the target object,
+	 *	which is shared by all actors chasing the same target. So no
+	 *	path needs to be calculated per actor. If the actor is not
+	 *	covered by the field yet, regular pathfinding is used instead
+	 *	(see `navigate()`).
+	 *
+	 *	@param target Object ID of the target to chase
+	 */
+	void chase(core::ObjectID target);
+
 	/// Move the actor to the given direction
 	/// The actor is triggered to move into the given direction. Once a
 	/// navigation move has been triggered but not performed yet, each
@@ -477,6 +502,7 @@ struct Binder<game::LuaApi> {
 	static void execute(sol::state& lua) {
 		lua.new_usertype<game::LuaApi>("LuaApi",
 			"id", sol::readonly(&game::LuaApi::id),
+			"setTickRate", &game::LuaApi::setTickRate,
 			"isHostile", &game::LuaApi::isHostile,
 			"getMove", &game::LuaApi::getMove,
 			"hasPath", &game::LuaApi::hasPath,
@@ -502,6 +528,7 @@ struct Binder<game::LuaApi> {
 			"getPerks", &game::LuaApi::getPerks,
 			// actions
 			"navigate", &game::LuaApi::navigate,
+			"chase", &game::LuaApi::chase,
 			"move", &game::LuaApi::move,
 			"moveTowards", &game::LuaApi::moveTowards,
 			"look", &game::LuaApi::look,
@@ -39,6 +39,7 @@ class Mod {
 	
 	// all instances of lua scripts
 	std::list<AiScript> scripts;
+	std::uint32_t script_seed;
 	
 	template <typename T>
 	void preload(bool force);
@@ -146,9 +147,17 @@ class Mod {
 	template <typename T>
 	T& query(std::string const & resource_key, bool force=false);
 	
+	/// Create a new script instance
+	/// The instance's math.random is seeded with a stream derived from
+	/// the script seed and the number of instances created so far.
+	/// @param fname Script name without path and extension
 	AiScript& createScript(std::string const & fname);
 	std::list<AiScript>& getAllScripts();
 	
+	/// Set the seed for all script instances created afterwards
+	/// @param seed Seed to use
+	void setScriptSeed(std::uint32_t seed);
+	
 	template <typename T>
 	std::vector<T const *> getAll();
 	
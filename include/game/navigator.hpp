@@ -1,6 +1,8 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <unordered_map>
 #include <SFML/System/Vector2.hpp>
 
 #include <utils/algorithm.hpp>
@@ -26,6 +28,39 @@ namespace navigator_impl {
  */
 float distance(sf::Vector2u const& u, sf::Vector2u const& v);
 
+/// Query whether a tile can be entered by pathfinding
+/**
+ *	A tile can be entered if it is a floor tile without a teleport
+ *	trigger. Object collision is not considered here.
+ *
+ *	@param dungeon Dungeon to check
+ *	@param pos Tile position
+ *	@return true if the tile can be entered
+ */
+bool canTraverse(core::Dungeon const& dungeon, sf::Vector2u const& pos);
+
+/// Determine the portal between two neighbored rooms
+/**
+ *	Both positions refer to room centers in world coordinates, which
+ *	are connected by a straight corridor (see `DungeonGenerator`). The
+ *	portal is the corridor's midpoint, which is located at the border
+ *	of both cells.
+ *
+ *	@param u First room's center
+ *	@param v Second room's center
+ *	@return portal position in world coordinates
+ */
+sf::Vector2u getPortal(sf::Vector2u const& u, sf::Vector2u const& v);
+
+/// Maximum distance covered by a flow field
+extern float const FLOW_FIELD_RANGE;
+
+/// Number of nodes expanded by all flow fields per update
+extern std::size_t const FLOW_FIELD_BUDGET;
+
+/// Number of updates an unused flow field is kept
+extern std::size_t const FLOW_FIELD_TTL;
+
 }  // ::navigator_impl
 
 // ---------------------------------------------------------------------------
@@ -145,6 +180,91 @@ struct DungeonGraph {
 
 // ---------------------------------------------------------------------------
 
+/// Which tiles of a scene can be entered, indexed by `x + y * width`
+using WalkableMap = std::vector<std::uint8_t>;
+
+/// Immutable copy of a scene's navigation data
+/**
+ *	Holds which tiles can be entered and which objects occupy which
+ *	tiles. Occupants are sorted by their tile's index (`x + y * width`).
+ *	Only objects that may block an actor (i.e. objects with a collision
+ *	component that are no projectiles) are stored. The walkable tiles
+ *	only depend on the terrain, so all snapshots of a scene share them.
+ */
+struct NavigationSnapshot {
+	sf::Vector2u size;
+	std::shared_ptr<WalkableMap const> walkable;
+	std::vector<std::pair<std::size_t, core::ObjectID>> occupants;
+
+	/// Create an unoccupied snapshot of the given size
+	/**
+	 *	@pre walkable != nullptr
+	 *	@pre walkable->size() == size.x * size.y
+	 *	@param size Size of the grid
+	 *	@param walkable Shared pointer to the walkable tiles
+	 */
+	NavigationSnapshot(sf::Vector2u const& size,
+		std::shared_ptr<WalkableMap const> walkable);
+};
+
+// ---------------------------------------------------------------------------
+
+/// Used for narrow-phase pathfinding based on a snapshot
+/**
+ *	This scene behaves like the `NavigationScene`, but reads from a
+ *	`NavigationSnapshot`. Hence it can be used apart from the game's
+ *	thread. The actor is not considered to be blocked by itself or by
+ *	any object given as ignored.
+ */
+struct SnapshotScene {
+  private:
+	sf::Vector2u const size;
+	std::shared_ptr<NavigationSnapshot const> snapshot;
+
+  public:
+	/// Create scene for snapshots of the given size
+	/**
+	 *	@param size Size of the grid
+	 */
+	SnapshotScene(sf::Vector2u const& size);
+
+	/// Set the snapshot used for further queries
+	/**
+	 *	@pre snapshot == nullptr || snapshot->size == getSize()
+	 *	@param snapshot Shared pointer to the snapshot
+	 */
+	void setSnapshot(std::shared_ptr<NavigationSnapshot const> snapshot);
+
+	/// Calculate Euclidian-like distance using a discrete grid
+	/**
+	 *	See `NavigationScene::getDistance()`
+	 */
+	float getDistance(sf::Vector2u const& u, sf::Vector2u const& v) const;
+
+	/// Query layout size
+	/**
+	 *	@return layout size of the grid
+	 */
+	sf::Vector2u getSize() const;
+
+	/// Query accessable nodes
+	/**
+	 *	Queries accessable nodes for the given actor and the
+	 *	provided cell position.
+	 *
+	 *	@pre a snapshot was set
+	 *	@param actor Actor's object ID
+	 *	@param pos Current position
+	 *	@param ignore Vector of Entities to ignore
+	 *	@return array of neighbor positions
+	 */
+	std::vector<sf::Vector2u> getNeighbors(
+		core::ObjectID actor, sf::Vector2u const& pos,
+		std::vector<core::ObjectID> const& ignore={}) const;
+};
+
+// ---------------------------------------------------------------------------
+
 /// Used for narrow-phase pathfinding
 /**
  *	When using this for pathfinding, collision information are
@@ -154,6 +274,11 @@ struct NavigationScene {
   private:
 	core::CollisionManager const& collision;
 	core::Dungeon const& dungeon;
+	// walkable tiles, determined by the first snapshot
+	mutable std::shared_ptr<WalkableMap const> walkable;
+	// most recent snapshot and the dungeon's revision it was taken at
+	mutable std::shared_ptr<NavigationSnapshot const> snapshot;
+	mutable std::size_t snapshot_revision;
 
   public:
 	/// Create navigation scene for a specific dungeon
@@ -210,6 +335,281 @@ struct NavigationScene {
 	 *	@return true if possible
 	 */
 	bool canAccess(core::ObjectID actor, sf::Vector2u const& pos) const;
+
+	/// Query underlying dungeon
+	/**
+	 *	@return const reference to the dungeon
+	 */
+	core::Dungeon const& getDungeon() const;
+
+	/// Query underlying collision manager
+	/**
+	 *	@return const reference to the collision manager
+	 */
+	core::CollisionManager const& getCollision() const;
+
+	/// Query which tiles can be entered
+	/**
+	 *	The tiles are determined once and shared afterwards, because
+	 *	the terrain does not change while the scene is navigated (see
+	 *	the navigator's cached corridors).
+	 *
+	 *	@return shared pointer to the walkable tiles
+	 */
+	std::shared_ptr<WalkableMap const> getWalkable() const;
+
+	/// Create a snapshot of terrain and object occupancy
+	/**
+	 *	The snapshot is independent of the dungeon and the collision
+	 *	manager, so it can be read by other threads while both are
+	 *	modified. Only the occupancy is copied, the walkable tiles are
+	 *	shared with previous snapshots.
+	 *
+	 *	@return snapshot of the current scene
+	 */
+	NavigationSnapshot createSnapshot() const;
+
+	/// Query a shared snapshot of terrain and object occupancy
+	/**
+	 *	The most recent snapshot is reused until the dungeon's revision
+	 *	changes, i.e. until objects were spawned, vanished, moved between
+	 *	cells or acquired or released their collision component. So a
+	 *	scene is only scanned if its occupancy changed.
+	 *
+	 *	@return shared pointer to a snapshot of the current scene
+	 */
+	std::shared_ptr<NavigationSnapshot const> getSnapshot() const;
+};
+
+// ---------------------------------------------------------------------------
+
+/// Used for corridor-level pathfinding
+/**
+ *	Unlike the `NavigationScene`, only the dungeon's terrain is
+ *	considered. Hence paths found in this scene only depend on the
+ *	dungeon's layout and can be cached.
+ */
+struct TerrainScene {
+  private:
+	core::Dungeon const& dungeon;
+
+  public:
+	/// Create terrain scene for a specific dungeon
+	/**
+	 *	@param dungeon Const reference to dungeon
+	 */
+	TerrainScene(core::Dungeon const& dungeon);
+
+	/// Calculate Euclidian-like distance using a discrete grid
+	/**
+	 *	See `NavigationScene::getDistance()`
+	 */
+	float getDistance(sf::Vector2u const& u, sf::Vector2u const& v) const;
+
+	/// Query layout size
+	/**
+	 *	@return layout size of the grid
+	 */
+	sf::Vector2u getSize() const;
+
+	/// Query accessable nodes
+	/**
+	 *	Queries accessable nodes for the provided cell position. Both
+	 *	the actor and object collision are ignored here.
+	 *
+	 *	@param actor Actor's object ID (unused)
+	 *	@param pos Current position
+	 *	@param ignore Vector of Entities to ignore (unused)
+	 *	@return array of neighbor positions
+	 */
+	std::vector<sf::Vector2u> getNeighbors(
+		core::ObjectID actor, sf::Vector2u const& pos,
+		std::vector<core::ObjectID> const& ignore={}) const;
+};
+
+// ---------------------------------------------------------------------------
+
+/// Dijkstra-based flow field towards a single target
+/**
+ *	The field stores the distance towards the target and the direction
+ *	of the next step for each tile within a maximum range. So an
+ *	arbitrary number of actors can follow it towards the same target,
+ *	each step is a single lookup. Only the terrain is considered, object
+ *	collision needs to be resolved while following the field.
+ *
+ *	If the target changes its tile, a new field is calculated while the
+ *	previous one is still used. The calculation can be distributed to
+ *	multiple updates, and resetting it only touches tiles that were
+ *	reached by the previous calculation.
+ */
+class FlowField {
+  private:
+	using Direction = sf::Vector2<std::int8_t>;
+
+	TerrainScene const& terrain;
+	sf::Vector2u const size;
+	float const range;
+
+	// field used for queries
+	sf::Vector2u target;
+	std::vector<float> distances;
+	std::vector<Direction> directions;
+	bool valid;
+
+	// field under construction
+	sf::Vector2u next_target;
+	std::vector<float> next_distances;
+	std::vector<Direction> next_directions;
+	std::vector<bool> closed;
+	// tiles reached by the calculation and by the used field
+	std::vector<std::size_t> touched, covered;
+	utils::PriorityQueue<sf::Vector2u, float, utils::CoordHash> openlist;
+	bool pending;
+
+	std::size_t getIndex(sf::Vector2u const& pos) const;
+
+  public:
+	/// Create an empty flow field
+	/**
+	 *	@param terrain Const reference to the terrain scene
+	 *	@param range Maximum distance covered by the field
+	 */
+	FlowField(TerrainScene const& terrain, float range);
+
+	/// Set the field's target
+	/**
+	 *	If the target differs from the current one, a new calculation is
+	 *	started. Any pending calculation is discarded.
+	 *
+	 *	@param target Target tile position
+	 */
+	void setTarget(sf::Vector2u const& target);
+
+	/// Continue the pending calculation
+	/**
+	 *	Expands at most `budget` nodes. The number of expanded nodes is
+	 *	subtracted from the given budget. Once the calculation is
+	 *	finished, the new field replaces the previous one.
+	 *
+	 *	@param budget Number of nodes that may be expanded
+	 *	@return true if no calculation is pending
+	 */
+	bool resume(std::size_t& budget);
+
+	/// Query whether a calculation is pending
+	/**
+	 *	@return true if a calculation is pending
+	 */
+	bool isPending() const;
+
+	/// Query whether the field can be used
+	/**
+	 *	@return true if any calculation was finished
+	 */
+	bool isValid() const;
+
+	/// Query the used field's target
+	/**
+	 *	@pre isValid()
+	 *	@return target tile position
+	 */
+	sf::Vector2u getTarget() const;
+
+	/// Query distance towards the target
+	/**
+	 *	@param pos Tile position
+	 *	@return distance or infinity if the tile is not covered
+	 */
+	float getDistance(sf::Vector2u const& pos) const;
+
+	/// Query direction of the next step towards the target
+	/**
+	 *	@param pos Tile position
+	 *	@return direction or (0,0) if the tile is not covered or the
+	 *		target itself
+	 */
+	sf::Vector2i getDirection(sf::Vector2u const& pos) const;
+};
+
+// ---------------------------------------------------------------------------
+
+/// Describes how a path is calculated
+/**
+ *	A direct plan is calculated by a single narrowphase search. Otherwise
+ *	the narrowphase is used from source to the first portal and from the
+ *	last portal to the target; the corridor inbetween is already known.
+ *	Like all paths, the corridor runs backwards: it starts next to its
+ *	target and excludes the last portal, but ends with the first portal.
+ */
+struct NavigationPlan {
+	bool direct;
+	sf::Vector2u source, target, first_portal, last_portal;
+	std::size_t max_length, leg_length;
+	utils::Path corridor;
+
+	NavigationPlan();
+};
+
+// ---------------------------------------------------------------------------
+
+/// Resumable execution of a navigation plan
+/**
+ *	The narrowphase searches of the plan are performed using the given
+ *	pathfinder. If a leg of a hierarchical plan fails, the search falls
+ *	back to a direct search.
+ */
+template <typename Finder>
+class PlanSearch {
+  private:
+	enum class Phase { Done, Direct, LastLeg, FirstLeg };
+
+	Finder& finder;
+	Phase phase;
+	core::ObjectID actor;
+	NavigationPlan plan;
+	std::vector<core::ObjectID> ignore;
+	utils::Path path;
+
+	void startDirect();
+
+  public:
+	/// Create search based on a narrowphase pathfinder
+	/**
+	 *	@param finder Reference to the narrowphase pathfinder
+	 */
+	PlanSearch(Finder& finder);
+
+	/// Start a resumable search
+	/**
+	 *	Any previous search is discarded.
+	 *
+	 *	@param actor Actor's object ID
+	 *	@param plan Navigation plan to execute
+	 *	@param ignore Vector of Entities to ignore
+	 */
+	void start(core::ObjectID actor, NavigationPlan const& plan,
+		std::vector<core::ObjectID> const& ignore={});
+
+	/// Continue the current search
+	/**
+	 *	Expands at most `budget` narrowphase nodes. The number of expanded
+	 *	nodes is subtracted from the given budget.
+	 *
+	 *	@param budget Number of nodes that may be expanded
+	 *	@return true if the search is finished
+	 */
+	bool resume(std::size_t& budget);
+
+	/// Query the current search's path
+	/**
+	 *	Like the underlying pathfinders, the resulting path starts with
+	 *	the target position. If the search was not finished yet, a
+	 *	direct path leads to the closest position discovered so far, a
+	 *	hierarchical path only contains the source position.
+	 *
+	 *	@return path from source to target, or to the closest position
+	 */
+	utils::Path getPath() const;
 };
 
 // ---------------------------------------------------------------------------
@@ -218,38 +618,189 @@ struct NavigationScene {
 /**
  *	The navigator holds to pathfinder objects, based on the graph and
  *	the scene. Those are used for broadphase and narrowphase
- *	pathfinding.
+ *	pathfinding. The narrowphase uses a grid-indexed pathfinder, because
+ *	the scene's grid is large and searched frequently.
+ *
+ *	If a cell size is provided, the graph's nodes are expected at the
+ *	cells' centers (in world coordinates). Paths between different cells
+ *	are planned hierarchically: The broadphase determines the sequence of
+ *	rooms, the narrowphase is only used between the actor and the first
+ *	portal and between the last portal and the target. All legs between
+ *	two portals only depend on the terrain, so they are calculated once
+ *	and cached for the lifetime of the navigator.
  */
 struct Navigator {
 	DungeonGraph graph;
 	NavigationScene scene;
+	TerrainScene terrain;
+	unsigned int const cell_size;
 	utils::Pathfinder<DungeonGraph, core::ObjectID> broadphase;
-	utils::Pathfinder<NavigationScene, core::ObjectID> narrowphase;
+	utils::GridPathfinder<NavigationScene, core::ObjectID> narrowphase;
+	utils::GridPathfinder<TerrainScene, core::ObjectID> corridorphase;
+
+	// cached broadphase routes and corridor legs
+	std::unordered_map<std::uint64_t, utils::Path> routes, corridors;
 
 	/// Create navigator based on a specific grid and scene
 	/**
 	 *	@param grid Rvalue reference to dungeon graph
 	 *	@param scene Rvalue reference to navigation scene
+	 *	@param cell_size Size of a dungeon cell, 0 disables hierarchical
+	 *		pathfinding
+	 */
+	Navigator(DungeonGraph&& graph, NavigationScene&& scene,
+		unsigned int cell_size=0u);
+
+	/// Plan a path calculation
+	/**
+	 *	If source and target are located at different cells, which are
+	 *	connected via the dungeon graph, the path is planned
+	 *	hierarchically. Otherwise the narrowphase is used directly,
+	 *	limited by the given maximum length. Broadphase routes and
+	 *	corridor legs are determined here, because they are cached.
+	 *
+	 *	@param source Source position in world coordinates
+	 *	@param target Target position in world coordinates
+	 *	@param max_length Maximum length for a direct path
+	 *	@return navigation plan
+	 */
+	NavigationPlan plan(sf::Vector2u const& source,
+		sf::Vector2u const& target, std::size_t max_length);
+
+	/// Start a resumable path calculation
+	/**
+	 *	The calculation is planned and executed by the navigator's
+	 *	narrowphase. Any previous calculation is discarded.
+	 *
+	 *	@param actor Actor's object ID
+	 *	@param source Source position in world coordinates
+	 *	@param target Target position in world coordinates
+	 *	@param max_length Maximum length for a direct path
+	 *	@param ignore Vector of Entities to ignore
+	 */
+	void start(core::ObjectID actor, sf::Vector2u const& source,
+		sf::Vector2u const& target, std::size_t max_length,
+		std::vector<core::ObjectID> const& ignore={});
+
+	/// Continue the current path calculation
+	/**
+	 *	See `PlanSearch::resume()`
+	 */
+	bool resume(std::size_t& budget);
+
+	/// Query the current calculation's path
+	/**
+	 *	See `PlanSearch::getPath()`
+	 */
+	utils::Path getPath() const;
+
+	/// Calculate a path
+	/**
+	 *	This starts a calculation and resumes it until it is finished.
+	 *
+	 *	@param actor Actor's object ID
+	 *	@param source Source position in world coordinates
+	 *	@param target Target position in world coordinates
+	 *	@param max_length Maximum length for a direct path
+	 *	@return path from source to target, or to the closest position
 	 */
-	Navigator(DungeonGraph&& graph, NavigationScene&& scene);
+	utils::Path operator()(core::ObjectID actor, sf::Vector2u const& source,
+		sf::Vector2u const& target, std::size_t max_length);
+
+  private:
+	// current calculation
+	PlanSearch<utils::GridPathfinder<NavigationScene, core::ObjectID>> search;
+
+	sf::Vector2u getCenter(sf::Vector2u const& pos) const;
+	std::uint64_t getKey(sf::Vector2u const& u, sf::Vector2u const& v) const;
+	utils::Path const& getRoute(sf::Vector2u const& src, sf::Vector2u const& dst);
+	utils::Path const& getCorridor(sf::Vector2u const& src, sf::Vector2u const& dst);
 };
 
 // ---------------------------------------------------------------------------
 
+namespace navigator_impl {
+
+/// Flow field that is shared by all actors following the same target
+struct FlowEntry {
+	std::shared_ptr<FlowField> field;
+	std::size_t idle;
+
+	FlowEntry(TerrainScene const& terrain);
+};
+
+}  // ::navigator_impl
+
+// ---------------------------------------------------------------------------
+
 class NavigationSystem {
   private:
 	std::vector<std::unique_ptr<Navigator>> navis;
+	// flow fields per scene and target object
+	std::vector<std::unordered_map<core::ObjectID, navigator_impl::FlowEntry>> fields;
 
   public:
 	NavigationSystem();
 
+	/// Build a navigator without registering it
+	/**
+	 *	This does not modify any navigation system, so navigators of
+	 *	multiple dungeons can be built in parallel.
+	 *
+	 *	@param collision Collision components to consider
+	 *	@param dungeon Dungeon to navigate through
+	 *	@param builder Builder that describes the dungeon's paths
+	 *	@param cell_size Size of a dungeon cell, 0 disables hierarchical
+	 *		pathfinding
+	 *	@return navigator
+	 */
+	static std::unique_ptr<Navigator> build(
+		core::CollisionManager const& collision, core::Dungeon const& dungeon,
+		DungeonBuilder const& builder, unsigned int cell_size=0u);
+
+	/// Register a navigator for the given scene
+	/**
+	 *	@pre id is the next scene's ID
+	 *	@param id Scene ID of the dungeon
+	 *	@param navigator Previously built navigator
+	 *	@return reference to the registered navigator
+	 */
+	Navigator& add(utils::SceneID id, std::unique_ptr<Navigator> navigator);
+
 	Navigator& create(utils::SceneID id,
 		core::CollisionManager const& collision, core::Dungeon const& dungeon,
-		DungeonBuilder const& builder);
+		DungeonBuilder const& builder, unsigned int cell_size=0u);
 
 	Navigator& operator[](utils::SceneID id);
+
+	/// Query flow field towards a target object
+	/**
+	 *	The field is created on demand and shared by all actors, which
+	 *	follow the same target. If the target's position changed, the
+	 *	field is recalculated by further updates.
+	 *
+	 *	@param id Scene ID of the dungeon
+	 *	@param target Target's object ID
+	 *	@param pos Target's current tile position
+	 *	@return shared pointer to the flow field
+	 */
+	std::shared_ptr<FlowField const> getFlowField(utils::SceneID id,
+		core::ObjectID target, sf::Vector2u const& pos);
+
+	/// Update flow fields
+	/**
+	 *	Pending calculations are continued, using at most `budget` node
+	 *	expansions in total. Fields that were not queried for
+	 *	`FLOW_FIELD_TTL` updates are dropped.
+	 *
+	 *	@param budget Number of nodes that may be expanded
+	 */
+	void update(std::size_t budget);
 	
 	void clear();
 };
 
 }  // ::rage
+
+// include implementation details
+#include <game/navigator.inl>
@@ -0,0 +1,98 @@
+#include <iterator>
+
+namespace game {
+
+template <typename Finder>
+PlanSearch<Finder>::PlanSearch(Finder& finder)
+	: finder{finder}
+	, phase{Phase::Done}
+	, actor{0u}
+	, plan{}
+	, ignore{}
+	, path{} {
+}
+
+template <typename Finder>
+void PlanSearch<Finder>::startDirect() {
+	finder.start(actor, plan.source, plan.target, plan.max_length, ignore);
+	phase = Phase::Direct;
+}
+
+template <typename Finder>
+void PlanSearch<Finder>::start(core::ObjectID actor,
+	NavigationPlan const& plan, std::vector<core::ObjectID> const& ignore) {
+	this->actor = actor;
+	this->plan = plan;
+	this->ignore = ignore;
+	path.clear();
+	
+	if (plan.direct) {
+		startDirect();
+		return;
+	}
+	// last leg: consider objects, target might be occupied by an object
+	finder.start(actor, plan.last_portal, plan.target, plan.leg_length,
+		ignore);
+	phase = Phase::LastLeg;
+}
+
+template <typename Finder>
+bool PlanSearch<Finder>::resume(std::size_t& budget) {
+	while (phase != Phase::Done && budget > 0u) {
+		if (!finder.resume(budget)) {
+			// budget exceeded
+			break;
+		}
+		auto leg = finder.getPath();
+		switch (phase) {
+			case Phase::Direct:
+				path = std::move(leg);
+				phase = Phase::Done;
+				break;
+				
+			case Phase::LastLeg:
+				// note: legs start with their target
+				if (leg.empty() || leg.front() != plan.target) {
+					startDirect();
+					break;
+				}
+				path = std::move(leg);
+				path.insert(path.end(), plan.corridor.begin(),
+					plan.corridor.end());
+				// first leg: consider objects
+				finder.start(actor, plan.source, plan.first_portal,
+					plan.leg_length, ignore);
+				phase = Phase::FirstLeg;
+				break;
+				
+			case Phase::FirstLeg:
+				if (leg.empty() || leg.front() != plan.first_portal) {
+					startDirect();
+					break;
+				}
+				path.insert(path.end(), std::next(leg.begin()), leg.end());
+				phase = Phase::Done;
+				break;
+				
+			case Phase::Done:
+				break;
+		}
+	}
+	return phase == Phase::Done;
+}
+
+template <typename Finder>
+utils::Path PlanSearch<Finder>::getPath() const {
+	switch (phase) {
+		case Phase::Done:
+			return path;
+			
+		case Phase::Direct:
+			return finder.getPath();
+			
+		default:
+			return {plan.source};
+	}
+}
+
+}  // ::game
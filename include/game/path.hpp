@@ -1,6 +1,11 @@
 #pragma once
 #include <list>
+#include <deque>
+#include <memory>
 #include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <SFML/System/Time.hpp>
 
 #include <utils/pathfinder.hpp>
@@ -14,16 +19,100 @@ namespace path_impl {
 /// Maximum length of a path used within pathfinding
 extern std::size_t const MAX_PATH_LENGTH;
 
+/// Number of nodes expanded between two frame time checks
+extern std::size_t const EXPANSION_SLICE;
+
+/// Maximum number of nodes expanded for a single request
+extern std::size_t const MAX_EXPANSIONS;
+
+/// Maximum number of worker threads used for pathfinding
+extern std::size_t const MAX_WORKERS;
+
+/// Maximum number of suspended searches per scene without workers
+extern std::size_t const MAX_SEARCHES;
+
+/// Determine default number of worker threads
+/**
+ *	One core is kept for the game's thread, the others are used up to
+ *	`MAX_WORKERS`.
+ *
+ *	@return number of worker threads
+ */
+std::size_t getDefaultWorkers();
+
+/// Determine maximum length of a direct path
+/**
+ *	@param source Source position in world scale
+ *	@param target Target position in world scale
+ *	@return maximum path length
+ */
+std::size_t getMaxLength(sf::Vector2u const& source,
+	sf::Vector2u const& target);
+
+/// Resumable search of a request that is calculated without workers
+struct Search {
+	using Finder = utils::GridPathfinder<NavigationScene, core::ObjectID>;
+
+	Finder narrowphase;
+	PlanSearch<Finder> search;
+
+	Search(NavigationScene const& scene);
+};
+
+/// Searches of a single scene, which are reused by its requests
+struct SearchPool {
+	std::vector<std::unique_ptr<Search>> idle;
+	std::size_t num_active;
+
+	SearchPool();
+};
+
 /// Combines several data for a pathfinding request
 struct Request {
 	core::ObjectID actor;
 	utils::SceneID scene;
 	sf::Vector2u source, target;
 	std::promise<Path> path;
+	std::unique_ptr<Search> search; // set once the request was started
+	std::size_t expanded;
 
 	Request();
 };
 
+/// Pathfinding job that is handled by a worker thread
+/**
+ *	The job only refers to immutable data, so it is independent of the
+ *	game's state while it is calculated.
+ */
+struct Job {
+	core::ObjectID actor;
+	utils::SceneID scene;
+	std::shared_ptr<NavigationSnapshot const> snapshot;
+	NavigationPlan plan;
+	std::vector<core::ObjectID> ignore;
+	std::promise<Path> path;
+
+	Job();
+};
+
+/// Pathfinding objects owned by a worker thread for a single scene
+struct Worker {
+	using Finder = utils::GridPathfinder<SnapshotScene, core::ObjectID>;
+
+	SnapshotScene scene;
+	Finder narrowphase;
+	PlanSearch<Finder> search;
+
+	Worker(sf::Vector2u const& size);
+};
+
+/// Statistics of the most recent calculation
+struct Stats {
+	std::size_t completed, pending, expanded;
+
+	Stats();
+};
+
 }  // ::path_impl
 
 // ---------------------------------------------------------------------------
@@ -33,7 +122,24 @@ struct Request {
  *	It calculates some pathfinding steps until the maximum frame time
  *	was exceeded or all calculations are done. So the path calculation
  *	itself does not block until its done. Furthermore the pathfinding
- *	can be distributed to multiple frames.
+ *	can be distributed to multiple frames: The current request's search
+ *	is suspended and resumed within the next frame.
+ *
+ *	Requests are handled round-robin: Each request expands a slice of
+ *	`EXPANSION_SLICE` nodes and is moved to the end of the queue if it
+ *	is not finished yet. So a long search does not delay the others'
+ *	requests. Each request owns its search state while it is suspended,
+ *	these states are reused per scene and up to `MAX_SEARCHES` of them
+ *	exist per scene. Each actor has at most one request waiting,
+ *	rescheduling replaces it without losing its position. A single
+ *	request cannot expand more than `MAX_EXPANSIONS` nodes.
+ *
+ *	If worker threads are started, the requests are only planned by
+ *	`calculate()`; the narrowphase searches are performed by the
+ *	workers. Each worker reads a snapshot of the scene, which was
+ *	taken while planning and is reused until the scene's occupancy
+ *	changes. So the game can continue while the workers are searching,
+ *	and a finished path is delivered via its future.
  */
 class PathSystem {
 
@@ -41,13 +147,51 @@ class PathSystem {
 	core::LogContext& log;
 	// Registered scene navigators
 	std::vector<Navigator*> scenes;
+	// Searches of each scene for calculations without workers
+	std::vector<path_impl::SearchPool> pools;
 	// Pending requests
 	std::list<path_impl::Request> requests;
+	// Statistics of the most recent calculation
+	path_impl::Stats stats;
+
+	// Worker threads and the jobs they share
+	std::vector<std::thread> workers;
+	std::deque<path_impl::Job> jobs;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool running;
+	// Workload of the workers since the last calculation
+	std::size_t busy, completed, expanded;
+
+	void release(path_impl::Request& request);
+	std::size_t calculateSync(sf::Time const& max_elapse);
+	std::size_t dispatch();
+	void work();
 
   public:
 	/// Create system with maximum frame time
 	PathSystem(core::LogContext& log);
 
+	/// Stop workers on destruction
+	virtual ~PathSystem();
+
+	/// Start worker threads
+	/**
+	 *	Without any workers, all requests are calculated by
+	 *	`calculate()` itself.
+	 *
+	 *	@pre no workers are running
+	 *	@param num_workers Number of worker threads
+	 */
+	void start(std::size_t num_workers);
+
+	/// Stop all worker threads
+	/**
+	 *	Jobs that were not calculated yet are populated with their
+	 *	source position.
+	 */
+	void stop();
+
 	/// Register a scene's navigator
 	/**
 	 *	Each scene needs to be registered using its ID and the
@@ -81,12 +225,21 @@ class PathSystem {
 	/**
 	 *	Will calculate as many calculations as possible until
 	 *	either the maximum frame time exceeded or all requests
-	 *	are handled.
+	 *	are handled. At least one slice is calculated, even if the
+	 *	maximum frame time is not positive. If workers are running, all requests are
+	 *	passed to them instead and the number of calculations, which
+	 *	were finished by the workers since the last call, is returned.
 	 *
 	 *	@param max_elapse Maximum frame time to exceed
 	 *	@return number of finished calculations
 	 */
 	std::size_t calculate(sf::Time const& max_elapse);
+
+	/// Query statistics of the most recent calculation
+	/**
+	 *	@return const reference to the statistics
+	 */
+	path_impl::Stats const & getStats() const;
 };
 
 }  // ::rage
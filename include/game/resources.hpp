@@ -26,6 +26,7 @@ namespace game {
 struct GeneratorSettings : rpg::BaseResource {
 	unsigned int cell_size;
 	float room_density, deadend_density, ambience_density, redundant_paths_ratio;
+	std::uint32_t seed; // 0 picks a random seed
 
 	/// Default settings
 	GeneratorSettings();
@@ -63,6 +64,7 @@ struct BotTemplate : rpg::BaseResource {
 	std::vector<ItemNode> items;
 	std::vector<PerkNode> perks;
 	rpg::EntityTemplate const* entity;
+	unsigned int tick_rate; // ms between AI updates, 0 for default
 
 	BotTemplate();
 
@@ -135,8 +137,35 @@ bool operator!=(RoomTemplate const & lhs, RoomTemplate const & rhs);
 // ---------------------------------------------------------------------------
 
 /// Contains ai-specific scripting data
+/**
+ *	Handles to all known callbacks are resolved whenever a script is
+ *	loaded. Calling a callback via its handle avoids looking up the
+ *	function by name. Callbacks, which are not defined by the script, are
+ *	skipped without accessing Lua at all.
+ */
 struct AiScript : utils::Script {
+	utils::EnumMap<AiCallback, sol::function> callbacks;
+
 	AiScript();
+
+	bool loadFromMemory(std::string const& string);
+	bool loadFromFile(std::string const& fname);
+
+	/// Resolve the handles to all known callbacks
+	void refresh();
+
+	/// Query whether the script defines the given callback
+	bool has(AiCallback callback) const;
+
+	using utils::Script::operator();
+
+	/// Call the given callback if defined by the script
+	/**
+	 *	@param callback Callback to call
+	 *	@param args Arguments to pass to the callback
+	 */
+	template <typename... Args>
+	void operator()(AiCallback callback, Args&&... args) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -211,3 +240,6 @@ using ResourceCache = utils::MultiResourceCache<
 	RoomTemplate>;
 
 }  // ::rage
+
+// include implementation details
+#include <game/resources.inl>
@@ -0,0 +1,19 @@
+#include <iostream>
+
+namespace game {
+
+template <typename... Args>
+void AiScript::operator()(AiCallback callback, Args&&... args) const {
+	auto const& func = callbacks[callback];
+	if (!func.valid()) {
+		// not defined by the script
+		return;
+	}
+	try {
+		func(std::forward<Args>(args)...);
+	} catch (sol::error const& e) {
+		std::cerr << "Script error: " << e.what() << "\n";
+	}
+}
+
+}  // ::game
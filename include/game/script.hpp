@@ -10,11 +10,24 @@ namespace script_impl {
 /// Prevent scripts from being update-notified too often; delay in ms
 extern unsigned int const UPDATE_DELAY;
 
+/// Number of buckets to spread the updates across UPDATE_DELAY
+extern std::size_t const NUM_BUCKETS;
+
+/// Maximum time per frame spent on onUpdate calls; in ms
+extern unsigned int const UPDATE_BUDGET;
+
+/// Distance to the closest player, which slows down a script's updates
+extern float const FAR_DISTANCE;
+
+/// Factor to slow down the updates of far away scripts
+extern unsigned int const FAR_TICK_FACTOR;
+
 /// Context of the scripting system
 struct Context {
 	core::LogContext& log;
 	ScriptManager& script_manager;
-	sf::Time update_delay;
+	sf::Time time, budget;
+	std::size_t cursor;
 
 	Context(core::LogContext& log, ScriptManager& script_manager);
 };
@@ -150,15 +163,50 @@ void onUpdate(Context& context, ScriptData& actor);
 
 // ---------------------------------------------------------------------------
 
-/// Try to update the context
+/// Determine the initial delay of a script's first update
+/**
+ *	Scripts are spread into `NUM_BUCKETS` buckets by their object ID.
+ *	Each bucket is delayed by another fraction of `UPDATE_DELAY`, so
+ *	scripts with the same tick rate are not updated in the same frame.
+ *
+ *	@param id Object ID of the actor
+ *	@return delay of the first update
+ */
+sf::Time getPhase(core::ObjectID id);
+
+/// Determine whether the actor is far away from all players
+/**
+ *	An actor is far away if no player is located within `FAR_DISTANCE`
+ *	at the same scene. Without any players, no actor is far away.
+ *
+ *	@param data Actor's ScriptData
+ *	@return true if the actor is far away
+ */
+bool isFar(ScriptData const& data);
+
+/// Determine the interval between two updates of the given actor
+/**
+ *	The tick rate is given by the script or its bot template. It is
+ *	`UPDATE_DELAY` by default. Actors that are far away from all players
+ *	are updated `FAR_TICK_FACTOR` times less often.
+ *
+ *	@param data Actor's ScriptData
+ *	@return interval between two updates
+ */
+sf::Time getTickRate(ScriptData const& data);
+
+/// Update all scripts, which are due
 /**
- *	Will update the given context. Once enough time passed by, all
- *	scripts are updated.
+ *	Each script is updated once its tick rate passed by. Once the
+ *	context's budget is exceeded, all further updates are postponed to
+ *	the next frame. Those scripts are updated first next time. At least
+ *	one script is updated per call to guarantee progress.
  *
  *	@param context Reference to the scripting context
  *	@param elapsed Time since last frame
+ *	@return number of updated scripts
  */
-void update(Context& context, sf::Time const& elapsed);
+std::size_t update(Context& context, sf::Time const& elapsed);
 
 } // ::script_impl
 
@@ -5,6 +5,7 @@
 #include <core/event.hpp>
 #include <game/common.hpp>
 #include <game/event.hpp>
+#include <game/navigator.hpp>
 #include <game/path.hpp>
 
 namespace game {
@@ -19,7 +20,7 @@ namespace game {
  */
 class PathTracer {
   private:
-	enum { Idle, Trigger, Wait, Trace } state;
+	enum { Idle, Trigger, Wait, Trace, Follow } state;
 
 	core::LogContext& log;
 	PathSystem& pathfinder;
@@ -29,9 +30,11 @@ class PathTracer {
 
 	std::future<Path> request;
 	std::vector<sf::Vector2u> path;
+	std::shared_ptr<FlowField const> field;
 	sf::Vector2u current, target;
 
 	bool requestIsReady() const;
+	void step(sf::Vector2i const& dir);
 
   public:
 	/// Create a new path tracer
@@ -65,6 +68,17 @@ class PathTracer {
 	 */
 	void pathfind(sf::Vector2u const& target);
 
+	/// Follow a flow field
+	/**
+	 *	The actor is moved along the given field, starting at its
+	 *	current position. Each tile reached triggers the next step
+	 *	without further pathfinding. The tracer stops at the field's
+	 *	target or at any tile, which is not covered by the field.
+	 *
+	 *	@param field Shared pointer to the flow field
+	 */
+	void follow(std::shared_ptr<FlowField const> field);
+
 	/// Handle incomming movement event
 	/**
 	 *	This is used to detect whether the object is ready for the
@@ -97,6 +111,13 @@ class PathTracer {
 	 */
 	bool isRunning() const;
 
+	/// Determine whether the tracer follows a flow field
+	/**
+	 *	@param field Pointer to the flow field or nullptr for any field
+	 *	@return true if the (given) field is followed
+	 */
+	bool isFollowing(FlowField const* field=nullptr) const;
+
 	/// Return actual path
 	std::vector<sf::Vector2u> const& getPath() const;
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include <utils/random.hpp>
 #include <rpg/entity.hpp>
 #include <rpg/event.hpp>
 
@@ -28,6 +29,7 @@ struct Context {
 	InteractManager const& interact;
 	float const variance;
 	std::vector<core::ObjectID> projectiles;
+	utils::RandomStream rng;
 
 	Context(core::LogContext& log, StatsSender& stats_sender,
 		ExpSender& exp_sender, EffectSender& effect_sender,
@@ -168,12 +170,13 @@ std::vector<EffectEmitter> getEffectEmitters(CombatMetaData const& data);
 /// Randomize an integer value
 /**
  *	This applies in-place randomization to a given integer. The resulting
- *	value is varied by variance specified in the context.
+ *	value is varied by variance specified in the context, using the
+ *	context's random stream.
  *
  *	@param context Combat context to use
  *	@param value Will be randomized in-place
  */
-void randomize(Context const& context, int& value);
+void randomize(Context& context, int& value);
 
 /// Handle the given combat
 /**
@@ -232,6 +235,12 @@ class CombatSystem
 	void update(sf::Time const& elapsed);
 	
 	void clear();
+
+	/// Restart the random stream used for damage variance and effects
+	/**
+	 *	@param seed Seed to use
+	 */
+	void setSeed(std::uint32_t seed);
 };
 
 }  // ::game
@@ -1,5 +1,6 @@
 #pragma once
 #include <utils/input_mapper.hpp>
+#include <utils/random.hpp>
 #include <core/dungeon.hpp>
 #include <rpg/entity.hpp>
 #include <rpg/event.hpp>
@@ -25,6 +26,7 @@ struct Context {
 	core::FocusManager const& focus;
 
 	std::vector<PlayerAction> gameplay_actions;
+	utils::RandomStream rng; // alternative movement directions
 
 	Context(core::LogContext& log, core::InputSender& input_sender,
 		ActionSender& action_sender, core::DungeonSystem const& dungeon,
@@ -86,13 +88,14 @@ void updateInput(Context& context, InputData& data, sf::Time const& elapsed);
  *	This modifies the movement vector if necessary and possible by rotating
  *	it either clockwise or counterclockwise using 45 degree. If no change is
  *	necessary, the vector is not changed. Only tile collision is checked here.
+ *	The direction that is tried first is drawn from the context's stream.
  *
  *	@param context Input context to deal with
  *	@param data InputData to fix for
  *	@param vector Movement vector to modify.
  */
 void adjustMovement(
-	Context const& context, InputData const& data, sf::Vector2i& vector);
+	Context& context, InputData const& data, sf::Vector2i& vector);
 
 /// Handle actor's death
 /**
@@ -142,6 +145,12 @@ class InputSystem
 		core::MovementManager const& movement, core::FocusManager const& focus);
 
 	void reset();
+
+	/// Restart the random stream used for alternative movement directions
+	/**
+	 *	@param seed Seed to use
+	 */
+	void setSeed(std::uint32_t seed);
 	
 	void handle(DeathEvent const& event);
 	void handle(SpawnEvent const& event);
@@ -1,6 +1,7 @@
 #pragma once
 #include <functional>
 
+#include <utils/random.hpp>
 #include <rpg/entity.hpp>
 #include <rpg/event.hpp>
 
@@ -229,9 +230,10 @@ bool hasItem(
  *	@param loot_ratio specifies how many items of the total inventory will be
  *dropped
  *	@param pred Dropping predicated used to specify the item's worth
+ *	@param rng Random stream used to distribute the loot
  */
 void dropItems(ItemData& actor, InteractData& corpse, std::size_t num_players,
-	float loot_ratio, drop::Predicate pred);
+	float loot_ratio, drop::Predicate pred, utils::RandomStream& rng);
 
 // ---------------------------------------------------------------------------
 
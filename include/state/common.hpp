@@ -19,6 +19,7 @@ namespace state {
 
 extern unsigned int const MIN_SCREEN_WIDTH;
 extern unsigned int const MIN_SCREEN_HEIGHT;
+extern std::size_t const MAX_TICKS_PER_FRAME;
 
 struct Context;
 struct GameContext;
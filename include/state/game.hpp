@@ -1,12 +1,14 @@
 #pragma once
 #include <ui/systemgraph.hpp>
+#include <utils/fixed_timestep.hpp>
+#include <utils/random.hpp>
 
 #include <rpg/event.hpp>
 #include <state/common.hpp>
 
 namespace state {
 
-void searchPosition(std::vector<sf::Vector2u> const & tiles, sf::Vector2u& pos, core::Dungeon const & dungeon, unsigned int max_step=20u);
+void searchPosition(std::vector<sf::Vector2u> const & tiles, sf::Vector2u& pos, core::Dungeon const & dungeon, utils::RandomStream& rng, unsigned int max_step=20u);
 
 // --------------------------------------------------------------------
 
@@ -24,6 +26,7 @@ class GameState
 	
   public:
 	mutable ui::SystemGraph time_monitor;
+	utils::FixedTimestep simulation;
 	
 	GameState(App& app);
 	
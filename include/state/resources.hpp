@@ -16,6 +16,29 @@ SET_ENUM_LIMITS(state::Difficulty::Easy, state::Difficulty::Hard)
 
 namespace state {
 
+/// Lowest simulation tick rate
+/**
+ *	A tick must not exceed `core::MAX_FRAMETIME_MS`, because the maximum
+ *	movement speed is based on it.
+ *
+ *	@return minimum number of ticks per second
+ */
+unsigned int getMinTickRate();
+
+/// Interval between two bullet collision checks
+/**
+ *	Bullets are swept along their path since the last check, so they can
+ *	be checked less often than the simulation ticks without missing hits.
+ *	The interval is never shorter than a single tick.
+ *
+ *	@pre tick_rate > 0
+ *	@param collision_rate Bullet checks per second
+ *	@param tick_rate Simulation ticks per second
+ *	@return interval between two checks
+ */
+sf::Time getCollisionInterval(unsigned int collision_rate,
+	unsigned int tick_rate);
+
 struct FontSettings
 	: rpg::BaseResource {
 	std::string font;
@@ -42,7 +65,9 @@ struct GlobalSettings
 		ui_menu_sfx_alternate, ui_menu_sfx_navigate, ui_menu_sfx_type,
 		ui_menu_sfx_undo;
 	std::vector<sf::Color> player_colors;
-	std::size_t max_num_objects;
+	std::size_t max_num_objects, path_workers;
+	unsigned int tick_rate; // simulation ticks per second
+	unsigned int collision_rate; // bullet checks per second
 	unsigned int max_num_players, framelimit,
 		audio_poolsize, ui_widget_width, max_input_len;
 	float horizontal_padding, vertical_padding, hud_padding, hud_margin, zoom;
@@ -8,8 +8,8 @@
 
 namespace tool {
 
-template <typename T>
-bool createInspector(InspectorMap& map, core::ComponentManager<T>& system, core::LogContext& log, engine::Engine& engine, core::ObjectID id);
+template <typename Manager>
+bool createInspector(InspectorMap& map, Manager& system, core::LogContext& log, engine::Engine& engine, core::ObjectID id);
 
 // --------------------------------------------------------------------
 
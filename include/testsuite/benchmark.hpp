@@ -0,0 +1,81 @@
+#pragma once
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <SFML/System/Clock.hpp>
+
+namespace benchmark {
+
+/// Timing results of a measured function
+struct Result {
+	std::size_t n;
+	sf::Time total, min, max;
+
+	Result()
+		: n{0u}
+		, total{sf::Time::Zero}
+		, min{sf::Time::Zero}
+		, max{sf::Time::Zero} {
+	}
+
+	/// Average time per call
+	sf::Time avg() const {
+		if (n == 0u) {
+			return sf::Time::Zero;
+		}
+		return total / static_cast<sf::Int64>(n);
+	}
+};
+
+/// Measure the given function
+/**
+ *	The function is called `n` times with the current iteration index.
+ *	Each call is measured on its own.
+ *
+ *	@param n Number of calls
+ *	@param func Function to measure
+ *	@return timing results
+ */
+template <typename Func>
+Result measure(std::size_t n, Func func) {
+	Result result;
+	result.n = n;
+	sf::Clock clock;
+	for (auto i = 0u; i < n; ++i) {
+		clock.restart();
+		func(i);
+		auto delta = clock.getElapsedTime();
+		result.total += delta;
+		result.max = std::max(result.max, delta);
+		result.min = (i == 0u) ? delta : std::min(result.min, delta);
+	}
+	return result;
+}
+
+/// Print the timing results using microseconds
+/**
+ *	@param name Name of the measured function
+ *	@param result Timing results
+ */
+inline void print(std::string const & name, Result const & result) {
+	std::cout << "[Benchmark] " << name << ": " << result.n
+		<< " calls within " << result.total.asMicroseconds() << "us (min: "
+		<< result.min.asMicroseconds() << "us, max: "
+		<< result.max.asMicroseconds() << "us, avg: "
+		<< result.avg().asMicroseconds() << "us)\n";
+}
+
+/// Print the speedup of a result compared to a reference result
+/**
+ *	@param name Name of the comparison
+ *	@param reference Timing results to compare against
+ *	@param result Timing results to compare
+ */
+inline void compare(std::string const & name, Result const & reference,
+	Result const & result) {
+	auto ref = static_cast<double>(reference.total.asMicroseconds());
+	auto cur = static_cast<double>(std::max<sf::Int64>(result.total.asMicroseconds(), 1));
+	std::cout << "[Benchmark] " << name << ": speedup " << (ref / cur) << "x\n";
+}
+
+}  // ::benchmark
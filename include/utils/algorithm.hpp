@@ -6,6 +6,8 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
+#include <utils/random.hpp>
+
 namespace utils {
 
 template <typename T, typename... Types>
@@ -37,8 +39,9 @@ sf::Rect<T> enlarge(sf::Rect<T> const & lhs, sf::Rect<T> const & rhs);
 template <typename C>
 void reverse(C& container);
 
+/// Shuffle using the given random stream
 template <typename T>
-void shuffle(std::vector<T>& container);
+void shuffle(std::vector<T>& container, RandomStream& rng);
 
 // ---------------------------------------------------------------------------
 
@@ -85,11 +88,12 @@ void split(std::string const & str, std::string const & token, Handle func);
 
 // ---------------------------------------------------------------------------
 
+/// Pick an element using the given random stream
 template <typename T>
-T& randomAt(std::vector<T>& container);
+T& randomAt(std::vector<T>& container, RandomStream& rng);
 
 template <typename T>
-T const & randomAt(std::vector<T> const & container);
+T const & randomAt(std::vector<T> const & container, RandomStream& rng);
 
 }  // ::utils
 
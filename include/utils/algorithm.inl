@@ -30,11 +30,11 @@ void reverse(C& container) {
 }
 
 template <typename T>
-void shuffle(std::vector<T>& container) {
-	auto n = container.size();
+void shuffle(std::vector<T>& container, RandomStream& rng) {
+	auto n = static_cast<unsigned int>(container.size());
 	for (auto k = 0u; k < n; ++k) {
-		auto i = thor::random(0u, n - 1u);
-		auto j = thor::random(0u, n - 1u);
+		auto i = rng(0u, n - 1u);
+		auto j = rng(0u, n - 1u);
 		std::swap(container[i], container[j]);
 	}
 }
@@ -134,13 +134,13 @@ void split(std::string const & str, std::string const & token, Handle func) {
 // --------------------------------------------------------------------
 
 template <typename T>
-T& randomAt(std::vector<T>& container) {
-	return container[thor::random(0u, container.size()-1u)];
+T& randomAt(std::vector<T>& container, RandomStream& rng) {
+	return container[rng(0u, static_cast<unsigned int>(container.size()-1u))];
 }
 
 template <typename T>
-T const & randomAt(std::vector<T> const & container) {
-	return container[thor::random(0u, container.size()-1u)];
+T const & randomAt(std::vector<T> const & container, RandomStream& rng) {
+	return container[rng(0u, static_cast<unsigned int>(container.size()-1u))];
 }
 
 }  // ::utils
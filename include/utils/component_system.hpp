@@ -41,10 +41,33 @@ class ComponentSystem : public BaseSystem<Id> {
 	std::size_t const n;
 	container data;
 	std::vector<std::size_t> lookup;
+	std::size_t num_notified;  // components passed to onSpawned()
 
   protected:
 	std::vector<Id> unused;
 
+	/// Called for a recently acquired object by `notifySpawned()`
+	/**
+	 * The default implementation does nothing.
+	 * @param data of the acquired object
+	 */
+	virtual void onSpawned(T& data);
+
+	/// Called for a released object by `cleanup()` before it is removed
+	/**
+	 * The default implementation does nothing.
+	 * @param data of the released object
+	 */
+	virtual void onReleased(T const& data);
+
+	/// Pass all objects acquired since the last call to `onSpawned()`
+	/**
+	 * Acquired objects are appended, so only the objects behind the already
+	 * notified ones are passed. If `cleanup()` moves a pending object into
+	 * the notified range, it is passed right away.
+	 */
+	void notifySpawned();
+
   public:
 	ComponentSystem(std::size_t n=100u);
 	virtual ~ComponentSystem();
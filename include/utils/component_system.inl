@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 
@@ -55,6 +56,7 @@ ComponentSystem<Id, T>::ComponentSystem(std::size_t n)
 	, n{n}
 	, data{}
 	, lookup{}
+	, num_notified{0u}
 	, unused{} {
 	data.reserve(n + 1);
 	data.emplace_back();
@@ -93,6 +95,21 @@ bool ComponentSystem<Id, T>::has(Id id) const {
 	return lookup[id] > 0u;
 }
 
+template <typename Id, typename T>
+void ComponentSystem<Id, T>::onSpawned(T& /*data*/) {}
+
+template <typename Id, typename T>
+void ComponentSystem<Id, T>::onReleased(T const& /*data*/) {}
+
+template <typename Id, typename T>
+void ComponentSystem<Id, T>::notifySpawned() {
+	ASSERT(num_notified < data.size());
+	for (auto i = num_notified + 1u; i < data.size(); ++i) {
+		onSpawned(data[i]);
+	}
+	num_notified = size();
+}
+
 template <typename Id, typename T>
 T const& ComponentSystem<Id, T>::query(Id id) const {
 	ASSERT(id > 0u);
@@ -127,6 +144,7 @@ void ComponentSystem<Id, T>::cleanup() {
 			// id not used
 			continue;
 		}
+		onReleased(data[index]);
 		auto other = data.back().id;
 		auto last = lookup[other];
 		// replace with last element
@@ -135,6 +153,11 @@ void ComponentSystem<Id, T>::cleanup() {
 		// update lookup table
 		lookup[other] = index;
 		lookup[id] = 0u;
+		if (index <= num_notified && last > num_notified) {
+			// pending object was moved into the notified range
+			onSpawned(data[index]);
+		}
+		num_notified = std::min(num_notified, size());
 	}
 	unused.clear();
 }
@@ -23,12 +23,20 @@
 	string to_string(OS) { ... }
 	OS from_string(string) { ... }
 */
-#define ENUM(name, default_val, enumerators)                          \
+#define ENUM(name, default_val, enumerators) \
+	ENUM_TYPED(name, std::size_t, default_val, enumerators)
+
+// ENUM_TYPED(OS, std::uint8_t, Linux, (Linux)(Apple)(Windows))
+/*
+	Same as ENUM but with the given underlying type, e.g. to store the
+	values densely.
+*/
+#define ENUM_TYPED(name, type, default_val, enumerators)             \
 	template <typename T>                                             \
 	T from_string(std::string const& str);                            \
 	template <typename T>                                             \
 	T default_value();                                                \
-	enum class name : std::size_t { BOOST_PP_SEQ_ENUM(enumerators) }; \
+	enum class name : type { BOOST_PP_SEQ_ENUM(enumerators) };        \
 	inline std::string to_string(name value) {                        \
 		switch (value) {                                              \
 			BOOST_PP_SEQ_FOR_EACH(ENUM_TO_STRING, name, enumerators)  \
@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+
+#include <utils/event_system.hpp>
+
+namespace utils {
+
+/// Event channel with one buffer per producer and a shared batch
+/**
+ *	Each producer (e.g. a job of a parallel update) sends its events to a
+ *	buffer of its own, so producers never need to synchronize. Once all
+ *	producers are done, `publish()` appends their buffers to a single batch
+ *	in producer order. So the batch's order does not depend on the thread
+ *	scheduling. All bound readers share this batch and keep a cursor into
+ *	it, so broadcasting to N readers does not copy the events N times. The
+ *	batch is reset once every reader has caught up. Neither the buffers nor
+ *	the batch release their memory, so the channel stops allocating once
+ *	the largest frame was seen.
+ */
+template <typename T>
+class EventChannel {
+  public:
+	/// Per-listener view to the channel's shared batch
+	class Reader {
+		friend class EventChannel<T>;
+
+	  private:
+		EventChannel<T>* channel;
+		std::size_t cursor;
+
+	  public:
+		Reader();
+		~Reader();
+
+		Reader(Reader const&) = delete;
+		Reader& operator=(Reader const&) = delete;
+
+		/// Query number of published but not dispatched events
+		std::size_t size() const;
+
+		/// Pass all pending events to the given handler
+		/**
+		 *	Each event is passed to `handler.handle(event)`.
+		 *
+		 *	@pre The reader is bound to a channel
+		 *	@param handler Object to handle the events
+		 */
+		template <typename H>
+		void dispatch(H& handler);
+	};
+
+  private:
+	std::vector<SingleEventSender<T>> producers;
+	std::vector<T> batch;
+	std::vector<Reader*> readers;
+
+  public:
+	/// Create a channel
+	/**
+	 *	@param num_producers Number of producer buffers
+	 */
+	EventChannel(std::size_t num_producers=0u);
+	~EventChannel();
+
+	EventChannel(EventChannel const&) = delete;
+	EventChannel& operator=(EventChannel const&) = delete;
+
+	/// Change the number of producer buffers
+	/**
+	 *	Remaining buffers keep their events and their capacity.
+	 *
+	 *	@param num_producers Number of producer buffers
+	 */
+	void resize(std::size_t num_producers);
+
+	/// Query number of producer buffers
+	std::size_t getNumProducers() const;
+
+	/// Query a producer's buffer
+	/**
+	 *	Different buffers may be used by different threads at the same
+	 *	time, but not simultaneously with `publish()`.
+	 *
+	 *	@pre index < getNumProducers()
+	 *	@param index Producer index
+	 *	@return reference to the producer's buffer
+	 */
+	SingleEventSender<T>& operator[](std::size_t index);
+
+	/// Make all sent events visible to the readers
+	/**
+	 *	The buffers are appended to the batch by increasing producer index
+	 *	and cleared afterwards. This must not be called while any producer
+	 *	is sending events. Using `JobSystem::run` to send events
+	 *	guarantees that.
+	 */
+	void publish();
+
+	/// Query the batch of published events
+	/**
+	 *	@return const reference to the events published since the last
+	 *		reset of the batch
+	 */
+	std::vector<T> const& data() const;
+
+	/// Bind a reader to the channel
+	/**
+	 *	The reader will only see events that are published afterwards.
+	 *
+	 *	@pre The reader isn't bound to any channel
+	 *	@param reader Reader to bind
+	 */
+	void bind(Reader& reader);
+
+	/// Unbind a reader from the channel
+	/**
+	 *	@pre The reader is bound to this channel
+	 *	@param reader Reader to unbind
+	 */
+	void unbind(Reader& reader);
+};
+
+}  // ::utils
+
+// include implementation details
+#include <utils/event_channel.inl>
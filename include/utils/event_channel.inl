@@ -0,0 +1,114 @@
+#include <utils/algorithm.hpp>
+#include <utils/assert.hpp>
+
+namespace utils {
+
+template <typename T>
+EventChannel<T>::Reader::Reader()
+	: channel{nullptr}
+	, cursor{0u} {}
+
+template <typename T>
+EventChannel<T>::Reader::~Reader() {
+	if (channel != nullptr) {
+		channel->unbind(*this);
+	}
+}
+
+template <typename T>
+std::size_t EventChannel<T>::Reader::size() const {
+	if (channel == nullptr) {
+		return 0u;
+	}
+	return channel->batch.size() - cursor;
+}
+
+template <typename T>
+template <typename H>
+void EventChannel<T>::Reader::dispatch(H& handler) {
+	ASSERT(channel != nullptr);
+	auto const& batch = channel->batch;
+	for (; cursor < batch.size(); ++cursor) {
+		handler.handle(batch[cursor]);
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+template <typename T>
+EventChannel<T>::EventChannel(std::size_t num_producers)
+	: producers{}
+	, batch{}
+	, readers{} {
+	producers.resize(num_producers);
+}
+
+template <typename T>
+EventChannel<T>::~EventChannel() {
+	for (auto ptr : readers) {
+		ptr->channel = nullptr;
+	}
+}
+
+template <typename T>
+void EventChannel<T>::resize(std::size_t num_producers) {
+	producers.resize(num_producers);
+}
+
+template <typename T>
+std::size_t EventChannel<T>::getNumProducers() const {
+	return producers.size();
+}
+
+template <typename T>
+SingleEventSender<T>& EventChannel<T>::operator[](std::size_t index) {
+	ASSERT(index < producers.size());
+	return producers[index];
+}
+
+template <typename T>
+void EventChannel<T>::publish() {
+	// reset batch if nobody is behind
+	bool caught_up{true};
+	for (auto ptr : readers) {
+		if (ptr->cursor < batch.size()) {
+			caught_up = false;
+			break;
+		}
+	}
+	if (caught_up) {
+		batch.clear();
+		for (auto ptr : readers) {
+			ptr->cursor = 0u;
+		}
+	}
+
+	// merge in producer order
+	for (auto& producer : producers) {
+		auto const& events = producer.data();
+		batch.insert(batch.end(), events.begin(), events.end());
+		producer.clear();
+	}
+}
+
+template <typename T>
+std::vector<T> const& EventChannel<T>::data() const {
+	return batch;
+}
+
+template <typename T>
+void EventChannel<T>::bind(Reader& reader) {
+	ASSERT(reader.channel == nullptr);
+	reader.channel = this;
+	reader.cursor = batch.size();
+	readers.push_back(&reader);
+}
+
+template <typename T>
+void EventChannel<T>::unbind(Reader& reader) {
+	ASSERT(reader.channel == this);
+	utils::pop(readers, &reader);
+	reader.channel = nullptr;
+}
+
+}  // ::utils
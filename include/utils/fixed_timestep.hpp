@@ -0,0 +1,102 @@
+#pragma once
+#include <map>
+#include <string>
+#include <SFML/System/Time.hpp>
+
+#include <utils/histogram.hpp>
+
+namespace utils {
+
+/// Drives a simulation with a fixed step
+/**
+ *	The elapsed frame time is collected in an accumulator. Each `update()`
+ *	executes as many fixed steps as fit into the accumulator, so the
+ *	simulation always advances by the same duration per tick, independent
+ *	of the framerate. The rest is kept for the next frame and can be used
+ *	to interpolate the rendering between two ticks.
+ *	If the simulation cannot keep up, the number of ticks per update is
+ *	capped and the surplus time is dropped (see `getDroppedTime()`) instead
+ *	of piling up more and more ticks.
+ *	Furthermore, the duration of each system's tick can be recorded in a
+ *	histogram per system.
+ */
+class FixedTimestep {
+  public:
+	using Histograms = std::map<std::string, Histogram>;
+
+  private:
+	sf::Time step, accumulator, dropped;
+	std::size_t max_steps;
+	std::uint64_t num_ticks;
+	Histograms histograms;
+
+  public:
+	/// Create a driver with the given step and catch-up cap
+	/**
+	 *	@pre step > 0
+	 *	@pre max_steps > 0
+	 *	@param step Duration of each tick
+	 *	@param max_steps Maximum number of ticks per update
+	 */
+	FixedTimestep(sf::Time const& step, std::size_t max_steps);
+
+	/// Set step by a number of ticks per second
+	/**
+	 *	@pre hz > 0
+	 *	@param hz Ticks per second
+	 */
+	void setTickRate(unsigned int hz);
+
+	void setStep(sf::Time const& step);
+	sf::Time getStep() const;
+
+	void setMaxSteps(std::size_t max_steps);
+	std::size_t getMaxSteps() const;
+
+	/// Advance the simulation
+	/**
+	 *	The given function is called once per tick with the fixed step.
+	 *
+	 *	@param elapsed Time since last update
+	 *	@param func Function to call per tick
+	 *	@return number of ticks done
+	 */
+	template <typename Func>
+	std::size_t update(sf::Time const& elapsed, Func func);
+
+	/// Query time that was not simulated yet
+	/**
+	 *	@return accumulated time within [0, step)
+	 */
+	sf::Time getRemainder() const;
+
+	/// Query interpolation factor between the last and the next tick
+	/**
+	 *	@return remainder relative to the step within [0, 1)
+	 */
+	float getAlpha() const;
+
+	/// Query total number of ticks
+	std::uint64_t getNumTicks() const;
+
+	/// Query total time dropped by the catch-up cap
+	sf::Time getDroppedTime() const;
+
+	/// Reset accumulator, counters and histograms
+	void reset();
+
+	/// Record a system's duration of a tick
+	/**
+	 *	@param name Name of the system
+	 *	@param duration Time the system spent
+	 */
+	void record(std::string const& name, sf::Time const& duration);
+
+	/// Query all histograms by system name
+	Histograms const& getHistograms() const;
+};
+
+}  // ::utils
+
+// include implementation details
+#include <utils/fixed_timestep.inl>
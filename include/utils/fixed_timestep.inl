@@ -0,0 +1,22 @@
+namespace utils {
+
+template <typename Func>
+std::size_t FixedTimestep::update(sf::Time const& elapsed, Func func) {
+	accumulator += elapsed;
+	std::size_t n = 0u;
+	while (accumulator >= step && n < max_steps) {
+		func(step);
+		accumulator -= step;
+		++num_ticks;
+		++n;
+	}
+	if (accumulator >= step) {
+		// simulation cannot keep up, so drop surplus ticks
+		auto remain = accumulator % step;
+		dropped += accumulator - remain;
+		accumulator = remain;
+	}
+	return n;
+}
+
+}  // ::utils
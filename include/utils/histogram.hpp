@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <SFML/System/Time.hpp>
+
+namespace utils {
+
+/// Distribution of durations with logarithmic buckets
+/**
+ *	Each sample is counted in the bucket of its power of two in microseconds,
+ *	so adding a sample takes constant time and memory. Minimum, maximum and
+ *	mean are tracked exactly, percentiles are approximated by the upper
+ *	bound of the corresponding bucket.
+ */
+class Histogram {
+  public:
+	static std::size_t const NUM_BUCKETS = 32u;
+
+  private:
+	std::array<std::uint64_t, NUM_BUCKETS> buckets;
+	std::uint64_t count;
+	sf::Int64 total, min, max;
+
+  public:
+	Histogram();
+
+	/// Add a sample
+	/**
+	 *	@param duration Duration to count, negative values are counted as zero
+	 */
+	void add(sf::Time const& duration);
+
+	/// Reset all samples
+	void clear();
+
+	std::uint64_t getCount() const;
+	sf::Time getMin() const;
+	sf::Time getMax() const;
+	sf::Time getMean() const;
+	sf::Time getTotal() const;
+
+	/// Query an approximated percentile
+	/**
+	 *	@pre 0 <= ratio <= 1
+	 *	@param ratio Percentile to query, e.g. 0.95 for the 95th percentile
+	 *	@return upper bound of the percentile's bucket but at most the
+	 *		maximum sample, zero if no samples were added
+	 */
+	sf::Time getPercentile(float ratio) const;
+
+	/// Query number of samples in a bucket
+	/**
+	 *	Bucket `i` holds samples in [2^(i-1), 2^i) microseconds, bucket 0
+	 *	holds samples below one microsecond.
+	 *
+	 *	@pre i < NUM_BUCKETS
+	 *	@param i Index of the bucket
+	 *	@return number of samples in that bucket
+	 */
+	std::uint64_t getBucket(std::size_t i) const;
+};
+
+}  // ::utils
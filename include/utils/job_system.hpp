@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils {
+
+/// Fixed pool of worker threads to run indexed jobs in parallel
+/**
+ *	A batch of jobs is executed by calling `run()`, which blocks until all
+ *	jobs of the batch are done. The calling thread participates in the
+ *	execution, so a pool without any workers simply runs the batch
+ *	sequentially. Jobs are fetched by index, so callers should keep each
+ *	job's data apart (e.g. by splitting a range into chunks) and merge the
+ *	results afterwards in index order to stay deterministic.
+ *	A JobSystem is not meant to be used by multiple threads at the same
+ *	time.
+ */
+class JobSystem {
+  public:
+	using Job = std::function<void(std::size_t)>;
+
+  private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable wakeup, finished;
+
+	Job const* job;
+	std::size_t num_jobs, generation, busy;
+	std::atomic<std::size_t> next;
+	bool stopping;
+
+	void process();
+	void work();
+
+  public:
+	/// Create a pool with the given number of worker threads
+	/**
+	 *	@param num_workers Number of threads besides the calling one
+	 */
+	JobSystem(std::size_t num_workers=0u);
+	~JobSystem();
+
+	JobSystem(JobSystem const&) = delete;
+	JobSystem& operator=(JobSystem const&) = delete;
+
+	/// Query number of threads that execute a batch
+	/**
+	 *	@return number of workers plus the calling thread
+	 */
+	std::size_t size() const;
+
+	/// Execute a batch of jobs
+	/**
+	 *	The given job is called once per index within [0, num_jobs). The
+	 *	calls are spread across all threads in an unspecified order. This
+	 *	function returns after all calls have finished.
+	 *
+	 *	@param num_jobs Number of jobs within the batch
+	 *	@param job Function to call with each job index
+	 */
+	void run(std::size_t num_jobs, Job const& job);
+};
+
+}  // ::utils
@@ -1,14 +1,18 @@
 #pragma once
+#include <cstdint>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Shader.hpp>
 
 #include <utils/enum_map.hpp>
+#include <utils/sprite_batch.hpp>
 
 namespace utils {
 
 /**
- *	@note This class is NOT unit-tested because it is coupled to the rendering
- *	system too much.
+ *	A layer is occupied if its sprite has a texture and a non-empty texture
+ *	rectangle. Unoccupied layers (e.g. equipment slots without an item)
+ *	are skipped when batching. The occupancy is tracked as a bit mask,
+ *	which is determined lazily after a layer was accessed for writing.
  */
 template <typename Layer>
 class LayeredSprite : public sf::Transformable {
@@ -20,19 +24,45 @@ class LayeredSprite : public sf::Transformable {
 	
 	container layers;
 	float brightness, min_saturation, max_saturation;
+	mutable std::uint32_t mask;
+	mutable bool stale;
 
   public:
 	LayeredSprite();
 
 	sf::Sprite const& operator[](Layer layer) const;
+	/// @note This marks the occupancy to be determined again
 	sf::Sprite& operator[](Layer layer);
 
+	/// Query occupied layers
+	/**
+	 *	@return mask with bit `i` set if the i-th layer is occupied
+	 */
+	std::uint32_t getMask() const;
+
+	/// Query whether any occupied layer is not fully transparent
+	bool isVisible() const;
+
+	/// Determine bounding rectangle of all occupied layers
+	/**
+	 *	@param matrix Transformation applied to all layers
+	 *	@return bounding rectangle, empty if no layer is occupied
+	 */
+	sf::FloatRect getBounds(sf::Transform const& matrix) const;
+
 	void setBrightness(float brightness);
 	void setMinSaturation(float saturation);
 	void setMaxSaturation(float saturation);
 
-	void render(sf::RenderTarget& target, sf::Transform const& matrix,
-		sf::Shader& shader) const;
+	/// Add all occupied layers to a sprite batch
+	/**
+	 *	The layers are added in their order, so they are drawn on top of
+	 *	each other. Unoccupied layers are skipped.
+	 *
+	 *	@param batch SpriteBatch to add to
+	 *	@param matrix Transformation applied to all layers
+	 */
+	void batch(SpriteBatch& batch, sf::Transform const& matrix) const;
 	
 	iterator begin();
 	iterator end();
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <utils/assert.hpp>
 
 namespace utils {
@@ -8,24 +9,22 @@ LayeredSprite<Layer>::LayeredSprite()
 	, layers{}
 	, brightness{1.f}
 	, min_saturation{0.f}
-	, max_saturation{1.f} {}
-
-template <typename Layer>
-void LayeredSprite<Layer>::render(sf::RenderTarget& target,
-	sf::Transform const& matrix, sf::Shader& shader) const {
-	// apply transformations and shader
-	shader.setParameter("brightness", brightness);
-	shader.setParameter("min_saturation", min_saturation);
-	shader.setParameter("max_saturation", max_saturation);
-	shader.setParameter("texture", sf::Shader::CurrentTexture);
-	// create render states
-	sf::RenderStates states;
-	states.transform = matrix;
-	// states.transform.combine(getTransform());
-	states.shader = &shader;
-	// draw layers
+	, max_saturation{1.f}
+	, mask{0u}
+	, stale{true} {
+	ASSERT(layers.size() <= 32u);
+}
+
+template <typename Layer>
+void LayeredSprite<Layer>::batch(SpriteBatch& batch,
+	sf::Transform const& matrix) const {
+	auto bits = getMask();
 	for (auto const& pair : layers) {
-		target.draw(pair.second, states);
+		if ((bits & 1u) != 0u) {
+			batch.add(pair.second, matrix, brightness, min_saturation,
+				max_saturation);
+		}
+		bits >>= 1u;
 	}
 }
 
@@ -36,9 +35,67 @@ sf::Sprite const& LayeredSprite<Layer>::operator[](Layer layer) const {
 
 template <typename Layer>
 sf::Sprite& LayeredSprite<Layer>::operator[](Layer layer) {
+	stale = true;
 	return layers[layer];
 }
 
+template <typename Layer>
+std::uint32_t LayeredSprite<Layer>::getMask() const {
+	if (stale) {
+		mask = 0u;
+		std::uint32_t bit{1u};
+		for (auto const& pair : layers) {
+			auto const & rect = pair.second.getTextureRect();
+			if (pair.second.getTexture() != nullptr && rect.width != 0 &&
+				rect.height != 0) {
+				mask |= bit;
+			}
+			bit <<= 1u;
+		}
+		stale = false;
+	}
+	return mask;
+}
+
+template <typename Layer>
+bool LayeredSprite<Layer>::isVisible() const {
+	auto bits = getMask();
+	for (auto const& pair : layers) {
+		if ((bits & 1u) != 0u && pair.second.getColor().a > 0u) {
+			return true;
+		}
+		bits >>= 1u;
+	}
+	return false;
+}
+
+template <typename Layer>
+sf::FloatRect LayeredSprite<Layer>::getBounds(sf::Transform const& matrix) const {
+	auto bits = getMask();
+	sf::FloatRect bounds;
+	bool first{true};
+	for (auto const& pair : layers) {
+		if ((bits & 1u) != 0u) {
+			auto rect = matrix.transformRect(pair.second.getGlobalBounds());
+			if (first) {
+				bounds = rect;
+				first = false;
+			} else {
+				auto right = std::max(bounds.left + bounds.width,
+					rect.left + rect.width);
+				auto bottom = std::max(bounds.top + bounds.height,
+					rect.top + rect.height);
+				bounds.left = std::min(bounds.left, rect.left);
+				bounds.top = std::min(bounds.top, rect.top);
+				bounds.width = right - bounds.left;
+				bounds.height = bottom - bounds.top;
+			}
+		}
+		bits >>= 1u;
+	}
+	return bounds;
+}
+
 template <typename Layer>
 void LayeredSprite<Layer>::setBrightness(float brightness) {
 	ASSERT(brightness >= 0.f);
@@ -63,11 +120,13 @@ void LayeredSprite<Layer>::setMaxSaturation(float saturation) {
 
 template <typename Layer>
 typename LayeredSprite<Layer>::iterator LayeredSprite<Layer>::begin() {
+	stale = true;
 	return layers.begin();
 }
 
 template <typename Layer>
 typename LayeredSprite<Layer>::iterator LayeredSprite<Layer>::end() {
+	stale = true;
 	return layers.end();
 }
 
@@ -7,6 +7,7 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 namespace utils {
 
@@ -16,6 +17,9 @@ struct Edge {
 	Edge();
 };
 
+bool operator==(Edge const & lhs, Edge const & rhs);
+bool operator!=(Edge const & lhs, Edge const & rhs);
+
 // ---------------------------------------------------------------------------
 
 struct Light {
@@ -31,8 +35,35 @@ struct Light {
 
 // ---------------------------------------------------------------------------
 
+/// Range of edge indices which refer to the edges casting a light's shadows
+struct EdgeRange {
+	std::size_t first, last;
+
+	EdgeRange();
+};
+
+// ---------------------------------------------------------------------------
+
 extern float const MAX_LIGHT_RADIUS;
 
+/// Calculate the half side length of the square which is lit by the light
+/**
+ *	This assumes a lightmap which was created for MAX_LIGHT_RADIUS.
+ *
+ *	@param light Light source with its radius scaled to pixels
+ *	@return half side length in pixels
+ */
+float getLightRange(Light const & light);
+
+/// Calculate the half side length of the square which limits the shadows
+/**
+ *	This assumes a lightmap which was created for MAX_LIGHT_RADIUS.
+ *
+ *	@param light Light source with its radius scaled to pixels
+ *	@return half side length in pixels
+ */
+float getShadowRange(Light const & light);
+
 /// Calculate a "far" point outside the box
 /**
  *	The far point is located at the ray from origin through pos outside the
@@ -51,9 +82,191 @@ sf::Texture createLightmap(float radius, sf::Shader& shader);
 
 // ---------------------------------------------------------------------------
 
+/// Merge collinear, axis-aligned edges
+/**
+ *	Horizontal and vertical edges which are located on the same line and
+ *	touch or overlap each other are replaced by a single edge. Because each
+ *	wall tile provides all four of its edges, adjacent walls produce lots of
+ *	redundant edges. Other edges are kept as they are, edges of zero length
+ *	are dropped. The order of the edges is not preserved.
+ *
+ *	@param edges Edges to merge in-place
+ */
+void mergeEdges(std::vector<Edge>& edges);
+
+/// Clip edges to a square around the origin
+/**
+ *	Only edges which are (at least partially) located inside the square are
+ *	appended to the result, clipped to the square's border.
+ *
+ *	@param origin Center of the square
+ *	@param range Half side length of the square
+ *	@param edges Edges to clip
+ *	@param result Out parameter for the clipped edges
+ */
+void clipEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<Edge>& result);
+
+/// Clip a subset of edges to a square around the origin
+/**
+ *	This behaves like the overload above, but only clips the edges which
+ *	are referred by the given range of indices.
+ *
+ *	@pre subset.last <= indices.size()
+ *	@param origin Center of the square
+ *	@param range Half side length of the square
+ *	@param edges Edges to clip
+ *	@param indices Indices of edges
+ *	@param subset Range of indices to use
+ *	@param result Out parameter for the clipped edges
+ */
+void clipEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<std::size_t> const & indices,
+	EdgeRange const & subset, std::vector<Edge>& result);
+
+/// Select the edges near a square around the origin
+/**
+ *	The indices of all edges which touch the square are appended in
+ *	ascending order. So each light can refer to its nearby edges within a
+ *	set of edges that was merged once for all lights.
+ *
+ *	@param origin Center of the square
+ *	@param range Half side length of the square
+ *	@param edges Edges to select from
+ *	@param indices Out parameter for the indices of the selected edges
+ */
+void selectEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<std::size_t>& indices);
+
+/// Calculate the visibility polygon of a light source
+/**
+ *	Rays are cast from the origin towards each edge's endpoint (and slightly
+ *	beside it, to look past corners) and stopped at the nearest edge. The
+ *	polygon is limited to the square around the origin. It is provided as
+ *	triangle fan: starting at the origin and closed by repeating the first
+ *	point of the polygon.
+ *
+ *	@pre range > 0
+ *	@param origin Position of the light source
+ *	@param range Half side length of the square
+ *	@param edges Edges clipped to the square
+ *	@param fan Out parameter for the triangle fan's points
+ */
+void computeVisibility(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<sf::Vector2f>& fan);
+
+/// Keeps visibility polygons across frames
+/**
+ *	A polygon is only recomputed if no polygon was computed for the same
+ *	origin and range with the same nearby edges. So lights and walls which do
+ *	not move will reuse their polygon. Polygons which were not queried since
+ *	the last cleanup are dropped.
+ */
+class VisibilityCache {
+  private:
+	struct Entry {
+		sf::Vector2f origin;
+		float range;
+		std::vector<Edge> edges;
+		std::vector<sf::Vector2f> fan;
+		bool used;
+
+		Entry();
+	};
+
+	std::vector<Entry> entries;
+	std::vector<Edge> clipped;
+	std::size_t num_hits, num_misses;
+
+	std::vector<sf::Vector2f> const & lookup(
+		sf::Vector2f const & origin, float range);
+
+  public:
+	VisibilityCache();
+
+	/// Query the visibility polygon of a light source
+	/**
+	 *	The edges are clipped to the light's square before looking for a
+	 *	suitable polygon. The returned fan is valid until the next query.
+	 *
+	 *	@param origin Position of the light source
+	 *	@param range Half side length of the light's square
+	 *	@param edges Edges around the light, which might be merged before
+	 *	@return triangle fan of the visibility polygon
+	 */
+	std::vector<sf::Vector2f> const & query(sf::Vector2f const & origin,
+		float range, std::vector<Edge> const & edges);
+
+	/// Query the visibility polygon using a subset of edges
+	/**
+	 *	This behaves like the overload above, but only the edges which are
+	 *	referred by the given range of indices are clipped.
+	 *
+	 *	@param origin Position of the light source
+	 *	@param range Half side length of the light's square
+	 *	@param edges Edges of all lights
+	 *	@param indices Indices of edges
+	 *	@param subset Range of indices referring to the light's edges
+	 *	@return triangle fan of the visibility polygon
+	 */
+	std::vector<sf::Vector2f> const & query(sf::Vector2f const & origin,
+		float range, std::vector<Edge> const & edges,
+		std::vector<std::size_t> const & indices, EdgeRange const & subset);
+
+	/// Drop all polygons which were not queried since the last cleanup
+	/**
+	 *	This also resets the number of hits and misses.
+	 */
+	void cleanup();
+
+	/// Query number of cached polygons
+	std::size_t size() const;
+
+	/// Query number of reused polygons since the last cleanup
+	std::size_t getNumHits() const;
+
+	/// Query number of computed polygons since the last cleanup
+	std::size_t getNumMisses() const;
+};
+
+// ---------------------------------------------------------------------------
+
+namespace lighting_impl {
+
+struct Stats {
+	std::size_t edges;     // edges near the shadowcasting lights
+	std::size_t shadows;   // shadowcasting lights drawn
+	std::size_t vertices;  // vertices of their visibility polygons
+	std::size_t cached;    // visibility polygons reused
+	std::size_t computed;  // visibility polygons computed
+
+	Stats();
+};
+
+/// Determine whether a shadow map is drawn
+/**
+ *	The shadow map provides the ambient darkness, so it is drawn if any
+ *	light is drawn at the given level of details. This does not depend on
+ *	the lights casting shadows or on the edges around them.
+ *
+ *	@param lights Lights to draw
+ *	@param lod Current level of details
+ *	@return true if the shadow map is drawn
+ */
+bool needsShadowMap(std::vector<Light> const & lights, std::size_t lod);
+
+}  // ::lighting_impl
+
+// ---------------------------------------------------------------------------
+
 /**
+ *	Shadows are drawn by rendering each shadowcasting light's visibility
+ *	polygon, textured with the lightmap. The edges are merged once per
+ *	camera, each light refers to the nearby ones by a range of indices. The
+ *	polygons are kept by a VisibilityCache.
+ *
  *	@note This class is NOT unit-tested because it is coupled to the rendering
- *	system too much.
+ *	system too much. The shadow geometry is tested separately.
  *
  *	@note: Only axis-aligned edges are allowed
  */
@@ -64,6 +277,9 @@ class LightingSystem {
 	sf::Color shadow;
 	sf::Sprite light_sprite;
 	std::size_t lod, num_drawn_lights, num_drawn_shadows;
+	VisibilityCache visibility;
+	sf::VertexArray fan_vertices;
+	lighting_impl::Stats stats;
 
 	void prepareLight(Light const& light);
 
@@ -75,14 +291,22 @@ class LightingSystem {
 	std::size_t getLevelOfDetails() const;
 
 	sf::Texture const & getLightmap() const;
+	lighting_impl::Stats const & getStats() const;
 
 	void resize(sf::Vector2u const& size);
 
 	void clear();
 
 	/// scene and screen are necessary due to splitscreen
+	/**
+	 *	Each light only casts shadows at the edges whose indices are given
+	 *	by its range.
+	 *
+	 *	@pre ranges.size() == lights.size()
+	 */
 	void update(sf::View const& scene, sf::View const& screen,
-		std::vector<Edge> const& edges, std::vector<Light> const& lights);
+		std::vector<Edge> const& edges, std::vector<std::size_t> const& indices,
+		std::vector<Light> const& lights, std::vector<EdgeRange> const& ranges);
 
 	void saveShadowMap(std::string const& filename) const;
 	void saveLightMap(std::string const& filename) const;
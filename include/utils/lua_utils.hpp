@@ -1,11 +1,13 @@
 #pragma once
 #include <utils/assert.hpp>
 
+#include <memory>
 #include <type_traits>
 #include <vector>
 #include <sol2/sol.hpp>
 
 #include <utils/enum_map.hpp>
+#include <utils/random.hpp>
 
 namespace utils {
 
@@ -23,6 +25,8 @@ class Script {
 	sol::state lua;
 	bool loaded;
 	std::string filename;
+	// note: kept on the heap because lua refers to it
+	std::unique_ptr<RandomStream> rng;
 
   public:
 	Script();
@@ -35,6 +39,16 @@ class Script {
 
 	std::string getFilename() const;
 
+	/// Restart the random stream behind math.random
+	/**
+	 *	The script's math.random and math.randomseed are replaced to use a
+	 *	random stream of their own. So scripts yield the same numbers for
+	 *	the same seed, independent of the other scripts.
+	 *
+	 *	@param seed Seed to use
+	 */
+	void seed(std::uint32_t seed);
+
 	template <typename... Args>
 	void operator()(std::string const& name, Args&&... args) const;
 
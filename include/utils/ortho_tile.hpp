@@ -36,6 +36,15 @@ struct OrthoTile {
 		sf::Vector2u const& offset, sf::Vector2u const& tile_size,
 		ShadingCase shading = 0u, bool has_edges = false);
 
+	/// Query the tileset offset used for the last refresh
+	/// @pre Tile refreshed
+	/// @param tile_size Tile size used for the last refresh
+	sf::Vector2u getOffset(sf::Vector2u const& tile_size) const;
+
+	/// Query the shading case used for the last refresh
+	/// @pre Tile refreshed
+	ShadingCase getShading() const;
+
 	/// @pre Tile refreshed
 	void fetchTile(sf::VertexArray& out) const;
 
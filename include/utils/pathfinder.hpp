@@ -3,7 +3,7 @@
 #include <unordered_set>
 #include <SFML/System/Vector2.hpp>
 
-//#include <utils/priority_queue.hpp>
+#include <utils/priority_queue.hpp>
 
 namespace utils {
 
@@ -72,34 +72,66 @@ class Pathfinder {
 			std::vector<Entity> const& ignore={});
 };
 
-/*
+/// Status of a node inside a PathDict
 enum class NodeStatus { Unknown, Open, Closed };
 
-struct PathNode {
+/// Describes an A*-Node stored by a PathDict
+struct DictNode {
 	sf::Vector2u pos;
-	PathNode *previous, *next;
+	DictNode const* previous;
 	float f, g;
 	NodeStatus status;
+	std::size_t generation;
 
-	PathNode(sf::Vector2u pos = {0u, 0u});
+	DictNode(sf::Vector2u pos = {0u, 0u});
 };
 
+/// Dense per-scene storage of A*-Nodes
+/**
+ *	Each grid position owns exactly one node at index `x + y * width`.
+ *	Instead of resetting all nodes between two searches, the dictionary
+ *	advances its generation. A node of an older generation is reset
+ *	lazily when it is accessed the next time.
+ */
 class PathDict {
   private:
 	sf::Vector2u const grid_size;
-	std::vector<PathNode> nodes;
+	std::vector<DictNode> nodes;
+	std::size_t generation;
 
   public:
+	/// Create dictionary for the given grid size
+	/**
+	 *	@param grid_size Size of the scene's grid
+	 */
 	PathDict(sf::Vector2u const& grid_size);
 
+	/// Invalidate all nodes
+	/**
+	 *	This only advances the generation counter. Only if the counter
+	 *	overflows, all nodes are reset.
+	 */
 	void clear();
-	PathNode& at(sf::Vector2u const& pos);
-};
 
-// ---------------------------------------------------------------------------
+	/// Query whether the position is inside the grid
+	/**
+	 *	@param pos Grid position
+	 *	@return true if a node exists for this position
+	 */
+	bool has(sf::Vector2u const& pos) const;
+
+	/// Query the node of the current generation
+	/**
+	 *	@pre has(pos)
+	 *	@param pos Grid position
+	 *	@return reference to the node
+	 */
+	DictNode& at(sf::Vector2u const& pos);
+};
 
+/// Hash helper for the PriorityQueue used with a PathDict
 struct CoordHash {
-	sf::Vector2u const grid_size;
+	sf::Vector2u grid_size;
 
 	CoordHash(sf::Vector2u const& grid_size);
 
@@ -107,39 +139,88 @@ struct CoordHash {
 	std::size_t operator()(sf::Vector2u const& pos) const;
 };
 
-// ---------------------------------------------------------------------------
+// --------------------------------------------------------------------
 
+/// Grid-based pathfinder for a single scene
+/**
+ *	This pathfinder provides the same interface as `Pathfinder`, but uses
+ *	a preallocated PathDict instead of a hashed closed list. The openlist
+ *	is an indexed priority queue, so each position is enqueued at most
+ *	once and updated via decrease key. Hence no allocation is performed
+ *	during a search, apart from the scene's neighbor queries and the
+ *	resulting path.
+ *
+ *	@note The scene's size is assumed to be constant.
+ */
 template <typename Scene, typename Entity>
-class Pathfinder {
-  private:
-	Scene const& scene;
-
-	PathDict dict;
-	PriorityQueue<sf::Vector2u, float, CoordHash> queue;
-
-	sf::Vector2u origin, target;
-	PathNode* nearest;
-	float alt;  // distance between nearest and target
-	std::size_t max_length;
-	bool strict;
-	std::vector<sf::Vector2u> path, neighbors;
-	Entity entity_id;
-
-  public:
-	Pathfinder(Scene const& scene);
-
-	void initialize(Entity entity_id, sf::Vector2u const& origin,
-		sf::Vector2u const& target, std::size_t max_length, bool strict = true);
-
-	/// Calculate next step of pathfinding
-	/// @pre Pathfinding was initialized for a specific entity
-	///	@return true if path found (or everything was checked)
-	///
-	bool calculate();
-
-	std::vector<sf::Vector2u> getPath() const;
+class GridPathfinder {
+	private:
+		Scene const& scene;
+		
+		// grid-indexed A*-related containers
+		PathDict dict;
+		PriorityQueue<sf::Vector2u, float, CoordHash> openlist;
+		
+		// request data
+		Entity entity_id;
+		sf::Vector2u origin, target;
+		std::size_t max_length;
+		std::vector<Entity> ignore;
+		
+		// search state
+		DictNode const* closest;
+		bool done;
+		
+		float heuristic(sf::Vector2u const & pos) const;
+		
+	public:
+		/// @brief Initial pathfinder for a single scene
+		///
+		/// @param scene Reference to the underlying scene
+		GridPathfinder(Scene const& scene);
+		
+		/// @brief Start a resumable search
+		///
+		/// Any previous search is discarded. No node is expanded
+		/// until `resume()` is called.
+		///
+		/// @param entity_id Actor's ID
+		/// @param origin Source position
+		/// @param target Target position
+		/// @param max_length Maximum length for desired path
+		/// @param ignore Vector of Entities to ignore
+		void start(Entity entity_id, sf::Vector2u const& origin,
+			sf::Vector2u const& target, std::size_t max_length,
+			std::vector<Entity> const& ignore={});
+		
+		/// @brief Continue the current search
+		///
+		/// Expands at most `budget` nodes. The number of expanded nodes
+		/// is subtracted from the given budget.
+		///
+		/// @param budget Number of nodes that may be expanded
+		/// @return true if the search is finished
+		bool resume(std::size_t& budget);
+		
+		/// @brief Query the current search's path
+		///
+		/// If the search was not finished yet, the path leads to the
+		/// closest position discovered so far.
+		///
+		/// @return path starting with the (closest) target position
+		Path getPath() const;
+		
+		/// @brief Calculate a path
+		///
+		/// @param entity_id Actor's ID
+		/// @param origin Source position
+		/// @param target Target position
+		/// @param max_length Maximum length for desired path
+		/// @param ignore Vector of Entities to ignore
+		Path operator()(Entity entity_id, sf::Vector2u const& origin,
+			sf::Vector2u const& target, std::size_t max_length,
+			std::vector<Entity> const& ignore={});
 };
-*/
 
 }  // ::utils
 
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <limits>
 #include <iostream>
 
 namespace utils {
@@ -52,13 +53,14 @@ Path Pathfinder<Scene, Entity>::operator()(Entity entity_id,
 		auto node = openlist.back();
 		openlist.pop_back();
 		
+		auto it = closedlist.insert(node);
 		if (node.pos == target) {
 			// reconstruct path to target
-			closest = &node;
+			// note: node is a local copy, so the closed one is used
+			closest = &(*it.first);
 			break;
 		}
 		
-		auto it = closedlist.insert(node);
 		if (!it.second) {
 			// position already on closed list - skip further stuff
 			continue;
@@ -107,4 +109,149 @@ Path Pathfinder<Scene, Entity>::operator()(Entity entity_id,
 	return p;
 }
 
+// --------------------------------------------------------------------
+
+template <typename Scene, typename Entity>
+GridPathfinder<Scene, Entity>::GridPathfinder(Scene const& scene)
+	: scene{scene}
+	, dict{scene.getSize()}
+	, openlist{CoordHash{scene.getSize()}}
+	, entity_id{}
+	, origin{}
+	, target{}
+	, max_length{}
+	, ignore{}
+	, closest{nullptr}
+	, done{true} {
+}
+
+template <typename Scene, typename Entity>
+float GridPathfinder<Scene, Entity>::heuristic(sf::Vector2u const & pos) const {
+	return scene.getDistance(pos, target);
+}
+
+template <typename Scene, typename Entity>
+void GridPathfinder<Scene, Entity>::start(Entity entity_id,
+	sf::Vector2u const& origin, sf::Vector2u const& target,
+	std::size_t max_length, std::vector<Entity> const& ignore) {
+	// apply request
+	this->entity_id = entity_id;
+	this->origin = origin;
+	this->target = target;
+	this->max_length = max_length;
+	this->ignore = ignore;
+	
+	// invalidate previous search
+	dict.clear();
+	openlist.clear();
+	closest = nullptr;
+	done = false;
+	
+	if (!dict.has(origin)) {
+		// source is out of grid
+		done = true;
+		return;
+	}
+	
+	// enqueue origin with f = h
+	auto& start = dict.at(origin);
+	start.f = heuristic(origin);
+	start.status = NodeStatus::Open;
+	openlist.insert(origin, start.f);
+}
+
+template <typename Scene, typename Entity>
+bool GridPathfinder<Scene, Entity>::resume(std::size_t& budget) {
+	while (!done && budget > 0u) {
+		if (openlist.empty()) {
+			done = true;
+			break;
+		}
+		
+		// extract min
+		auto& node = dict.at(openlist.extract());
+		--budget;
+		
+		if (node.pos == target) {
+			// reconstruct path to target
+			closest = &node;
+			done = true;
+			break;
+		}
+		
+		node.status = NodeStatus::Closed;
+		if (closest == nullptr || heuristic(node.pos) < heuristic(closest->pos)) {
+			// pointer to the closest yet discovered position
+			closest = &node;
+		}
+		
+		// expand node
+		auto neighbors = scene.getNeighbors(entity_id, node.pos, ignore);
+		for (auto const& neighbor_pos: neighbors) {
+			auto& next = dict.at(neighbor_pos);
+			if (next.status == NodeStatus::Closed) {
+				continue;
+			}
+			
+			// respect maximum path length
+			auto g = node.g + scene.getDistance(node.pos, neighbor_pos);
+			if (max_length > 0u && g > max_length) {
+				continue;
+			}
+			
+			if (next.status == NodeStatus::Open) {
+				if (g >= next.g) {
+					// known route is not worse
+					continue;
+				}
+				// found shorter route to an open node
+				next.g = g;
+				next.f = g + heuristic(neighbor_pos);
+				next.previous = &node;
+				openlist.decrease(neighbor_pos, next.f);
+			} else {
+				// discovered new node
+				next.g = g;
+				next.f = g + heuristic(neighbor_pos);
+				next.previous = &node;
+				next.status = NodeStatus::Open;
+				openlist.insert(neighbor_pos, next.f);
+			}
+		}
+	}
+	
+	return done;
+}
+
+template <typename Scene, typename Entity>
+Path GridPathfinder<Scene, Entity>::getPath() const {
+	Path p;
+	if (closest == nullptr) {
+		// nothing expanded yet or source is out of grid
+		p.push_back(origin);
+		return p;
+	}
+	
+	// reconstruct path
+	auto node = closest;
+	while (node != nullptr) {
+		p.push_back(node->pos);
+		node = node->previous;
+	}
+	
+	return p;
+}
+
+template <typename Scene, typename Entity>
+Path GridPathfinder<Scene, Entity>::operator()(Entity entity_id,
+	sf::Vector2u const& origin, sf::Vector2u const& target,
+	std::size_t max_length, std::vector<Entity> const& ignore) {
+	start(entity_id, origin, target, max_length, ignore);
+	
+	auto budget = std::numeric_limits<std::size_t>::max();
+	resume(budget);
+	
+	return getPath();
+}
+
 }  // ::utils
@@ -34,6 +34,7 @@ class PriorityQueue {
 	void insert(T value, K key);
 	T extract();
 	void decrease(T const& value, K key);
+	/// Remove all elements in O(1)
 	void clear();
 };
 
@@ -3,8 +3,8 @@ namespace utils {
 template <typename T, typename K, typename H>
 PriorityQueue<T, K, H>::PriorityQueue(H&& func)
 	: data{nullptr}, lookup{nullptr}, size{0u}, func{std::move(func)} {
-	data = new Node[func.range()]{};
-	lookup = new std::size_t[func.range()]{};
+	data = new Node[this->func.range()]{};
+	lookup = new std::size_t[this->func.range()]{};
 }
 
 template <typename T, typename K, typename H>
@@ -26,13 +26,15 @@ void PriorityQueue<T, K, H>::bubble_up(std::size_t index) {
 	// remove dangling element
 	Node elem = std::move(data[index]);
 
-	std::size_t parent = index / 2u;
-	while (index > 0u && data[parent].key > elem.key) {
+	while (index > 0u) {
+		std::size_t parent = (index - 1u) / 2u;
+		if (!(data[parent].key > elem.key)) {
+			break;
+		}
 		// move parent to child position
 		data[index] = std::move(data[parent]);
 		update_lookup(index);
 		index = parent;
-		parent /= 2u;
 	}
 
 	// place dangling element
@@ -46,7 +48,7 @@ void PriorityQueue<T, K, H>::bubble_down(std::size_t index) {
 
 	while (index < size) {
 		// determine greater children's index
-		std::size_t child = index * 2u;
+		std::size_t child = index * 2u + 1u;
 		if (child + 1u < size && data[child].key > data[child + 1u].key) {
 			++child;
 		}
@@ -107,10 +109,9 @@ void PriorityQueue<T, K, H>::decrease(T const& value, K key) {
 
 template <typename T, typename K, typename H>
 void PriorityQueue<T, K, H>::clear() {
+	// note: lookup entries are overwritten on insertion, so they are not
+	// reset here
 	size = 0u;
-	for (std::size_t i = 0u; i < func.range(); ++i) {
-		lookup[i] = 0u;
-	}
 }
 
 }  // ::utils
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <random>
+
+namespace utils {
+
+/// Seedable stream of random numbers
+/**
+ *	Each subsystem that needs reproducible results (e.g. the dungeon
+ *	generator or the combat variance) owns a stream of its own, so drawing
+ *	numbers in one subsystem does not shift the numbers of another one.
+ *	The numbers are mapped to the requested ranges without using the
+ *	standard distributions, because those are implementation-defined. So
+ *	the same seed yields the same numbers with each compiler.
+ */
+class RandomStream {
+  private:
+	std::mt19937 engine;
+	std::uint32_t initial;
+
+  public:
+	/// Create a stream with the given seed
+	/**
+	 *	@param seed Seed to start the stream with
+	 */
+	RandomStream(std::uint32_t seed=0u);
+
+	/// Restart the stream with the given seed
+	/**
+	 *	@param seed Seed to start the stream with
+	 */
+	void seed(std::uint32_t seed);
+
+	/// Query the seed the stream was started with
+	std::uint32_t getSeed() const;
+
+	/// Draw the next raw number
+	std::uint32_t next();
+
+	/// Draw a number within [min, max]
+	/**
+	 *	@pre min <= max
+	 */
+	int operator()(int min, int max);
+	unsigned int operator()(unsigned int min, unsigned int max);
+	float operator()(float min, float max);
+
+	/// Derive the seed of a sub stream
+	/**
+	 *	This is used to seed multiple streams with a single seed without
+	 *	making them yield the same numbers.
+	 *
+	 *	@param seed Base seed
+	 *	@param stream Index of the sub stream
+	 *	@return seed for the sub stream
+	 */
+	static std::uint32_t derive(std::uint32_t seed, std::uint32_t stream);
+};
+
+}  // ::utils
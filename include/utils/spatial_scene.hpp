@@ -20,13 +20,41 @@ struct SpatialCell : public Cell {
 	SpatialCell();
 };
 
+/// Placeholder for scenes without cold cell data
+struct EmptyCell {};
+
+/// Memory used by a scene's cells
+struct SceneMemory {
+	std::size_t num_cells;
+	std::size_t terrain_bytes;	// dense plane of terrain values
+	std::size_t hot_bytes;		// dense plane of hot cells
+	std::size_t cold_bytes;		// dense plane of cold cells
+	std::size_t entity_bytes;	// heap memory of all entity lists
+
+	SceneMemory();
+};
+
 // ---------------------------------------------------------------------------
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
+/// Grid of cells with separate planes of terrain, hot and cold data
+/**
+ *	Each cell is split into three parts, each stored in its own dense
+ *	array: The terrain is a small value (e.g. a byte), which is checked by
+ *	most simulation queries (e.g. collision, navigation and focus). The
+ *	hot cell contains the remaining data used by the simulation, such as
+ *	the entities located at the cell. The cold cell contains all other
+ *	data (e.g. for rendering). So scanning the terrain doesn't pull hot or
+ *	cold data into the cache, and scanning hot cells doesn't pull cold data.
+ */
+template <typename Cell, typename Entity, utils::GridMode Mode,
+	typename Cold = EmptyCell, typename Terrain = std::uint8_t>
 class SpatialScene : public utils::Tiling<Mode> {
   private:
+	std::vector<Terrain> terrain;
 	std::vector<SpatialCell<Cell, Entity>> cells;
+	std::vector<Cold> cold;
 	sf::Vector2u const scene_size;
+	std::size_t revision;  // of the cells' entities
 
 	std::size_t getIndex(sf::Vector2u const pos) const;
 
@@ -42,6 +70,69 @@ class SpatialScene : public utils::Tiling<Mode> {
 	SpatialCell<Cell, Entity>& getCell(sf::Vector2u const& pos);
 	SpatialCell<Cell, Entity> const& getCell(sf::Vector2u const& pos) const;
 
+	/// Query a cell without throwing
+	/**
+	 *	@param pos Position of the cell
+	 *	@return pointer to the cell or nullptr if out of the scene
+	 */
+	SpatialCell<Cell, Entity>* tryGetCell(sf::Vector2u const& pos);
+	SpatialCell<Cell, Entity> const* tryGetCell(sf::Vector2u const& pos) const;
+
+	/// Query a cell's terrain
+	/**
+	 *	@param pos Position of the cell
+	 *	@return reference to the terrain value
+	 */
+	Terrain& getTerrain(sf::Vector2u const& pos);
+	Terrain getTerrain(sf::Vector2u const& pos) const;
+
+	/// Query a cell's terrain without throwing
+	/**
+	 *	@param pos Position of the cell
+	 *	@param fallback Terrain to return if out of the scene
+	 *	@return terrain value or fallback
+	 */
+	Terrain tryGetTerrain(sf::Vector2u const& pos, Terrain fallback) const;
+
+	Cold& getColdCell(sf::Vector2u const& pos);
+	Cold const& getColdCell(sf::Vector2u const& pos) const;
+
+	/// Determine the memory used by the cells
+	/**
+	 *	Heap memory owned by the hot or cold cells themselves is not
+	 *	considered, except the entity lists.
+	 *
+	 *	@return memory usage of the scene's cells
+	 */
+	SceneMemory getMemoryUsage() const;
+
+	/// Release all cold cells
+	/**
+	 *	The hot cells are not affected, so the scene can still be
+	 *	simulated. Until the cold cells are allocated again, querying a
+	 *	cold cell throws.
+	 */
+	void releaseColdCells();
+
+	/// Allocate default cold cells if they were released
+	void allocateColdCells();
+
+	bool hasColdCells() const;
+
+	/// Mark the cells' entities as modified
+	/**
+	 *	Everyone who adds, removes or moves entities between cells needs
+	 *	to call this, so data derived from the entities can be reused
+	 *	until the revision changes.
+	 */
+	void touch();
+
+	/// Query how often the cells' entities were modified
+	/**
+	 *	@return revision of the cells' entities
+	 */
+	std::size_t getRevision() const;
+
 	// float getDistance(sf::Vector2u const & u, sf::Vector2u const & v) const;
 	sf::Vector2u getSize() const;
 };
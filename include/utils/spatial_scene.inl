@@ -4,22 +4,36 @@ template <typename Cell, typename Entity>
 SpatialCell<Cell, Entity>::SpatialCell()
 	: Cell{}, entities{} {}
 
+inline SceneMemory::SceneMemory()
+	: num_cells{0u}
+	, terrain_bytes{0u}
+	, hot_bytes{0u}
+	, cold_bytes{0u}
+	, entity_bytes{0u} {}
+
 // ---------------------------------------------------------------------------
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-SpatialScene<Cell, Entity, Mode>::SpatialScene(SceneID id,
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SpatialScene<Cell, Entity, Mode, Cold, Terrain>::SpatialScene(SceneID id,
 	sf::Texture const& tileset, sf::Vector2u const& scene_size,
 	sf::Vector2f const& tile_size)
 	: utils::Tiling<Mode>{tile_size}
+	, terrain{}
 	, cells{}
+	, cold{}
 	, scene_size{scene_size}  //, pathfinder{*this}
+	, revision{0u}
 	, id{id}
 	, tileset{tileset} {
+	terrain.resize(scene_size.x * scene_size.y);
 	cells.resize(scene_size.x * scene_size.y);
+	cold.resize(scene_size.x * scene_size.y);
 }
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-std::size_t SpatialScene<Cell, Entity, Mode>::getIndex(
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+std::size_t SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getIndex(
 	sf::Vector2u const pos) const {
 	if (!has(pos)) {
 		throw std::out_of_range{
@@ -30,28 +44,137 @@ std::size_t SpatialScene<Cell, Entity, Mode>::getIndex(
 	return pos.x + pos.y * scene_size.x;
 }
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-bool SpatialScene<Cell, Entity, Mode>::has(sf::Vector2u const& pos) const {
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+bool SpatialScene<Cell, Entity, Mode, Cold, Terrain>::has(sf::Vector2u const& pos) const {
 	return pos.x < scene_size.x && pos.y < scene_size.y;
 }
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-SpatialCell<Cell, Entity>& SpatialScene<Cell, Entity, Mode>::getCell(
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SpatialCell<Cell, Entity>& SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getCell(
+	sf::Vector2u const& pos) {
+	return cells[getIndex(pos)];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SpatialCell<Cell, Entity> const& SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getCell(
+	sf::Vector2u const& pos) const {
+	return cells[getIndex(pos)];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SpatialCell<Cell, Entity>* SpatialScene<Cell, Entity, Mode, Cold, Terrain>::tryGetCell(
+	sf::Vector2u const& pos) {
+	if (!has(pos)) {
+		return nullptr;
+	}
+	return &cells[pos.x + pos.y * scene_size.x];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SpatialCell<Cell, Entity> const*
+SpatialScene<Cell, Entity, Mode, Cold, Terrain>::tryGetCell(
+	sf::Vector2u const& pos) const {
+	if (!has(pos)) {
+		return nullptr;
+	}
+	return &cells[pos.x + pos.y * scene_size.x];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+Terrain& SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getTerrain(
+	sf::Vector2u const& pos) {
+	return terrain[getIndex(pos)];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+Terrain SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getTerrain(
+	sf::Vector2u const& pos) const {
+	return terrain[getIndex(pos)];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+Terrain SpatialScene<Cell, Entity, Mode, Cold, Terrain>::tryGetTerrain(
+	sf::Vector2u const& pos, Terrain fallback) const {
+	if (!has(pos)) {
+		return fallback;
+	}
+	return terrain[pos.x + pos.y * scene_size.x];
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+Cold& SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getColdCell(
 	sf::Vector2u const& pos) {
 	auto index = getIndex(pos);
-	return cells.at(index);
+	return cold.at(index);
 }
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-SpatialCell<Cell, Entity> const& SpatialScene<Cell, Entity, Mode>::getCell(
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+Cold const& SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getColdCell(
 	sf::Vector2u const& pos) const {
 	auto index = getIndex(pos);
-	return cells.at(index);
+	return cold.at(index);
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+SceneMemory SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getMemoryUsage() const {
+	SceneMemory memory;
+	memory.num_cells = cells.size();
+	memory.terrain_bytes = terrain.capacity() * sizeof(Terrain);
+	memory.hot_bytes = cells.capacity() * sizeof(SpatialCell<Cell, Entity>);
+	memory.cold_bytes = cold.capacity() * sizeof(Cold);
+	for (auto const& cell : cells) {
+		memory.entity_bytes += cell.entities.capacity() * sizeof(Entity);
+	}
+	return memory;
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+void SpatialScene<Cell, Entity, Mode, Cold, Terrain>::releaseColdCells() {
+	std::vector<Cold>{}.swap(cold);
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+void SpatialScene<Cell, Entity, Mode, Cold, Terrain>::allocateColdCells() {
+	if (cold.empty()) {
+		cold.resize(cells.size());
+	}
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+bool SpatialScene<Cell, Entity, Mode, Cold, Terrain>::hasColdCells() const {
+	return !cold.empty();
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+void SpatialScene<Cell, Entity, Mode, Cold, Terrain>::touch() {
+	++revision;
+}
+
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+std::size_t SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getRevision() const {
+	return revision;
 }
 
 /*
-template <typename Cell, typename Entity, utils::GridMode Mode>
-float SpatialScene<Cell, Entity, Mode>::getDistance(sf::Vector2u const & u,
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+float SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getDistance(sf::Vector2u const & u,
 sf::Vector2u const & v) const {
 	auto dx = utils::distance(u.x, v.x);
 	auto dy = utils::distance(u.y, v.y);
@@ -63,8 +186,9 @@ sf::Vector2u const & v) const {
 }
 */
 
-template <typename Cell, typename Entity, utils::GridMode Mode>
-sf::Vector2u SpatialScene<Cell, Entity, Mode>::getSize() const {
+template <typename Cell, typename Entity, utils::GridMode Mode, typename Cold,
+	typename Terrain>
+sf::Vector2u SpatialScene<Cell, Entity, Mode, Cold, Terrain>::getSize() const {
 	return scene_size;
 }
 }
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+namespace utils {
+
+/// Collects sprites into as few vertex arrays as possible
+/**
+ *	Consecutive sprites with the same texture, blend mode and shader
+ *	parameters are grouped. Each group is drawn with a single draw call, so
+ *	sprites which share a texture atlas are drawn at once. A sprite never
+ *	joins an earlier group, so all sprites are drawn in the order they were
+ *	added.
+ *	Brightness is multiplied into the vertices' color, so sprites with
+ *	different brightness share a group. This is exact as long as the
+ *	saturation is not clamped (min 0, max 1). Otherwise brightness and
+ *	saturation are passed as shader parameters, so those sprites are
+ *	grouped by all three values.
+ *	The batch keeps its memory when cleared, so it can be refilled each
+ *	frame without reallocations.
+ */
+class SpriteBatch {
+  public:
+	struct Batch {
+		sf::Texture const * texture;
+		sf::BlendMode blend;
+		float brightness, min_saturation, max_saturation;
+		sf::VertexArray vertices;
+
+		Batch();
+	};
+
+  private:
+	std::vector<Batch> pool;
+	std::size_t num_batches, num_sprites;
+
+  public:
+	SpriteBatch();
+
+	/// Remove all sprites but keep the allocated memory
+	void clear();
+
+	/// Add a sprite to the batch
+	/**
+	 *	The sprite is appended to the most recent group if possible.
+	 *	Otherwise a new group is started. Sprites without a texture are
+	 *	ignored.
+	 *
+	 *	@param sprite Sprite to add
+	 *	@param matrix Transformation applied on top of the sprite's
+	 *	@param brightness Brightness within [0, 1]
+	 *	@param min_saturation Lower bound of the color channels
+	 *	@param max_saturation Upper bound of the color channels
+	 *	@param blend Blend mode to draw the sprite with
+	 */
+	void add(sf::Sprite const & sprite, sf::Transform const & matrix,
+		float brightness=1.f, float min_saturation=0.f,
+		float max_saturation=1.f, sf::BlendMode const & blend=sf::BlendAlpha);
+
+	/// Query number of groups
+	std::size_t size() const;
+
+	/// Query number of sprites added since the last clear
+	std::size_t getNumSprites() const;
+
+	/// Query a group in drawing order
+	/**
+	 *	@pre i < size()
+	 *	@param i Index of the group
+	 */
+	Batch const & operator[](std::size_t i) const;
+
+	/// Draw all groups
+	/**
+	 *	If a shader is given, its `brightness`, `min_saturation`,
+	 *	`max_saturation` and `texture` parameters are set per group.
+	 *
+	 *	@param target RenderTarget to draw to
+	 *	@param shader Optional shader to draw with
+	 *	@return number of draw calls
+	 */
+	std::size_t draw(sf::RenderTarget& target, sf::Shader* shader=nullptr) const;
+};
+
+}  // ::utils
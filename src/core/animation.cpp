@@ -5,12 +5,15 @@
 
 namespace core {
 
-AnimationSystem::AnimationSystem(LogContext& log, std::size_t max_objects)
+AnimationSystem::AnimationSystem(LogContext& log, std::size_t max_objects,
+	utils::JobSystem* jobs)
 	// Event API
 	: utils::EventListener<AnimationEvent>{}
 	, utils::EventSender<AnimationEvent>{}  // Component API
 	, AnimationManager{max_objects}
-	, context{log, *this, *this} {}
+	, context{log, *this, *this}
+	, jobs{jobs}
+	, chunks{} {}
 
 void AnimationSystem::handle(AnimationEvent const& event) {
 	if (!has(event.actor)) {
@@ -69,8 +72,11 @@ void AnimationSystem::handle(AnimationEvent const& event) {
 void AnimationSystem::update(sf::Time const& elapsed) {
 	dispatch<AnimationEvent>(*this);
 
-	for (auto& data : *this) {
-		animation_impl::update(context, data, elapsed);
+	if (jobs != nullptr && size() > animation_impl::CHUNK_SIZE) {
+		animation_impl::updateParallel(
+			context, *jobs, chunks, begin(), end(), elapsed);
+	} else {
+		animation_impl::updateRange(context, begin(), end(), elapsed);
 	}
 
 	propagate<AnimationEvent>();
@@ -80,12 +86,17 @@ void AnimationSystem::update(sf::Time const& elapsed) {
 
 namespace animation_impl {
 
+std::size_t const CHUNK_SIZE = 256u;
+
 Context::Context(LogContext& log, AnimationSender& animation_sender,
 	AnimationManager& animation_manager)
 	: log{log}
 	, animation_sender{animation_sender}
 	, animation_manager{animation_manager} {}
 
+Chunk::Chunk()
+	: animation_sender{} {}
+
 // ---------------------------------------------------------------------------
 
 void trigger(Context& context, AnimationData& data, AnimationAction action) {
@@ -187,6 +198,37 @@ void update(Context& context, AnimationData& data, sf::Time const& elapsed) {
 					   light_intensity_updated || light_radius_updated;
 }
 
+void updateRange(Context& context, AnimationManager::iterator begin,
+	AnimationManager::iterator end, sf::Time const& elapsed) {
+	for (auto i = begin; i != end; ++i) {
+		update(context, *i, elapsed);
+	}
+}
+
+void updateParallel(Context& context, utils::JobSystem& jobs,
+	std::vector<Chunk>& chunks, AnimationManager::iterator begin,
+	AnimationManager::iterator end, sf::Time const& elapsed) {
+	auto n = static_cast<std::size_t>(end - begin);
+	chunks.resize((n + CHUNK_SIZE - 1u) / CHUNK_SIZE);
+
+	jobs.run(chunks.size(), [&](std::size_t i) {
+		auto& chunk = chunks[i];
+		Context local{context.log, chunk.animation_sender,
+			context.animation_manager};
+		auto first = begin + i * CHUNK_SIZE;
+		auto last = (i + 1u) * CHUNK_SIZE < n ? first + CHUNK_SIZE : end;
+		updateRange(local, first, last, elapsed);
+	});
+
+	// merge chunks in order
+	for (auto& chunk : chunks) {
+		for (auto const& event : chunk.animation_sender.data()) {
+			context.animation_sender.send(event);
+		}
+		chunk.animation_sender.clear();
+	}
+}
+
 void onActionFinished(Context& context, AnimationData& data) {
 	if (data.current == AnimationAction::Die) {
 		// stop everything and stay at last dying frame
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <utils/algorithm.hpp>
 #include <utils/assert.hpp>
 #include <core/collision.hpp>
@@ -9,20 +11,136 @@ namespace collision_impl {
 
 float const REGULAR_COLLISION_RADIUS = 0.5f;
 float const MAX_PROJECTILE_RADIUS = 0.5f;
+unsigned int const BROADPHASE_BUCKET_SIZE = 4u;
+float const SWEEP_STEP = 0.25f;
+float const SWEEP_MARGIN = 1.f;
+// note: a moving collider is bucketed at its source or target tile
+float const BROADPHASE_SLACK = 1.5f;
+
+// ---------------------------------------------------------------------------
+
+Broadphase::Broadphase()
+	: scenes{}
+	, entries{} {}
+
+Broadphase::Grid& Broadphase::getGrid(Dungeon const& dungeon) {
+	if (scenes.size() <= dungeon.id) {
+		scenes.resize(dungeon.id + 1u);
+	}
+	auto& grid = scenes[dungeon.id];
+	auto scene_size = dungeon.getSize();
+	if (grid.scene_size != scene_size) {
+		// scene was (re)created: drop all previous entries
+		for (auto i = entries.begin(); i != entries.end();) {
+			if (i->second.scene == dungeon.id) {
+				i = entries.erase(i);
+			} else {
+				++i;
+			}
+		}
+		grid.scene_size = scene_size;
+		grid.size.x = (scene_size.x + BROADPHASE_BUCKET_SIZE - 1u) /
+					  BROADPHASE_BUCKET_SIZE;
+		grid.size.y = (scene_size.y + BROADPHASE_BUCKET_SIZE - 1u) /
+					  BROADPHASE_BUCKET_SIZE;
+		grid.buckets.assign(grid.size.x * grid.size.y, Bucket{});
+	}
+	return grid;
+}
+
+void Broadphase::erase(Entry const& entry, ObjectID id) {
+	if (entry.scene >= scenes.size()) {
+		return;
+	}
+	auto& buckets = scenes[entry.scene].buckets;
+	if (entry.bucket < buckets.size()) {
+		utils::pop(buckets[entry.bucket], id);
+	}
+}
+
+void Broadphase::update(
+	ObjectID id, Dungeon const& dungeon, sf::Vector2f const& pos) {
+	auto& grid = getGrid(dungeon);
+	ASSERT(grid.size.x > 0u && grid.size.y > 0u);
+	// note: positions are clamped to the scene's border buckets
+	auto x = static_cast<unsigned int>(std::max(0.f, pos.x)) /
+			 BROADPHASE_BUCKET_SIZE;
+	auto y = static_cast<unsigned int>(std::max(0.f, pos.y)) /
+			 BROADPHASE_BUCKET_SIZE;
+	x = std::min(x, grid.size.x - 1u);
+	y = std::min(y, grid.size.y - 1u);
+	Entry next{dungeon.id, x + y * grid.size.x};
+
+	auto i = entries.find(id);
+	if (i != entries.end()) {
+		if (i->second.scene == next.scene && i->second.bucket == next.bucket) {
+			// object stays inside its bucket
+			return;
+		}
+		erase(i->second, id);
+		i->second = next;
+	} else {
+		entries.emplace(id, next);
+	}
+	grid.buckets[next.bucket].push_back(id);
+}
+
+void Broadphase::remove(ObjectID id) {
+	auto i = entries.find(id);
+	if (i == entries.end()) {
+		return;
+	}
+	erase(i->second, id);
+	entries.erase(i);
+}
+
+void Broadphase::query(Dungeon const& dungeon, sf::Vector2f const& pos,
+	float radius, std::vector<ObjectID>& result) const {
+	if (dungeon.id >= scenes.size()) {
+		return;
+	}
+	auto const& grid = scenes[dungeon.id];
+	if (grid.scene_size != dungeon.getSize() || grid.buckets.empty()) {
+		// scene is not tracked (yet)
+		return;
+	}
+	// determine touched buckets (clamped to the scene)
+	auto toBucket = [](float value, unsigned int size) {
+		auto i = static_cast<int>(std::floor(value)) /
+				 static_cast<int>(BROADPHASE_BUCKET_SIZE);
+		return static_cast<unsigned int>(
+			std::max(0, std::min(i, static_cast<int>(size) - 1)));
+	};
+	auto min_x = toBucket(pos.x - radius, grid.size.x);
+	auto max_x = toBucket(pos.x + radius, grid.size.x);
+	auto min_y = toBucket(pos.y - radius, grid.size.y);
+	auto max_y = toBucket(pos.y + radius, grid.size.y);
+	for (auto y = min_y; y <= max_y; ++y) {
+		for (auto x = min_x; x <= max_x; ++x) {
+			auto const& bucket = grid.buckets[x + y * grid.size.x];
+			result.insert(result.end(), bucket.begin(), bucket.end());
+		}
+	}
+}
+
+std::size_t Broadphase::size() const {
+	return entries.size();
+}
 
 // ---------------------------------------------------------------------------
 
 Context::Context(LogContext& log, CollisionSender& collision_sender,
 	MoveSender& move_sender, TeleportSender& teleport_sender,
 	CollisionManager& collision_manager, DungeonSystem& dungeon_system,
-	MovementManager const& movement_manager)
+	MovementManager const& movement_manager, Broadphase& broadphase)
 	: log{log}
 	, collision_sender{collision_sender}
 	, move_sender{move_sender}
 	, teleport_sender{teleport_sender}
 	, collision_manager{collision_manager}
 	, dungeon_system{dungeon_system}
-	, movement_manager{movement_manager} {}
+	, movement_manager{movement_manager}
+	, broadphase{broadphase} {}
 
 // ---------------------------------------------------------------------------
 
@@ -39,6 +157,7 @@ void updateCollisionMap(
 	bool found = utils::pop(source.entities, data.id);
 	ASSERT(found);
 	target.entities.push_back(data.id);
+	dungeon.touch();
 }
 
 void onTileLeft(
@@ -56,7 +175,8 @@ void onTileLeft(
 	// perform collision check only for regular objects
 	if (!data.is_projectile) {
 		// check for terrain collision
-		bool tile_collision = checkTileCollision(cell);
+		bool tile_collision = checkTileCollision(
+			dungeon.getTerrain(move_data.target));
 		std::vector<ObjectID> colliders;
 		if (!tile_collision) {
 			// check for object collision if no tile collision occured
@@ -89,7 +209,7 @@ void onTileLeft(
 }
 
 void onTileReached(
-	Context& context, CollisionData const& data, MoveEvent const& event) {
+	Context& context, CollisionData& data, MoveEvent const& event) {
 	ASSERT(context.movement_manager.has(data.id));
 	auto const& move_data = context.movement_manager.query(data.id);
 	if (move_data.scene == 0u) {
@@ -97,12 +217,18 @@ void onTileReached(
 		return;
 	}
 
-	ASSERT(context.dungeon_system[move_data.scene].has(event.target));
-	auto& cell = context.dungeon_system[move_data.scene].getCell(event.target);
+	auto const& dungeon = context.dungeon_system[move_data.scene];
+	ASSERT(dungeon.has(event.target));
 
 	if (data.is_projectile) {
 		// test for bullet's tile collision
-		if (checkTileCollision(cell)) {
+		if (checkTileCollision(dungeon.getTerrain(event.target))) {
+			// hit all objects passed since the last check
+			// note: positions of the last check are kept, so the next check
+			// sweeps the same path but ignores these objects
+			std::vector<ObjectID> candidates, objects;
+			queryBullet(context, data, candidates, objects);
+			onBulletHit(context, data, objects);
 			// propagate bullet's tile collision
 			CollisionEvent coll;
 			coll.actor = data.id;
@@ -128,6 +254,15 @@ void onBulletCheck(Context& context, CollisionData& data) {
 	// check for closest target
 	auto objects = checkBulletCollision(context.collision_manager,
 		context.movement_manager, context.dungeon_system, data);
+	onBulletHit(context, data, objects);
+}
+
+bool isIgnored(CollisionData const& data, ObjectID id) {
+	return std::binary_search(data.ignore.begin(), data.ignore.end(), id);
+}
+
+void onBulletHit(Context& context, CollisionData& data,
+	std::vector<ObjectID> const& objects) {
 	for (auto id : objects) {
 		// propagate collision
 		CollisionEvent event;
@@ -135,17 +270,185 @@ void onBulletCheck(Context& context, CollisionData& data) {
 		event.collider = id;
 		event.reset = false;
 		context.collision_sender.send(event);
+
+		// ignore object for future checks
+		auto i = std::lower_bound(data.ignore.begin(), data.ignore.end(), id);
+		if (i == data.ignore.end() || *i != id) {
+			data.ignore.insert(i, id);
+		}
+	}
+}
+
+float getSweptDistance(sf::Vector2f const& from, sf::Vector2f const& to,
+	sf::Vector2f const& point) {
+	auto dir = to - from;
+	auto length = dir.x * dir.x + dir.y * dir.y;
+	if (length == 0.f) {
+		return utils::distance(from, point);
+	}
+	// project point onto the segment
+	auto delta = point - from;
+	auto t = (delta.x * dir.x + delta.y * dir.y) / length;
+	t = std::max(0.f, std::min(1.f, t));
+	return utils::distance(from + t * dir, point);
+}
+
+sf::Vector2f clipSweep(Dungeon const& dungeon, sf::Vector2f const& from,
+	sf::Vector2f const& to) {
+	auto dir = to - from;
+	auto length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+	auto steps = std::max(1, static_cast<int>(std::ceil(length / SWEEP_STEP)));
+	auto last = from;
+	for (int i = 0; i <= steps; ++i) {
+		auto sample = from + (static_cast<float>(i) / steps) * dir;
+		// note: tile centers are located at integral positions
+		auto x = std::floor(sample.x + 0.5f);
+		auto y = std::floor(sample.y + 0.5f);
+		if (x < 0.f || y < 0.f) {
+			break;
+		}
+		auto terrain = dungeon.tryGetTerrain(sf::Vector2u{
+			static_cast<unsigned int>(x), static_cast<unsigned int>(y)},
+			Terrain::Void);
+		if (checkTileCollision(terrain)) {
+			break;
+		}
+		last = sample;
+	}
+	return last;
+}
+
+void syncBroadphase(Context& context, ObjectID id) {
+	if (!context.collision_manager.has(id) ||
+		context.collision_manager.query(id).is_projectile ||
+		!context.movement_manager.has(id)) {
+		context.broadphase.remove(id);
+		return;
+	}
+	auto const& move_data = context.movement_manager.query(id);
+	if (move_data.scene == 0u) {
+		// object isn't located at any scene
+		context.broadphase.remove(id);
+		return;
+	}
+	auto const& dungeon = context.dungeon_system[move_data.scene];
+	context.broadphase.update(id, dungeon, move_data.pos);
+}
+
+void touchScene(Context& context, ObjectID id) {
+	if (!context.movement_manager.has(id)) {
+		return;
+	}
+	auto const& move_data = context.movement_manager.query(id);
+	if (move_data.scene == 0u) {
+		// object isn't located at any scene
+		return;
+	}
+	context.dungeon_system[move_data.scene].touch();
+}
+
+void queryBullet(Context const& context, CollisionData const& data,
+	std::vector<ObjectID>& candidates, std::vector<ObjectID>& objects) {
+	ASSERT(data.is_projectile);
+	auto const& move_data = context.movement_manager.query(data.id);
+	if (move_data.scene == 0u) {
+		// bullet has already been vanished
+		return;
+	}
+	auto const& dungeon = context.dungeon_system[move_data.scene];
+
+	// determine path since last check
+	auto swept = data.last_scene == move_data.scene;
+	auto from = move_data.pos;
+	if (swept) {
+		from = data.last_pos;
+	}
+	auto to = clipSweep(dungeon, from, move_data.pos);
+	// determine part of the interval until the path was clipped
+	auto ratio = 1.f;
+	auto length = utils::distance(from, move_data.pos);
+	if (length > 0.f) {
+		ratio = std::sqrt(utils::distance(from, to) / length);
+	}
+
+	// query all objects near the path
+	// note: the margin covers the colliders' movement since the last check,
+	// the slack covers their movement since their last move event
+	auto distance = data.radius + REGULAR_COLLISION_RADIUS;
+	auto center = 0.5f * (from + to);
+	auto half = std::sqrt(utils::distance(from, to)) * 0.5f;
+	candidates.clear();
+	context.broadphase.query(dungeon, center,
+		half + distance + SWEEP_MARGIN + BROADPHASE_SLACK, candidates);
+	distance *= distance;  // using squared distances
+
+	for (auto other : candidates) {
+		if (isIgnored(data, other)) {
+			// object was already hit by this bullet
+			continue;
+		}
+		if (!context.movement_manager.has(other)) {
+			continue;
+		}
+		auto const& other_move = context.movement_manager.query(other);
+		if (other_move.scene != move_data.scene) {
+			// object was vanished or teleported without a move event
+			continue;
+		}
+		// interpolate collider's movement along the bullet's path
+		auto const& other_data = context.collision_manager.query(other);
+		auto const& other_pos = other_move.pos;
+		auto other_from = other_pos;
+		if (swept && other_data.last_scene == move_data.scene) {
+			other_from = other_data.last_pos;
+		}
+		auto other_to = other_from + ratio * (other_pos - other_from);
+		// test bullet's path relative to the collider
+		if (getSweptDistance(from - other_from, to - other_to, {}) <=
+			distance) {
+			objects.push_back(other);
+		}
+	}
+}
+
+void checkBullets(Context& context) {
+	auto& manager = context.collision_manager;
+	auto has_bullets = std::any_of(manager.begin(), manager.end(),
+		[](CollisionData const& data) { return data.is_projectile; });
+	if (!has_bullets) {
+		// nothing to do
+		return;
+	}
+
+	// note: buffers are shared by all bullets
+	std::vector<ObjectID> candidates, objects;
+	for (auto& data : manager) {
+		if (!data.is_projectile) {
+			continue;
+		}
+		objects.clear();
+		queryBullet(context, data, candidates, objects);
+		onBulletHit(context, data, objects);
+	}
+
+	// remember positions for next sweep
+	// note: colliders are needed to interpolate their movement
+	for (auto& data : manager) {
+		if (!context.movement_manager.has(data.id)) {
+			continue;
+		}
+		auto const& move_data = context.movement_manager.query(data.id);
+		data.last_pos = move_data.pos;
+		data.last_scene = move_data.scene;
 	}
-	// ignore objects for future checks
-	utils::append(data.ignore, objects);
 }
 
 }  // ::collision_impl
 
 // ---------------------------------------------------------------------------
 
-bool checkTileCollision(DungeonCell const& cell) {
-	return cell.terrain != Terrain::Floor;
+bool checkTileCollision(Terrain terrain) {
+	return terrain != Terrain::Floor;
 }
 
 std::vector<ObjectID> checkObjectCollision(CollisionManager const& manager,
@@ -183,7 +486,7 @@ std::vector<ObjectID> checkBulletCollision(CollisionManager const& collision,
 	ASSERT(data.is_projectile);
 	std::vector<ObjectID> objects;
 
-	auto move_data = movement.query(data.id);
+	auto const& move_data = movement.query(data.id);
 	if (move_data.scene == 0u) {
 		// bullet has already been vanished
 		return objects;
@@ -217,7 +520,7 @@ std::vector<ObjectID> checkBulletCollision(CollisionManager const& collision,
 					// bullets never collide each other
 					continue;
 				}
-				if (utils::contains(data.ignore, other)) {
+				if (collision_impl::isIgnored(data, other)) {
 					// object was already hit by this bullet
 					continue;
 				}
@@ -242,7 +545,21 @@ CollisionSystem::CollisionSystem(LogContext& log, std::size_t max_objects, Dunge
 	, utils::EventSender<CollisionEvent, MoveEvent, TeleportEvent>{}  // Component API
 	, CollisionManager{max_objects}
 	, passed{sf::Time::Zero}
-	, context{log, *this, *this, *this, *this, dungeon, movement_manager} {}
+	, interval{sf::milliseconds(static_cast<sf::Int32>(MAX_FRAMETIME_MS))}
+	, broadphase{}
+	, context{log, *this, *this, *this, *this, dungeon, movement_manager,
+		  broadphase} {}
+
+void CollisionSystem::onSpawned(CollisionData& data) {
+	// note: objects are spawned without a move event
+	collision_impl::syncBroadphase(context, data.id);
+	collision_impl::touchScene(context, data.id);
+}
+
+void CollisionSystem::onReleased(CollisionData const& data) {
+	broadphase.remove(data.id);
+	collision_impl::touchScene(context, data.id);
+}
 
 void CollisionSystem::handle(MoveEvent const& event) {
 	if (!has(event.actor)) {
@@ -250,7 +567,7 @@ void CollisionSystem::handle(MoveEvent const& event) {
 		// note: object might have been deleted
 		return;
 	}
-	auto const& data = query(event.actor);
+	auto& data = query(event.actor);
 
 	switch (event.type) {
 		case MoveEvent::Left:
@@ -261,18 +578,30 @@ void CollisionSystem::handle(MoveEvent const& event) {
 			collision_impl::onTileReached(context, data, event);
 			break;
 	}
+	if (!data.is_projectile) {
+		collision_impl::syncBroadphase(context, data.id);
+	}
+}
+
+void CollisionSystem::setCheckInterval(sf::Time const& value) {
+	ASSERT(value > sf::Time::Zero);
+	interval = value;
 }
 
 void CollisionSystem::update(sf::Time const& elapsed) {
+	notifySpawned();
+
 	dispatch<MoveEvent>(*this);
+	// note: teleport triggers move objects without passing this system
+	for (auto const& event : utils::SingleEventSender<TeleportEvent>::data()) {
+		collision_impl::syncBroadphase(context, event.actor);
+	}
 
 	passed += elapsed;
-	if (passed.asMilliseconds() >= MAX_FRAMETIME_MS) {
-		passed -= sf::milliseconds(static_cast<unsigned int>(MAX_FRAMETIME_MS));
+	if (passed >= interval) {
+		passed -= interval;
 		// test for bullets' collisions
-		for (auto& data : *this) {
-			collision_impl::onBulletCheck(context, data);
-		}
+		collision_impl::checkBullets(context);
 	}
 
 	propagate<CollisionEvent>();
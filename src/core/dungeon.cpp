@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <utils/assert.hpp>
 
 #include <core/dungeon.hpp>
@@ -5,15 +6,219 @@
 namespace core {
 
 BaseCell::BaseCell()
-	: terrain{Terrain::Void}
-	, tile{}
-	, trigger{nullptr}
+	: trigger{nullptr} {
+}
+
+RenderCell::RenderCell()
+	: tile{}
 	, ambiences{} {
 }
 
 // ---------------------------------------------------------------------------
 
-DungeonSystem::DungeonSystem() : scenes{} {}
+RenderSnapshot::Tile::Tile()
+	: x{0u}
+	, y{0u}
+	, shading{0u}
+	, alpha{255u}
+	, has_edges{false}
+	, valid{false} {
+}
+
+RenderSnapshot::Ambience::Ambience()
+	: cell{}
+	, texture{nullptr}
+	, position{}
+	, origin{}
+	, rotation{0.f}
+	, color{sf::Color::White} {
+}
+
+RenderSnapshot::RenderSnapshot()
+	: tiles{}
+	, ambiences{} {
+}
+
+void RenderSnapshot::add(sf::Vector2u const & cell, sf::Sprite const & sprite) {
+	ASSERT(sprite.getTexture() != nullptr);
+	ambiences.emplace_back();
+	auto& ambience = ambiences.back();
+	ambience.cell = cell;
+	ambience.texture = sprite.getTexture();
+	ambience.position = sprite.getPosition();
+	ambience.origin = sprite.getOrigin();
+	ambience.rotation = sprite.getRotation();
+	ambience.color = sprite.getColor();
+}
+
+std::size_t RenderSnapshot::getMemoryUsage() const {
+	return tiles.capacity() * sizeof(Tile)
+		+ ambiences.capacity() * sizeof(Ambience);
+}
+
+// ---------------------------------------------------------------------------
+
+namespace dungeon_impl {
+
+unsigned int const TERRAIN_CHUNK_SIZE = 16u;
+
+void takeSnapshot(Dungeon const & dungeon, RenderSnapshot& snapshot) {
+	ASSERT(dungeon.hasColdCells());
+	auto const size = dungeon.getSize();
+	auto const tile_size = sf::Vector2u{dungeon.getTileSize()};
+	snapshot.tiles.clear();
+	snapshot.ambiences.clear();
+	snapshot.tiles.resize(size.x * size.y);
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < size.y; ++pos.y) {
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			auto const & cell = dungeon.getColdCell(pos);
+			for (auto const & sprite: cell.ambiences) {
+				snapshot.add(pos, sprite);
+			}
+			if (cell.tile.vertices.empty()) {
+				// tile was never refreshed
+				continue;
+			}
+			auto& tile = snapshot.tiles[pos.x + pos.y * size.x];
+			auto offset = cell.tile.getOffset(tile_size);
+			ASSERT(offset.x <= 0xFFFFu && offset.y <= 0xFFFFu);
+			tile.x = static_cast<std::uint16_t>(offset.x);
+			tile.y = static_cast<std::uint16_t>(offset.y);
+			tile.shading = cell.tile.getShading();
+			tile.alpha = cell.tile.vertices[0].color.a;
+			tile.has_edges = !cell.tile.edges.empty();
+			tile.valid = true;
+		}
+	}
+}
+
+void applySnapshot(Dungeon& dungeon, RenderSnapshot const & snapshot) {
+	ASSERT(dungeon.hasColdCells());
+	auto const size = dungeon.getSize();
+	auto const tile_size = sf::Vector2u{dungeon.getTileSize()};
+	ASSERT(snapshot.tiles.size() == size.x * size.y);
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < size.y; ++pos.y) {
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			auto const & tile = snapshot.tiles[pos.x + pos.y * size.x];
+			if (!tile.valid) {
+				continue;
+			}
+			auto& target = dungeon.getColdCell(pos).tile;
+			target.refresh(pos, tile_size, {tile.x, tile.y}, tile_size,
+				tile.shading, tile.has_edges);
+			for (auto& v: target.vertices) {
+				v.color.a = tile.alpha;
+			}
+		}
+	}
+	for (auto const & ambience: snapshot.ambiences) {
+		ASSERT(ambience.texture != nullptr);
+		auto& target = dungeon.getColdCell(ambience.cell).ambiences;
+		target.emplace_back(*ambience.texture);
+		auto& sprite = target.back();
+		sprite.setOrigin(ambience.origin);
+		sprite.setPosition(ambience.position);
+		sprite.setRotation(ambience.rotation);
+		sprite.setColor(ambience.color);
+	}
+}
+
+}  // ::dungeon_impl
+
+// ---------------------------------------------------------------------------
+
+TerrainChunk::TerrainChunk()
+	: terrain{}
+	, dirty{true} {
+	for (auto& pair: terrain) {
+		pair.second.setPrimitiveType(sf::Triangles);
+	}
+}
+
+TerrainCache::TerrainCache(sf::Vector2u const & scene_size)
+	: chunks{}
+	, num_chunks{} {
+	auto const n = dungeon_impl::TERRAIN_CHUNK_SIZE;
+	num_chunks.x = (scene_size.x + n - 1u) / n;
+	num_chunks.y = (scene_size.y + n - 1u) / n;
+	chunks.resize(num_chunks.x * num_chunks.y);
+}
+
+sf::Vector2u TerrainCache::getNumChunks() const {
+	return num_chunks;
+}
+
+sf::Vector2u TerrainCache::getChunkPos(sf::Vector2u const & pos) const {
+	auto const n = dungeon_impl::TERRAIN_CHUNK_SIZE;
+	return {pos.x / n, pos.y / n};
+}
+
+void TerrainCache::invalidate(sf::Vector2u const & pos) {
+	auto chunk = getChunkPos(pos);
+	ASSERT(chunk.x < num_chunks.x);
+	ASSERT(chunk.y < num_chunks.y);
+	chunks[chunk.x + chunk.y * num_chunks.x].dirty = true;
+}
+
+void TerrainCache::invalidateAll() {
+	for (auto& chunk: chunks) {
+		for (auto& pair: chunk.terrain) {
+			// swap to release the memory
+			sf::VertexArray tmp{sf::Triangles};
+			std::swap(pair.second, tmp);
+		}
+		chunk.dirty = true;
+	}
+}
+
+std::size_t TerrainCache::update(Dungeon const & dungeon,
+	sf::Vector2u const & chunk) {
+	ASSERT(chunk.x < num_chunks.x);
+	ASSERT(chunk.y < num_chunks.y);
+	auto& data = chunks[chunk.x + chunk.y * num_chunks.x];
+	if (!data.dirty) {
+		return 0u;
+	}
+	std::size_t count{0u};
+	for (auto& pair: data.terrain) {
+		pair.second.clear();
+	}
+	auto const n = dungeon_impl::TERRAIN_CHUNK_SIZE;
+	auto const size = dungeon.getSize();
+	auto const last = sf::Vector2u{std::min((chunk.x + 1u) * n, size.x),
+		std::min((chunk.y + 1u) * n, size.y)};
+	sf::Vector2u pos;
+	for (pos.y = chunk.y * n; pos.y < last.y; ++pos.y) {
+		for (pos.x = chunk.x * n; pos.x < last.x; ++pos.x) {
+			auto terrain = dungeon.getTerrain(pos);
+			if (terrain == Terrain::Void) {
+				continue;
+			}
+			auto& array = data.terrain[terrain];
+			auto before = array.getVertexCount();
+			dungeon.getColdCell(pos).tile.fetchTile(array);
+			count += array.getVertexCount() - before;
+		}
+	}
+	data.dirty = false;
+	return count;
+}
+
+TerrainChunk const & TerrainCache::operator[](sf::Vector2u const & chunk) const {
+	ASSERT(chunk.x < num_chunks.x);
+	ASSERT(chunk.y < num_chunks.y);
+	return chunks[chunk.x + chunk.y * num_chunks.x];
+}
+
+// ---------------------------------------------------------------------------
+
+DungeonSystem::DungeonSystem()
+	: scenes{}
+	, snapshots{}
+	, terrains{} {
+}
 
 Dungeon& DungeonSystem::operator[](utils::SceneID scene_id) {
 	ASSERT(scene_id > 0u);
@@ -31,6 +236,66 @@ Dungeon const& DungeonSystem::operator[](utils::SceneID scene_id) const {
 	return *ptr;
 }
 
+void DungeonSystem::evict(utils::SceneID scene_id) {
+	auto& dungeon = (*this)[scene_id];
+	auto& snapshot = snapshots[scene_id - 1u];
+	if (snapshot != nullptr) {
+		// already evicted
+		return;
+	}
+	snapshot = std::make_unique<RenderSnapshot>();
+	dungeon_impl::takeSnapshot(dungeon, *snapshot);
+	dungeon.releaseColdCells();
+	terrains[scene_id - 1u].invalidateAll();
+}
+
+void DungeonSystem::restore(utils::SceneID scene_id) {
+	auto& dungeon = (*this)[scene_id];
+	auto& snapshot = snapshots[scene_id - 1u];
+	if (snapshot == nullptr) {
+		// already resident
+		return;
+	}
+	dungeon.allocateColdCells();
+	dungeon_impl::applySnapshot(dungeon, *snapshot);
+	snapshot = nullptr;
+	terrains[scene_id - 1u].invalidateAll();
+}
+
+bool DungeonSystem::isResident(utils::SceneID scene_id) const {
+	ASSERT(scene_id > 0u);
+	ASSERT(scene_id <= snapshots.size());
+	return snapshots[scene_id - 1u] == nullptr;
+}
+
+void DungeonSystem::addAmbience(utils::SceneID scene_id,
+	sf::Vector2u const & pos, sf::Sprite const & sprite) {
+	auto& dungeon = (*this)[scene_id];
+	ASSERT(dungeon.has(pos));
+	auto& snapshot = snapshots[scene_id - 1u];
+	if (snapshot != nullptr) {
+		snapshot->add(pos, sprite);
+	} else {
+		dungeon.getColdCell(pos).ambiences.push_back(sprite);
+	}
+}
+
+TerrainCache& DungeonSystem::getTerrain(utils::SceneID scene_id) {
+	ASSERT(scene_id > 0u);
+	ASSERT(scene_id <= terrains.size());
+	return terrains[scene_id - 1u];
+}
+
+std::size_t DungeonSystem::getSnapshotMemory() const {
+	std::size_t bytes{0u};
+	for (auto const & snapshot: snapshots) {
+		if (snapshot != nullptr) {
+			bytes += snapshot->getMemoryUsage();
+		}
+	}
+	return bytes;
+}
+
 DungeonSystem::container::const_iterator DungeonSystem::begin() const {
 	return scenes.begin();
 }
@@ -45,6 +310,8 @@ std::size_t DungeonSystem::size() const {
 
 void DungeonSystem::clear() {
 	scenes.clear();
+	snapshots.clear();
+	terrains.clear();
 }
 
 }  // ::core
@@ -8,7 +8,12 @@ ComponentData::ComponentData() : id{0u} {}
 // ---------------------------------------------------------------------------
 
 CollisionData::CollisionData()
-	: ComponentData{}, is_projectile{false}, radius{0.f} {}
+	: ComponentData{}
+	, is_projectile{false}
+	, radius{0.f}
+	, ignore{}
+	, last_pos{}
+	, last_scene{0u} {}
 
 FocusData::FocusData()
 	: ComponentData{}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <iterator>
+
 #include <utils/assert.hpp>
 #include <utils/algorithm.hpp>
 
@@ -13,7 +16,17 @@ FocusSystem::FocusSystem(LogContext& log, std::size_t max_objects, DungeonSystem
 	: utils::EventListener<InputEvent, MoveEvent>{}
 	, utils::EventSender<FocusEvent>{}  // Component API
 	, FocusManager{max_objects}
-	, context{log, *this, *this, dungeon, movement_manager} {}
+	, sight_index{}
+	, context{log, *this, *this, dungeon, movement_manager, sight_index} {}
+
+void FocusSystem::onSpawned(FocusData& data) {
+	// note: objects are spawned without a move event
+	focus_impl::syncIndex(context, data.id);
+}
+
+void FocusSystem::onReleased(FocusData const& data) {
+	sight_index.remove(data.id);
+}
 
 void FocusSystem::handle(InputEvent const& event) {
 	if (!has(event.actor)) {
@@ -41,6 +54,8 @@ void FocusSystem::handle(MoveEvent const& event) {
 }
 
 void FocusSystem::update(sf::Time const& elapsed) {
+	notifySpawned();
+
 	dispatch<MoveEvent>(*this);
 	dispatch<InputEvent>(*this);
 
@@ -51,14 +66,176 @@ void FocusSystem::update(sf::Time const& elapsed) {
 
 namespace focus_impl {
 
+SightIndex::SightIndex()
+	: scenes{}
+	, entries{} {}
+
+SightIndex::Lanes& SightIndex::getLanes(Dungeon const& dungeon) {
+	if (scenes.size() <= dungeon.id) {
+		scenes.resize(dungeon.id + 1u);
+	}
+	auto& lanes = scenes[dungeon.id];
+	auto size = dungeon.getSize();
+	if (lanes.size != size) {
+		// scene was (re)created: drop all previous entries
+		for (auto i = entries.begin(); i != entries.end();) {
+			if (i->second.scene == dungeon.id) {
+				i = entries.erase(i);
+			} else {
+				++i;
+			}
+		}
+		lanes.size = size;
+		auto num_diagonals = size.x + size.y - 1u;
+		lanes.lanes[Row].assign(size.y, Lane{});
+		lanes.lanes[Column].assign(size.x, Lane{});
+		lanes.lanes[Diagonal].assign(num_diagonals, Lane{});
+		lanes.lanes[AntiDiagonal].assign(num_diagonals, Lane{});
+	}
+	return lanes;
+}
+
+std::pair<std::size_t, unsigned int> SightIndex::locate(
+	sf::Vector2u const& size, sf::Vector2u const& pos, std::size_t family) {
+	switch (family) {
+		case Row:
+			return {pos.y, pos.x};
+		case Column:
+			return {pos.x, pos.y};
+		case Diagonal:
+			return {pos.x + size.y - 1u - pos.y, pos.x};
+		default:
+			return {pos.x + pos.y, pos.x};
+	}
+}
+
+void SightIndex::erase(Entry const& entry, ObjectID id, std::size_t family) {
+	if (entry.scene >= scenes.size()) {
+		return;
+	}
+	auto& lanes = scenes[entry.scene].lanes[family];
+	auto key = locate(scenes[entry.scene].size, entry.pos, family);
+	if (key.first >= lanes.size()) {
+		return;
+	}
+	auto& lane = lanes[key.first];
+	auto i = std::find(lane.begin(), lane.end(), std::make_pair(key.second, id));
+	if (i != lane.end()) {
+		lane.erase(i);
+	}
+}
+
+void SightIndex::insert(Entry const& entry, ObjectID id, std::size_t family) {
+	auto& lanes = scenes[entry.scene];
+	auto key = locate(lanes.size, entry.pos, family);
+	auto& lane = lanes.lanes[family][key.first];
+	// keep insertion order of objects at the same coordinate
+	auto i = std::upper_bound(lane.begin(), lane.end(), key.second,
+		[](unsigned int lhs, Lane::value_type const& rhs) {
+			return lhs < rhs.first;
+		});
+	lane.emplace(i, key.second, id);
+}
+
+void SightIndex::update(
+	ObjectID id, Dungeon const& dungeon, sf::Vector2u const& pos) {
+	ASSERT(dungeon.has(pos));
+	auto const& lanes = getLanes(dungeon);
+	Entry next{dungeon.id, pos};
+
+	auto i = entries.find(id);
+	if (i == entries.end()) {
+		for (std::size_t family = 0u; family < NumFamilies; ++family) {
+			insert(next, id, family);
+		}
+		entries.emplace(id, next);
+		return;
+	}
+
+	auto& prev = i->second;
+	if (prev.scene == next.scene && prev.pos == next.pos) {
+		// nothing changed
+		return;
+	}
+	for (std::size_t family = 0u; family < NumFamilies; ++family) {
+		if (prev.scene == next.scene &&
+			locate(lanes.size, prev.pos, family) ==
+				locate(lanes.size, next.pos, family)) {
+			// object stays at this lane
+			continue;
+		}
+		erase(prev, id, family);
+		insert(next, id, family);
+	}
+	prev = next;
+}
+
+void SightIndex::remove(ObjectID id) {
+	auto i = entries.find(id);
+	if (i == entries.end()) {
+		return;
+	}
+	for (std::size_t family = 0u; family < NumFamilies; ++family) {
+		erase(i->second, id, family);
+	}
+	entries.erase(i);
+}
+
+void SightIndex::prune(FocusManager const& focus_manager) {
+	for (auto i = entries.begin(); i != entries.end();) {
+		if (focus_manager.has(i->first)) {
+			++i;
+			continue;
+		}
+		for (std::size_t family = 0u; family < NumFamilies; ++family) {
+			erase(i->second, i->first, family);
+		}
+		i = entries.erase(i);
+	}
+}
+
+SightIndex::Lane const* SightIndex::getLane(Dungeon const& dungeon,
+	sf::Vector2u const& pos, sf::Vector2i const& dir,
+	unsigned int& coord) const {
+	ASSERT(dir.x != 0 || dir.y != 0);
+	if (dungeon.id >= scenes.size() || !dungeon.has(pos)) {
+		return nullptr;
+	}
+	auto const& lanes = scenes[dungeon.id];
+	if (lanes.size != dungeon.getSize()) {
+		// scene is not indexed (yet)
+		return nullptr;
+	}
+	std::size_t family;
+	if (dir.y == 0) {
+		family = Row;
+	} else if (dir.x == 0) {
+		family = Column;
+	} else if (dir.x == dir.y) {
+		family = Diagonal;
+	} else {
+		family = AntiDiagonal;
+	}
+	auto key = locate(lanes.size, pos, family);
+	coord = key.second;
+	return &lanes.lanes[family][key.first];
+}
+
+std::size_t SightIndex::size() const {
+	return entries.size();
+}
+
+// ---------------------------------------------------------------------------
+
 Context::Context(LogContext& log, FocusSender& focus_sender,
 	FocusManager& focus_manager, DungeonSystem& dungeon_system,
-	MovementManager const& movement_manager)
+	MovementManager const& movement_manager, SightIndex& sight_index)
 	: log{log}
 	, focus_sender{focus_sender}
 	, focus_manager{focus_manager}
 	, dungeon_system{dungeon_system}
-	, movement_manager{movement_manager} {}
+	, movement_manager{movement_manager}
+	, sight_index{sight_index} {}
 
 // ---------------------------------------------------------------------------
 
@@ -68,24 +245,22 @@ ObjectID traverseCells(Dungeon const& dungeon, sf::Vector2u pos,
 	int step = 0;
 	ObjectID found = 0u;
 	do {
-		try {
-			auto const& cell = dungeon.getCell(pos);
-			if (cell.terrain != core::Terrain::Floor) {
-				// cannot look through non-floor terrain
-				return found;
-			}
-			// search focusable object
-			for (auto other : cell.entities) {
-				if (handle(other, step)) {
-					// found suitable object
-					found = other;
-					break;
-				}
-			}
-		} catch (std::out_of_range const& e) {
+		if (!dungeon.has(pos)) {
 			// out of grid
 			break;
 		}
+		if (dungeon.getTerrain(pos) != core::Terrain::Floor) {
+			// cannot look through non-floor terrain
+			return found;
+		}
+		// search focusable object
+		for (auto other : dungeon.getCell(pos).entities) {
+			if (handle(other, step)) {
+				// found suitable object
+				found = other;
+				break;
+			}
+		}
 		if (found > 0u) {
 			// suitable object was already found!
 			break;
@@ -98,6 +273,90 @@ ObjectID traverseCells(Dungeon const& dungeon, sf::Vector2u pos,
 	return found;
 }
 
+namespace {
+
+template <typename Iterator>
+ObjectID traverseRange(Dungeon const& dungeon, Iterator begin, Iterator end,
+	sf::Vector2u const& pos, sf::Vector2i const& dir, int origin, int sign,
+	float depth, std::function<bool(ObjectID, int)> const& handle) {
+	int checked = 0;   // next step whose terrain wasn't checked yet
+	int visited = -1;  // step of the recently visited cell
+	for (auto i = begin; i != end; ++i) {
+		int step = sign * (static_cast<int>(i->first) - origin);
+		if (step > depth) {
+			break;
+		}
+		if (step == visited) {
+			// several objects at the same cell
+			continue;
+		}
+		// cannot look through non-floor terrain
+		for (; checked <= step; ++checked) {
+			auto terrain = dungeon.tryGetTerrain(
+				sf::Vector2u{sf::Vector2i{pos} + dir * checked},
+				core::Terrain::Void);
+			if (terrain != core::Terrain::Floor) {
+				return 0u;
+			}
+		}
+		// search suitable object in cell's order
+		visited = step;
+		auto const& cell =
+			dungeon.getCell(sf::Vector2u{sf::Vector2i{pos} + dir * step});
+		for (auto other : cell.entities) {
+			if (handle(other, step)) {
+				return other;
+			}
+		}
+	}
+	return 0u;
+}
+
+}  // ::anon
+
+ObjectID traverseLane(Dungeon const& dungeon, SightIndex const& index,
+	sf::Vector2u pos, sf::Vector2i const& dir, float depth,
+	std::function<bool(ObjectID, int)> handle) {
+	unsigned int coord;
+	auto lane = index.getLane(dungeon, pos, dir, coord);
+	if (lane == nullptr) {
+		return traverseCells(dungeon, pos, dir, depth, handle);
+	}
+	int sign = dir.x != 0 ? dir.x : dir.y;
+	int origin = static_cast<int>(coord);
+	if (sign > 0) {
+		// visit objects at coord or above in ascending order
+		auto first = std::lower_bound(lane->begin(), lane->end(), coord,
+			[](SightIndex::Lane::value_type const& lhs, unsigned int rhs) {
+				return lhs.first < rhs;
+			});
+		return traverseRange(
+			dungeon, first, lane->end(), pos, dir, origin, sign, depth, handle);
+	}
+	// visit objects at coord or below in descending order
+	auto last = std::upper_bound(lane->begin(), lane->end(), coord,
+		[](unsigned int lhs, SightIndex::Lane::value_type const& rhs) {
+			return lhs < rhs.first;
+		});
+	return traverseRange(dungeon, std::make_reverse_iterator(last),
+		lane->rend(), pos, dir, origin, sign, depth, handle);
+}
+
+void syncIndex(Context& context, ObjectID id) {
+	if (!context.movement_manager.has(id)) {
+		context.sight_index.remove(id);
+		return;
+	}
+	auto const& move_data = context.movement_manager.query(id);
+	if (move_data.scene == 0u) {
+		// object isn't located at any scene
+		context.sight_index.remove(id);
+		return;
+	}
+	auto const& dungeon = context.dungeon_system[move_data.scene];
+	context.sight_index.update(id, dungeon, move_data.target);
+}
+
 void setFocus(
 	Context const& context, FocusData& observer, FocusData* observed) {
 	// unfocus previously focused object
@@ -179,6 +438,7 @@ void onLook(Context const& context, FocusData& data, InputEvent const& event) {
 void onMove(Context& context, FocusData& data, MoveEvent const& event) {
 	ASSERT(context.movement_manager.has(data.id));
 	auto const& move_data = context.movement_manager.query(data.id);
+	syncIndex(context, data.id);
 	if (move_data.scene == 0u) {
 		// object has vanished yet
 		return;
@@ -204,8 +464,8 @@ void onMove(Context& context, FocusData& data, MoveEvent const& event) {
 			}
 
 			// track nearest observer (and maybe the actor's new focus)
-			traverseCells(dungeon, move_data.target, dir, MAX_SIGHT,
-				[&](ObjectID other, int distance) {
+			traverseLane(dungeon, context.sight_index, move_data.target, dir,
+				MAX_SIGHT, [&](ObjectID other, int distance) {
 					if (other == data.id || !context.focus_manager.has(other)) {
 						// shouldn't focus yourself - or an object that cannot
 						// be focused
@@ -227,8 +487,13 @@ void onMove(Context& context, FocusData& data, MoveEvent const& event) {
 	}
 
 	// renew observers
+	// note: sorted copies are searched to keep the notification order
+	auto old_sorted = old_observers;
+	auto new_sorted = new_observers;
+	std::sort(old_sorted.begin(), old_sorted.end());
+	std::sort(new_sorted.begin(), new_sorted.end());
 	for (auto other : old_observers) {
-		if (!utils::contains(new_observers, other)) {
+		if (!std::binary_search(new_sorted.begin(), new_sorted.end(), other)) {
 			if (!context.focus_manager.has(other)) {
 				// object was released
 				continue;
@@ -244,7 +509,7 @@ void onMove(Context& context, FocusData& data, MoveEvent const& event) {
 		}
 	}
 	for (auto other : new_observers) {
-		if (!utils::contains(old_observers, other)) {
+		if (!std::binary_search(old_sorted.begin(), old_sorted.end(), other)) {
 			auto& observer = context.focus_manager.query(other);
 			setFocus(context, observer, &data);
 		}
@@ -21,12 +21,50 @@ float const MOVEMENT_ACCURACY = 0.0001f;
 // to determine whether an object is centered on a cell or not
 float const CELL_CENTER_DIVERGENCE = 0.00001f;
 
+std::size_t const CHUNK_SIZE = 256u;
+
+PendingTrigger::PendingTrigger(ObjectID actor, utils::SceneID scene,
+	sf::Vector2u const& pos)
+	: actor{actor}
+	, scene{scene}
+	, pos{pos} {}
+
+Misplacement::Misplacement(ObjectID actor, sf::Vector2f const& pos,
+	sf::Vector2u const& source)
+	: actor{actor}
+	, pos{pos}
+	, source{source} {}
+
 Context::Context(LogContext& log, MoveSender& move_sender,
 	MovementManager& movement_manager, DungeonSystem& dungeon_system)
 	: log{log}
 	, move_sender{move_sender}
 	, movement_manager{movement_manager}
-	, dungeon_system{dungeon_system} {}
+	, dungeon_system{dungeon_system}
+	, triggers{nullptr}
+	, misplaced{nullptr} {}
+
+Chunk::Chunk()
+	: triggers{}
+	, misplaced{} {}
+
+ParallelBuffers::ParallelBuffers()
+	: chunks{}
+	, events{}
+	, reader{} {
+	events.bind(reader);
+}
+
+namespace {
+
+// passes published events on to a sender
+struct Forwarder {
+	MoveSender& sender;
+
+	void handle(MoveEvent const& event) { sender.send(event); }
+};
+
+}  // ::anon
 
 // ---------------------------------------------------------------------------
 
@@ -40,6 +78,63 @@ void updateRange(Context& context, MovementManager::iterator begin,
 	}
 }
 
+void updateParallel(Context& context, utils::JobSystem& jobs,
+	ParallelBuffers& buffers, MovementManager::iterator begin,
+	MovementManager::iterator end, sf::Time const& elapsed) {
+	auto n = static_cast<std::size_t>(end - begin);
+	auto& chunks = buffers.chunks;
+	chunks.resize((n + CHUNK_SIZE - 1u) / CHUNK_SIZE);
+	buffers.events.resize(chunks.size());
+
+	jobs.run(chunks.size(), [&](std::size_t i) {
+		auto& chunk = chunks[i];
+		Context local{context.log, buffers.events[i],
+			context.movement_manager, context.dungeon_system};
+		local.triggers = &chunk.triggers;
+		local.misplaced = &chunk.misplaced;
+		auto first = begin + i * CHUNK_SIZE;
+		auto last = (i + 1u) * CHUNK_SIZE < n ? first + CHUNK_SIZE : end;
+		updateRange(local, first, last, elapsed);
+	});
+
+	// merge chunks in order
+	buffers.events.publish();
+	Forwarder forward{context.move_sender};
+	buffers.reader.dispatch(forward);
+	for (auto& chunk : chunks) {
+		for (auto const& misplaced : chunk.misplaced) {
+			logMisplacement(
+				context, misplaced.actor, misplaced.pos, misplaced.source);
+		}
+		chunk.misplaced.clear();
+		for (auto const& pending : chunk.triggers) {
+			executeTrigger(context, pending.actor, pending.scene, pending.pos);
+		}
+		chunk.triggers.clear();
+	}
+}
+
+void executeTrigger(Context& context, ObjectID actor, utils::SceneID scene,
+	sf::Vector2u const& pos) {
+	auto& cell = context.dungeon_system[scene].getCell(pos);
+	if (cell.trigger == nullptr) {
+		return;
+	}
+	// note: this might stop the object
+	cell.trigger->execute(actor);
+	if (cell.trigger->isExpired()) {
+		// delete expired trigger
+		cell.trigger = nullptr;
+	}
+}
+
+void logMisplacement(Context& context, ObjectID actor, sf::Vector2f const& pos,
+	sf::Vector2u const& source) {
+	context.log.debug << "[Core/Movement] " << "Object #" << actor << " is located at "
+					  << pos << " but assigned to " << source
+					  << " instead of " << sf::Vector2u{pos} << "\n";
+}
+
 void start(Context& context, MovementData& data, InputEvent const& event) {
 	// apply direction for next move
 	data.next_move = event.move;
@@ -58,9 +153,12 @@ void moveToTarget(Context& context, MovementData& data) {
 
 	auto tmp = sf::Vector2u{data.pos};
 	if (tmp != source) {
-		context.log.debug << "[Core/Movement] " << "Object #" << data.id << " is located at "
-						  << data.pos << " but assigned to " << source
-						  << " instead of " << tmp << "\n";
+		if (context.misplaced != nullptr) {
+			// note: the log is not thread-safe, so log it later
+			context.misplaced->emplace_back(data.id, data.pos, source);
+		} else {
+			logMisplacement(context, data.id, data.pos, source);
+		}
 		ASSERT(utils::contains(dungeon.getCell(source).entities, data.id));
 	}
 
@@ -221,14 +319,14 @@ void interpolate(Context& context, MovementData& data, sf::Time const& elapsed)
 		context.move_sender.send(event);
 
 		// query and execute trigger
-		auto& cell = context.dungeon_system[data.scene].getCell(data.target);
-		if (cell.trigger != nullptr) {
-			// note: this might stop the object
-			cell.trigger->execute(data.id);
-			if (cell.trigger->isExpired()) {
-				// delete expired trigger
-				cell.trigger = nullptr;
+		if (context.triggers != nullptr) {
+			// triggers may touch other objects, so execute them later
+			auto const& cell = context.dungeon_system[data.scene].getCell(data.target);
+			if (cell.trigger != nullptr) {
+				context.triggers->emplace_back(data.id, data.scene, data.target);
 			}
+		} else {
+			executeTrigger(context, data.id, data.scene, data.target);
 		}
 
 		// stop movement
@@ -236,16 +334,36 @@ void interpolate(Context& context, MovementData& data, sf::Time const& elapsed)
 	}
 }
 
+sf::Vector2f predictPosition(MovementData const& data, sf::Time const& ahead) {
+	if (data.move == sf::Vector2i{} || ahead <= sf::Time::Zero) {
+		return data.pos;
+	}
+	auto delta = data.max_speed * calcSpeedFactor(data) *
+		movement_impl::MOVEMENT_VELOCITY * ahead.asMicroseconds() / 1000.f;
+	auto step = data.pos + delta * sf::Vector2f{data.move};
+
+	// do not exceed target
+	auto target = sf::Vector2f{data.target};
+	auto rest = target - step;
+	if (rest.x * data.move.x + rest.y * data.move.y < 0.f) {
+		return target;
+	}
+	return step;
+}
+
 }  // ::movement_impl
 
 // ---------------------------------------------------------------------------
 
-MovementSystem::MovementSystem(LogContext& log, std::size_t max_objects, DungeonSystem& dungeon)
+MovementSystem::MovementSystem(LogContext& log, std::size_t max_objects,
+	DungeonSystem& dungeon, utils::JobSystem* jobs)
 	// Event API
 	: utils::EventListener<InputEvent, CollisionEvent>{}
 	, utils::EventSender<MoveEvent>{}  // Component API
 	, MovementManager{max_objects}
-	, context{log, *this, *this, dungeon} {}
+	, context{log, *this, *this, dungeon}
+	, jobs{jobs}
+	, buffers{} {}
 
 void MovementSystem::handle(InputEvent const& event) {
 	if (!has(event.actor)) {
@@ -273,7 +391,11 @@ void MovementSystem::update(sf::Time const& elapsed) {
 	dispatch<InputEvent>(*this);
 	dispatch<CollisionEvent>(*this);
 
-	updateRange(context, begin(), end(), elapsed);
+	if (jobs != nullptr && size() > movement_impl::CHUNK_SIZE) {
+		updateParallel(context, *jobs, buffers, begin(), end(), elapsed);
+	} else {
+		updateRange(context, begin(), end(), elapsed);
+	}
 
 	propagate<MoveEvent>();
 }
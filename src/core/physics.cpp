@@ -111,9 +111,9 @@ bool checkCollision(Context& context, PhysicsData const & data, sf::Vector2f con
 	}
 
 	ASSERT(context.dungeon_system[data.scene].has(tile_pos));
-	auto& cell = context.dungeon_system[data.scene].getCell(tile_pos);
+	auto terrain = context.dungeon_system[data.scene].getTerrain(tile_pos);
 
-	if (cell.terrain != Terrain::Floor) {
+	if (terrain != Terrain::Floor) {
 		// terrain collision detected!
 		event.collider = 0u;
 		event.pos = pos;
@@ -160,6 +160,7 @@ void interpolate(Context& context, PhysicsData& data, sf::Time const& elapsed) {
 			
 			utils::pop(src.entities, data.id);
 			dst.entities.push_back(data.id);
+			dungeon.touch();
 		}
 		
 		// apply movement
@@ -3,6 +3,7 @@
 #include <utils/assert.hpp>
 #include <utils/algorithm.hpp>
 
+#include <core/movement.hpp>
 #include <core/render.hpp>
 
 namespace core {
@@ -30,6 +31,10 @@ void RenderSystem::setGridColor(sf::Color color) {
 	context.grid_color = color;
 }
 
+void RenderSystem::setLookahead(sf::Time const& ahead) {
+	context.lookahead = ahead;
+}
+
 void RenderSystem::handle(SpriteEvent const& event) {
 	auto& data = query(event.actor);
 	switch (event.type) {
@@ -56,21 +61,39 @@ void RenderSystem::update(sf::Time const& elapsed) {
 
 void RenderSystem::cull() { render_impl::cullScenes(context); }
 
+render_impl::Stats const & RenderSystem::getStats() const {
+	return context.stats;
+}
+
 // ---------------------------------------------------------------------------
 
 namespace render_impl {
 
 CullingBuffer::CullingBuffer()
-	: terrain{}
+	: chunks{}
 	, objects{}
 	, ambiences{}
 	, edges{}
+	, edge_indices{}
 	, lights{}
+	, shadows{}
 	, highlights{}
-	, grid{sf::Lines} {
-	for (auto& pair : terrain) {
-		pair.second.setPrimitiveType(sf::Triangles);
-	}
+	, grid{sf::Lines}
+	, sprites{} {
+}
+
+Stats::Stats()
+	: chunks{0u}
+	, terrain_vertices{0u}
+	, objects{0u}
+	, rejected{0u}
+	, sprites{0u}
+	, batches{0u}
+	, draw_calls{0u}
+	, lights{0u}
+	, discarded{0u}
+	, edges{0u}
+	, light_edges{0u} {
 }
 
 Context::Context(LogContext& log, RenderManager& render_manager,
@@ -85,8 +108,10 @@ Context::Context(LogContext& log, RenderManager& render_manager,
 	, camera_system{camera_system}
 	, lighting_system{lighting_system}
 	, buffers{}
+	, stats{}
 	, grid_color{sf::Color::Transparent}
 	, cast_shadows{true}
+	, lookahead{}
 	, sprite_shader{} {
 	// setup sprite shader
 	sprite_shader.loadFromMemory(
@@ -196,9 +221,11 @@ void updateObject(Context& context, RenderData& data) {
 	ASSERT(move_data.scene > 0u);
 	auto const& dungeon = context.dungeon_system[move_data.scene];
 	// update transformation if necessary
-	if (move_data.has_changed) {
+	bool ahead = context.lookahead > sf::Time::Zero &&
+		move_data.move != sf::Vector2i{};
+	if (move_data.has_changed || ahead) {
 		float angle = getRotation(move_data.look);
-		auto screen_pos = dungeon.toScreen(move_data.pos);
+		auto screen_pos = getScreenPos(context, move_data, dungeon);
 		// modify transformation matrices
 		auto matrix = sf::Transform::Identity;
 		matrix.translate(screen_pos);
@@ -231,6 +258,15 @@ void updateObject(Context& context, RenderData& data) {
 	}
 }
 
+sf::Vector2f getScreenPos(Context const& context, MovementData const& move_data,
+	Dungeon const& dungeon) {
+	if (context.lookahead <= sf::Time::Zero) {
+		return dungeon.toScreen(move_data.pos);
+	}
+	return dungeon.toScreen(movement_impl::predictPosition(
+		move_data, context.lookahead));
+}
+
 void updateCameras(Context& context, sf::Time const& elapsed) {
 	// guarantee correct number of culling buffers
 	if (context.buffers.size() < context.camera_system.size()) {
@@ -253,9 +289,26 @@ void updateCameras(Context& context, sf::Time const& elapsed) {
 	}
 }
 
+void centerCameras(Context& context) {
+	std::vector<sf::Vector2f> positions;
+	for (auto& unique_ptr : context.camera_system) {
+		auto& camera = *unique_ptr;
+		ASSERT(!camera.objects.empty());
+		positions.clear();
+		for (auto id : camera.objects) {
+			auto const& move_data = context.movement_manager.query(id);
+			ASSERT(move_data.scene > 0u);
+			auto const& dungeon = context.dungeon_system[move_data.scene];
+			positions.push_back(getScreenPos(context, move_data, dungeon));
+		}
+		camera.bary_center = utils::camera_impl::getBaryCenter(positions);
+		camera.scene.setCenter(camera.bary_center);
+	}
+}
+
 // ---------------------------------------------------------------------------
 
-void cullAmbiences(CullingBuffer& buffer, DungeonCell const & cell) {
+void cullAmbiences(CullingBuffer& buffer, RenderCell const & cell) {
 	for (auto const & sprite: cell.ambiences) {
 		buffer.ambiences.push_back(&sprite);
 	}
@@ -266,7 +319,7 @@ void addEdges(Context const & context, RenderData const & data, std::vector<util
 	auto const& move_data = context.movement_manager.query(data.id);
 	ASSERT(move_data.scene > 0u);
 	auto const& dungeon = context.dungeon_system[move_data.scene];
-	auto pos = dungeon.toScreen(move_data.pos);
+	auto pos = getScreenPos(context, move_data, dungeon);
 	
 	for (auto cpy: data.edges) {
 		cpy.u += pos;
@@ -275,45 +328,207 @@ void addEdges(Context const & context, RenderData const & data, std::vector<util
 	}
 }
 
+bool isVisible(RenderData const & data, sf::FloatRect const & view) {
+	if (!data.legs.isVisible() && !data.torso.isVisible()) {
+		// no layer would be drawn
+		return false;
+	}
+	return data.legs.getBounds(data.legs_matrix).intersects(view)
+		|| data.torso.getBounds(data.torso_matrix).intersects(view);
+}
+
+void addShadowEdges(Context const & context, Dungeon const & dungeon,
+	std::vector<utils::Light> const & lights, std::vector<utils::Edge>& edges) {
+	auto const size = sf::Vector2i{dungeon.getSize()};
+	// determine cells covered by the shadow ranges (tiles are centered)
+	std::vector<sf::IntRect> ranges;
+	sf::Vector2i min{size}, max{-1, -1};
+	for (auto const & light : lights) {
+		if (!light.cast_shadow) {
+			continue;
+		}
+		auto range = utils::getShadowRange(light);
+		auto const delta = sf::Vector2f{range, range};
+		auto from = dungeon.fromScreen(light.pos - delta);
+		auto to = dungeon.fromScreen(light.pos + delta);
+		sf::Vector2i first{static_cast<int>(std::floor(from.x + 0.5f)),
+			static_cast<int>(std::floor(from.y + 0.5f))};
+		sf::Vector2i last{static_cast<int>(std::floor(to.x + 0.5f)),
+			static_cast<int>(std::floor(to.y + 0.5f))};
+		first.x = std::max(first.x, 0);
+		first.y = std::max(first.y, 0);
+		last.x = std::min(last.x, size.x - 1);
+		last.y = std::min(last.y, size.y - 1);
+		if (first.x > last.x || first.y > last.y) {
+			// shadow range is outside the scene
+			continue;
+		}
+		ranges.emplace_back(first, last - first + sf::Vector2i{1, 1});
+		min.x = std::min(min.x, first.x);
+		min.y = std::min(min.y, first.y);
+		max.x = std::max(max.x, last.x);
+		max.y = std::max(max.y, last.y);
+	}
+	if (ranges.empty()) {
+		return;
+	}
+	// collect edges of each cell once, although the ranges may overlap
+	auto const width = max.x - min.x + 1;
+	std::vector<bool> visited(width * (max.y - min.y + 1), false);
+	sf::Vector2u pos;
+	for (auto const & rect : ranges) {
+		for (int y = rect.top; y < rect.top + rect.height; ++y) {
+			for (int x = rect.left; x < rect.left + rect.width; ++x) {
+				auto i = (y - min.y) * width + (x - min.x);
+				if (visited[i]) {
+					continue;
+				}
+				visited[i] = true;
+				pos = sf::Vector2u{static_cast<unsigned int>(x),
+					static_cast<unsigned int>(y)};
+				// collect edges of the tile
+				for (auto const& edge : dungeon.getColdCell(pos).tile.edges) {
+					edges.push_back(edge);
+				}
+				// collect edges of objects
+				for (auto id : dungeon.getCell(pos).entities) {
+					auto const& data = context.render_manager.query(id);
+					if (!data.edges.empty()) {
+						addEdges(context, data, edges);
+					}
+				}
+			}
+		}
+	}
+}
+
+void cullLights(Context& context, CullingBuffer& buffer, Dungeon& dungeon,
+	sf::FloatRect const & view) {
+	auto tile_size = dungeon.getTileSize();
+	float scale = std::max(tile_size.x, tile_size.y);
+	// set padding to fetch all lights which might be visible
+	dungeon.setPadding({static_cast<unsigned int>(std::ceil(
+							utils::MAX_LIGHT_RADIUS / tile_size.x)),
+		static_cast<unsigned int>(std::ceil(
+			utils::MAX_LIGHT_RADIUS / tile_size.y))});
+	for (auto const& pos : dungeon) {
+		if (!dungeon.has(pos)) {
+			continue;
+		}
+		for (auto id : dungeon.getCell(pos).entities) {
+			auto const& data = context.render_manager.query(id);
+			if (data.light == nullptr) {
+				continue;
+			}
+			// copy and scale light
+			utils::Light light = *data.light;
+			light.radius *= scale;
+			// discard light if it does not influence the visible area
+			auto range = utils::getLightRange(light);
+			sf::FloatRect influence{light.pos - sf::Vector2f{range, range},
+				{2.f * range, 2.f * range}};
+			if (!influence.intersects(view)) {
+				++context.stats.discarded;
+				continue;
+			}
+			buffer.lights.push_back(std::move(light));
+			++context.stats.lights;
+		}
+	}
+	// reset padding
+	dungeon.setPadding({0u, 0u});
+
+	// cull and merge edges once, if shadowing enabled
+	if (context.cast_shadows) {
+		addShadowEdges(context, dungeon, buffer.lights, buffer.edges);
+		utils::mergeEdges(buffer.edges);
+		context.stats.edges += buffer.edges.size();
+	}
+	// refer each light to the merged edges near it
+	for (auto const & light : buffer.lights) {
+		utils::EdgeRange shadow;
+		shadow.first = buffer.edge_indices.size();
+		if (context.cast_shadows && light.cast_shadow) {
+			utils::selectEdges(light.pos, utils::getShadowRange(light),
+				buffer.edges, buffer.edge_indices);
+		}
+		shadow.last = buffer.edge_indices.size();
+		context.stats.light_edges += shadow.last - shadow.first;
+		buffer.shadows.push_back(shadow);
+	}
+}
+
+void cullTerrain(Context& context, CullingBuffer& buffer,
+	Dungeon const & dungeon) {
+	auto& cache = context.dungeon_system.getTerrain(dungeon.id);
+	auto const topleft = dungeon.getTopleft();
+	auto const range = sf::Vector2i{dungeon.getRange()};
+	auto const size = sf::Vector2i{dungeon.getSize()};
+	// clamp visible cells to the scene
+	sf::Vector2i first{std::max(topleft.x, 0), std::max(topleft.y, 0)};
+	sf::Vector2i last{std::min(topleft.x + range.x, size.x),
+		std::min(topleft.y + range.y, size.y)};
+	if (first.x >= last.x || first.y >= last.y) {
+		// nothing visible
+		return;
+	}
+	auto from = cache.getChunkPos(sf::Vector2u{first});
+	auto to = cache.getChunkPos(sf::Vector2u{last - sf::Vector2i{1, 1}});
+	sf::Vector2u chunk;
+	for (chunk.y = from.y; chunk.y <= to.y; ++chunk.y) {
+		for (chunk.x = from.x; chunk.x <= to.x; ++chunk.x) {
+			context.stats.terrain_vertices += cache.update(dungeon, chunk);
+			buffer.chunks.push_back(&cache[chunk]);
+			++context.stats.chunks;
+		}
+	}
+}
+
 void cullScene(Context& context, CullingBuffer& buffer, CameraData const& cam,
 	Dungeon& dungeon) {
 	// reset state of the buffer
-	for (auto& pair : buffer.terrain) {
-		pair.second.clear();
-	}
+	buffer.chunks.clear();
 	for (auto& pair : buffer.objects) {
 		pair.second.clear();
 	}
 	buffer.ambiences.clear();
 	buffer.edges.clear();
+	buffer.edge_indices.clear();
 	buffer.lights.clear();
+	buffer.shadows.clear();
 	buffer.highlights.clear();
 	buffer.grid.clear();
 
-	auto tile_size = dungeon.getTileSize();
-	float scale = std::max(tile_size.x, tile_size.y);
 	dungeon.setView(cam.scene);
 
+	auto const size = cam.scene.getSize();
+	sf::FloatRect const view{cam.scene.getCenter() - size / 2.f, size};
+
 	// cull visible scene
 	dungeon.setPadding({1u, 1u});
+	cullTerrain(context, buffer, dungeon);
 	for (auto const& pos : dungeon) {
 		if (!dungeon.has(pos)) {
 			continue;
 		}
 		auto const& cell = dungeon.getCell(pos);
-		if (cell.terrain != core::Terrain::Void) {
-			// cull terrain
-			cell.tile.fetchTile(buffer.terrain[cell.terrain]);
+		auto const& render = dungeon.getColdCell(pos);
+		if (dungeon.getTerrain(pos) != core::Terrain::Void) {
 			// cull ambiences
-			cullAmbiences(buffer, cell);
+			cullAmbiences(buffer, render);
 		}
 		// cull objects and highlights
 		for (auto id : cell.entities) {
 			auto& data = context.render_manager.query(id);
 			// update renderable's representation if necessary
 			updateObject(context, data);
-			// save renderable for drawing
-			buffer.objects[data.layer].push_back(&data);
+			// save renderable for drawing if it is visible at all
+			if (isVisible(data, view)) {
+				buffer.objects[data.layer].push_back(&data);
+				++context.stats.objects;
+			} else {
+				++context.stats.rejected;
+			}
 			// cull highlighting sprite
 			if (data.highlight != nullptr) {
 				auto ptr = data.highlight->getTexture();
@@ -329,53 +544,25 @@ void cullScene(Context& context, CullingBuffer& buffer, CameraData const& cam,
 		}
 		// cull debug grid
 		if (context.grid_color.a != sf::Color::Transparent.a) {
-			cell.tile.fetchGrid(context.grid_color, buffer.grid);
+			render.tile.fetchGrid(context.grid_color, buffer.grid);
 		}
 	}
 
 	if (context.lighting_system.getLevelOfDetails() > 0u) {
-		// set padding to fetch all visible lights and shadows
-		dungeon.setPadding({static_cast<unsigned int>(std::ceil(
-								utils::MAX_LIGHT_RADIUS / tile_size.x)),
-			static_cast<unsigned int>(std::ceil(
-				utils::MAX_LIGHT_RADIUS / tile_size.y))});
 		// cull lights and edges for shadowcasting
-		for (auto const& pos : dungeon) {
-			if (!dungeon.has(pos)) {
-				continue;
-			}
-			auto const& cell = dungeon.getCell(pos);
-			// cull edges if shadowing enabled
-			if (context.cast_shadows) {
-				for (auto const& edge : cell.tile.edges) {
-					buffer.edges.push_back(edge);
-				}
-			}
-			// cull lights
-			for (auto id : cell.entities) {
-				auto const& data = context.render_manager.query(id);
-				if (data.light != nullptr) {
-					// copy and scale light
-					utils::Light light = *data.light;
-					light.radius *= scale;
-					buffer.lights.push_back(std::move(light));
-				}
-				// cull edges if shadowing enabled
-				if (context.cast_shadows && !data.edges.empty()) {
-					render_impl::addEdges(context, data, buffer.edges);
-				}
-			}
-		}
-		// reset padding
-		dungeon.setPadding({0u, 0u});
+		cullLights(context, buffer, dungeon, view);
 	}
 }
 
 void cullScenes(Context& context) {
+	context.stats = Stats{};
 	// guarantee correct number of culling buffers
 	if (context.buffers.size() < context.camera_system.size()) {
 		context.buffers.resize(context.camera_system.size());
 	}
+	if (context.lookahead > sf::Time::Zero) {
+		centerCameras(context);
+	}
 	std::size_t i = 0u;
 	for (auto& unique_ptr : context.camera_system) {
 		auto& camera = *unique_ptr;
@@ -384,6 +571,8 @@ void cullScenes(Context& context) {
 		auto const& move_data =
 			context.movement_manager.query(camera.objects.front());
 		ASSERT(move_data.scene > 0u);
+		// make sure the watched scene's render cells are resident
+		context.dungeon_system.restore(move_data.scene);
 		auto& dungeon = context.dungeon_system[move_data.scene];
 		// cull scene
 		render_impl::cullScene(context, context.buffers[i++], camera, dungeon);
@@ -405,35 +594,48 @@ void drawHighlightings(CullingBuffer const & buffer, sf::RenderTarget& target) {
 }
 
 void drawSprites(Context const& context, Renderables const& objects,
-	sf::RenderTarget& target) {
+	utils::SpriteBatch& batch, sf::RenderTarget& target) {
+	batch.clear();
 	for (auto const& ptr : objects) {
-		ptr->legs.render(target, ptr->legs_matrix, context.sprite_shader);
-		ptr->torso.render(target, ptr->torso_matrix, context.sprite_shader);
+		// note: each object's legs and torso are drawn in order
+		ptr->legs.batch(batch, ptr->legs_matrix);
+		ptr->torso.batch(batch, ptr->torso_matrix);
 	}
+	context.stats.sprites += batch.getNumSprites();
+	context.stats.batches += batch.size();
+	context.stats.draw_calls += batch.draw(target, &context.sprite_shader);
 }
 
 void drawScene(Context const& context, CullingBuffer& buffer,
 	sf::RenderTarget& target, CameraData const& cam, Dungeon& dungeon) {
 	// draw floor tiles
 	target.setView(cam.scene);
-	target.draw(buffer.terrain[Terrain::Floor], &dungeon.tileset);
+	for (auto ptr: buffer.chunks) {
+		target.draw(ptr->terrain[Terrain::Floor], &dungeon.tileset);
+	}
+	context.stats.draw_calls += buffer.chunks.size();
 	// colorize floor with light
 	target.setView(cam.screen);
 	context.lighting_system.renderLight(target);
 	// draw highlighting sprites
 	target.setView(cam.scene);
 	drawHighlightings(buffer, target);
+	context.stats.draw_calls += buffer.highlights.size();
 	// draw ambiences
 	target.setView(cam.scene);
 	drawAmbiences(buffer, target);
+	context.stats.draw_calls += buffer.ambiences.size();
 	// hide floor behind obstacles
 	target.setView(cam.screen);
 	context.lighting_system.renderShadow(target);
 	// draw walls and objects
 	target.setView(cam.scene);
-	target.draw(buffer.terrain[Terrain::Wall], &dungeon.tileset);
+	for (auto ptr: buffer.chunks) {
+		target.draw(ptr->terrain[Terrain::Wall], &dungeon.tileset);
+	}
+	context.stats.draw_calls += buffer.chunks.size();
 	for (auto& pair: buffer.objects) {
-		drawSprites(context, pair.second, target);
+		drawSprites(context, pair.second, buffer.sprites, target);
 	}
 	// hide far walls and objects with fog
 	target.setView(cam.screen);
@@ -453,8 +655,8 @@ void drawScenes(Context const& context, sf::RenderTarget& target) {
 	for (auto& unique_ptr: context.camera_system) {
 		auto& buffer = context.buffers[i++];
 		auto& camera = *unique_ptr;
-		context.lighting_system.update(
-			camera.scene, camera.screen, buffer.edges, buffer.lights);
+		context.lighting_system.update(camera.scene, camera.screen,
+			buffer.edges, buffer.edge_indices, buffer.lights, buffer.shadows);
 	}
 	// draw cameras
 	i = 0u;
@@ -10,6 +10,7 @@ void spawn(Dungeon& dungeon, MovementData& data, sf::Vector2u const& pos) {
 	// add to new cell
 	auto& cell = dungeon.getCell(pos);
 	cell.entities.push_back(data.id);
+	dungeon.touch();
 
 	// update object
 	data.pos = sf::Vector2f{pos};
@@ -25,6 +26,7 @@ void vanish(Dungeon& dungeon, MovementData& data) {
 	auto& cell = dungeon.getCell(data.target);
 	auto ok = utils::pop(cell.entities, data.id);
 	ASSERT(ok);
+	dungeon.touch();
 
 	// update object
 	data.scene = 0u;
@@ -42,11 +44,11 @@ bool SpawnHelper::operator()(sf::Vector2u const& pos) {
 		// ignore invalid position
 		return false;
 	}
-	auto& cell = dungeon.getCell(pos);
-	if (checkTileCollision(cell)) {
+	if (checkTileCollision(dungeon.getTerrain(pos))) {
 		// ignore unaccessable position
 		return false;
 	}
+	auto& cell = dungeon.getCell(pos);
 	if (!checkObjectCollision(manager, cell, data).empty()) {
 		// ignore blocked position
 		return false;
@@ -57,11 +59,11 @@ bool SpawnHelper::operator()(sf::Vector2u const& pos) {
 TriggerHelper::TriggerHelper(Dungeon const& dungeon) : dungeon{dungeon} {}
 
 bool TriggerHelper::operator()(sf::Vector2u const& pos) {
-	auto& cell = dungeon.getCell(pos);
-	if (checkTileCollision(cell)) {
+	if (checkTileCollision(dungeon.getTerrain(pos))) {
 		// ignore unaccessable position
 		return false;
 	}
+	auto& cell = dungeon.getCell(pos);
 	// ignore position if a trigger is already set
 	return cell.trigger == nullptr;
 }
@@ -87,6 +89,8 @@ void TeleportTrigger::execute(core::ObjectID actor) {
 		// projectiles cannot be teleported
 		return;
 	}
+	// note: the target might have been evicted but is about to be watched
+	dungeon.restore(target);
 	auto& dst = dungeon[target];
 	auto p = pos;
 
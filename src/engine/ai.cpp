@@ -2,7 +2,8 @@
 
 namespace engine {
 
-AiSystem::AiSystem(core::LogContext& log, std::size_t max_objects)
+AiSystem::AiSystem(core::LogContext& log, std::size_t max_objects,
+	std::size_t path_workers)
 	: utils::EventListener<core::CollisionEvent, core::TeleportEvent,
 		core::AnimationEvent, core::MoveEvent, core::FocusEvent,
 		rpg::EffectEvent, rpg::StatsEvent, rpg::DeathEvent,
@@ -10,11 +11,11 @@ AiSystem::AiSystem(core::LogContext& log, std::size_t max_objects)
 	, script{log, max_objects}
 	, path{log}
 	, navigation{} {
-	// path.start();
+	path.start(path_workers);
 }
 
 AiSystem::~AiSystem() {
-	// path.stop();
+	path.stop();
 }
 
 void AiSystem::connect(MultiEventListener& listener) {
@@ -81,6 +82,7 @@ sf::Time AiSystem::update(sf::Time const& elapsed) {
 	dispatch<rpg::SpawnEvent>(*this);
 	dispatch<rpg::FeedbackEvent>(*this);
 
+	navigation.update(game::navigator_impl::FLOW_FIELD_BUDGET);
 	script.update(elapsed);
 
 	return clock.restart();
@@ -1,4 +1,6 @@
+#include <utils/algorithm.hpp>
 #include <utils/filesystem.hpp>
+#include <utils/random.hpp>
 #include <engine/engine.hpp>
 
 namespace engine {
@@ -90,22 +92,29 @@ sf::Texture const& get_lightmap(
 	return cache.get<sf::Texture>(get_lightmap_filename());
 }
 
+std::uint32_t deriveSeed(std::uint32_t seed, SeedStream stream) {
+	return utils::RandomStream::derive(seed, static_cast<std::uint32_t>(stream));
+}
+
 // ---------------------------------------------------------------------------
 
 Engine::Engine(core::LogContext& log, std::size_t max_objects,
 	sf::Vector2u const& screen_size, float zoom, unsigned int poolsize,
-	game::Mod& mod, game::ResourceCache& cache, game::Localization& locale)
+	std::size_t path_workers, game::Mod& mod, game::ResourceCache& cache,
+	game::Localization& locale)
 	: id_manager{max_objects}
 	, dungeon{}
-	, physics{log, max_objects, dungeon}
+	// keep one core for the game's thread
+	, jobs{std::max(1u, std::thread::hardware_concurrency()) - 1u}
+	, physics{log, max_objects, dungeon, &jobs}
 	, avatar{log, max_objects}
 	, ui{log, max_objects, screen_size, get_lightmap(log, cache), zoom, poolsize,
 		  physics.movement, physics.focus, dungeon, avatar.stats,
 		  avatar.item, avatar.player, locale, mod.get_path<sf::Music>(),
-		  mod.get_ext<sf::Music>()}
+		  mod.get_ext<sf::Music>(), &jobs}
 	, behavior{log, max_objects, dungeon, physics.movement, physics.focus, ui.animation,
 		  avatar.item, avatar.stats, avatar.player}
-	, ai{log, max_objects}
+	, ai{log, max_objects, path_workers}
 	, combat{log, physics.movement, physics.projectile, avatar.perk,
 		  avatar.stats, behavior.interact, 0.f}
 	, generator{log}
@@ -116,9 +125,9 @@ Engine::Engine(core::LogContext& log, std::size_t max_objects,
 		  behavior.interact, avatar.quickslot, ui.audio, generator,
 		  ai.navigation, ai.script, ui.hud, ai.path}
 	, mod{mod}
-	, factory{log, session, mod} {
+	, factory{log, session, mod, &jobs} {
 	log.debug << "[Engine/Engine] Initialized with max_objects="
-		<< max_objects << "\n";
+		<< max_objects << ", path_workers=" << path_workers << "\n";
 	// propagate available rooms to dungeon generator
 	generator.rooms = mod.getAll<game::RoomTemplate>();
 
@@ -276,6 +285,28 @@ void Engine::disconnect(MultiEventListener& listener) {
 	// note: factory is no engine system, thus not connectable
 }
 
+void Engine::cleanup() {
+	for (auto ptr : session.systems) {
+		ptr->cleanup();
+	}
+	id_manager.cleanup();
+}
+
+void Engine::update(sf::Time const& elapsed, bool use_autocam,
+	Recorder const& record) {
+	record("behavior", behavior.update(elapsed));
+	record("physics", physics.update(elapsed));
+	record("avatar", avatar.update(elapsed));
+	record("ui", ui.update(elapsed, use_autocam));
+	{
+		sf::Clock clock;
+		combat.update(elapsed);
+		record("combat", clock.restart());
+	}
+	factory.update(elapsed);
+	record("ai", ai.update(elapsed));
+}
+
 core::CameraData const * Engine::getCamera(sf::Vector2f const & screen_pos) const {
 	// determine camera
 	core::CameraData const * cam{nullptr};
@@ -323,6 +354,35 @@ sf::Vector2f Engine::getWorldPos(sf::Vector2f const & screen_pos) const {
 	return tmp;
 }
 
+void Engine::setSeed(std::uint32_t seed) {
+	generator.rng.seed(deriveSeed(seed, SeedStream::Generator));
+	factory.rng.seed(deriveSeed(seed, SeedStream::Factory));
+	combat.setSeed(deriveSeed(seed, SeedStream::Combat));
+	mod.setScriptSeed(deriveSeed(seed, SeedStream::Script));
+	behavior.input.setSeed(deriveSeed(seed, SeedStream::Input));
+	ui.audio.setSeed(deriveSeed(seed, SeedStream::Audio));
+}
+
+void Engine::pageDungeons() {
+	std::vector<utils::SceneID> watched;
+	for (auto const & uptr: session.camera) {
+		ASSERT(!uptr->objects.empty());
+		watched.push_back(session.movement.query(uptr->objects.front()).scene);
+	}
+	utils::SceneID id{0u};
+	bool evicted{false};
+	for (auto it = dungeon.begin(); it != dungeon.end(); ++it) {
+		++id;
+		if (utils::contains(watched, id)) {
+			dungeon.restore(id);
+		} else if (!evicted && dungeon.isResident(id)) {
+			// note: evict one dungeon per call to spread the snapshots
+			dungeon.evict(id);
+			evicted = true;
+		}
+	}
+}
+
 void Engine::snapGrid(sf::Vector2f& screen_pos) const {
 	auto const ptr = getCamera(screen_pos);
 	if (ptr == nullptr) {
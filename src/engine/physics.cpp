@@ -3,9 +3,9 @@
 namespace engine {
 
 PhysicsSystem::PhysicsSystem(core::LogContext& log, std::size_t max_objects,
-	core::DungeonSystem& dungeon)
+	core::DungeonSystem& dungeon, utils::JobSystem* jobs)
 	: utils::EventListener<core::InputEvent>{}
-	, movement{log, max_objects, dungeon}
+	, movement{log, max_objects, dungeon, jobs}
 	, collision{log, max_objects, dungeon, movement}
 	, focus{log, max_objects, dungeon, movement}
 	, projectile{log, max_objects, movement, collision, dungeon} {
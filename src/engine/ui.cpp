@@ -7,7 +7,8 @@ UiSystem::UiSystem(core::LogContext& log, std::size_t max_objects, sf::Vector2u
 	core::MovementManager const& movement, core::FocusManager const & focus,
 	core::DungeonSystem& dungeon, rpg::StatsManager const& stats,
 	rpg::ItemManager const & item, rpg::PlayerManager const & player,
-	game::Localization& locale, std::string const & music_base, std::string const & music_ext)
+	game::Localization& locale, std::string const & music_base, std::string const & music_ext,
+	utils::JobSystem* jobs)
 	: utils::EventListener<core::AnimationEvent, core::TeleportEvent,
 		core::FocusEvent, core::SpriteEvent, core::SoundEvent, core::MusicEvent,
 		core::MoveEvent, rpg::StatsEvent, rpg::DeathEvent, rpg::SpawnEvent,
@@ -17,7 +18,7 @@ UiSystem::UiSystem(core::LogContext& log, std::size_t max_objects, sf::Vector2u
 	, sf::Drawable{}
 	, lighting{screen_size, lightmap}
 	, camera{screen_size, zoom}
-	, animation{log, max_objects}
+	, animation{log, max_objects, jobs}
 	, render{log, max_objects, animation, movement, dungeon, camera, lighting}
 	, sound{log, audio_poolsize}
 	, music{log, music_base, music_ext}
@@ -14,7 +14,10 @@ Context::Context(core::LogContext& log, core::SoundManager const & sounds,
 	, sound_sender{sound_sender}
 	, music_sender{music_sender}
 	, feedback{}
-	, music{} {
+	, music{}
+	, levelup{}
+	, powerup{}
+	, rng{} {
 }
 
 // --------------------------------------------------------------------
@@ -27,7 +30,7 @@ void onMusicStopped(Context& context) {
 	}
 	
 	core::MusicEvent event;
-	event.filename = utils::randomAt(context.music);
+	event.filename = utils::randomAt(context.music, context.rng);
 	context.music_sender.send(event);
 }
 
@@ -39,7 +42,7 @@ void onAction(Context& context, core::ObjectID actor, core::SoundAction action)
 	}
 	
 	core::SoundEvent event;
-	event.buffer = utils::randomAt(sounds);
+	event.buffer = utils::randomAt(sounds, context.rng);
 	context.sound_sender.send(event);
 }
 
@@ -95,7 +98,7 @@ void onFeedback(Context& context, rpg::FeedbackEvent const & event) {
 	}
 	
 	core::SoundEvent ev;
-	ev.buffer = utils::randomAt(data);
+	ev.buffer = utils::randomAt(data, context.rng);
 	context.sound_sender.send(ev);
 }
 
@@ -112,7 +115,7 @@ void onExp(Context& context, rpg::ExpEvent const & event) {
 	}
 	
 	core::SoundEvent ev;
-	ev.buffer = utils::randomAt(context.levelup);
+	ev.buffer = utils::randomAt(context.levelup, context.rng);
 	context.sound_sender.send(ev);
 }
 
@@ -124,7 +127,7 @@ void onPowerup(Context& context) {
 	}
 	
 	core::SoundEvent ev;
-	ev.buffer = utils::randomAt(context.powerup);
+	ev.buffer = utils::randomAt(context.powerup, context.rng);
 	context.sound_sender.send(ev);
 }
 
@@ -159,6 +162,10 @@ void AudioSystem::addPowerup(sf::SoundBuffer const & buffer) {
 	context.powerup.push_back(&buffer);
 }
 
+void AudioSystem::setSeed(std::uint32_t seed) {
+	context.rng.seed(seed);
+}
+
 void AudioSystem::handle(core::MusicEvent const & event) {
 	if (event.filename.empty()) {
 		audio_impl::onMusicStopped(context);
@@ -1,5 +1,4 @@
 #include <algorithm>
-#include <Thor/Math.hpp>
 
 #include <utils/algorithm.hpp>
 #include <game/builder.hpp>
@@ -8,9 +7,10 @@ namespace game {
 
 namespace dungeon_impl {
 
+unsigned int const STRIPE_HEIGHT = 32u;
+
 bool shouldBeWall(core::Dungeon const& dungeon, sf::Vector2u const& pos) {
-	auto const& cell = dungeon.getCell(pos);
-	if (cell.terrain != core::Terrain::Void) {
+	if (dungeon.getTerrain(pos) != core::Terrain::Void) {
 		// wall can only be placed at void!
 		return false;
 	}
@@ -25,8 +25,7 @@ bool shouldBeWall(core::Dungeon const& dungeon, sf::Vector2u const& pos) {
 			if (!dungeon.has(tmp)) {
 				continue;
 			}
-			auto const& cell = dungeon.getCell(tmp);
-			if (cell.terrain == core::Terrain::Floor) {
+			if (dungeon.getTerrain(tmp) == core::Terrain::Floor) {
 				// found near by floor!
 				return true;
 			}
@@ -41,8 +40,7 @@ bool shouldBeShaded(core::Dungeon const& dungeon, sf::Vector2u const& pos,
 	if (!dungeon.has(tmp)) {
 		return true;
 	}
-	auto const& cell = dungeon.getCell(tmp);
-	return cell.terrain == core::Terrain::Void;
+	return dungeon.getTerrain(tmp) == core::Terrain::Void;
 }
 
 utils::ShadingCase getShadingCase(
@@ -56,7 +54,7 @@ utils::ShadingCase getShadingCase(
 			}
 			auto tmp = sf::Vector2u{sf::Vector2i{pos} + dir};
 			if (!dungeon.has(tmp) ||
-				dungeon.getCell(tmp).terrain == core::Terrain::Void) {
+				dungeon.getTerrain(tmp) == core::Terrain::Void) {
 				// either neigbor is out of grid or explicitly void tile
 				if (dir.y == -1) {
 					if (dir.x == -1) {
@@ -92,41 +90,66 @@ utils::ShadingCase getShadingCase(
 }
 
 void placeFloor(core::Dungeon& dungeon, sf::Vector2u const& pos) {
-	auto& cell = dungeon.getCell(pos);
-	cell.terrain = core::Terrain::Floor;
+	dungeon.getTerrain(pos) = core::Terrain::Floor;
 }
 
 void placeWall(core::Dungeon& dungeon, sf::Vector2u const& pos) {
-	auto& cell = dungeon.getCell(pos);
-	cell.terrain = core::Terrain::Wall;
+	dungeon.getTerrain(pos) = core::Terrain::Wall;
 }
 
 void prepareTile(rpg::TilesetTemplate const& tileset, core::Dungeon& dungeon,
-	sf::Vector2u const& pos) {
-	auto& cell = dungeon.getCell(pos);
+	sf::Vector2u const& pos, utils::RandomStream& rng) {
+	auto terrain = dungeon.getTerrain(pos);
 	sf::Vector2u offset;
 	utils::ShadingCase shade = 0u;
 	bool has_edges = false;
-	if (cell.terrain == core::Terrain::Wall) {
+	if (terrain == core::Terrain::Wall) {
 		// prepare wall
-		auto index = thor::random(0u, tileset.walls.size() - 1u);
+		auto index = rng(0u, static_cast<unsigned int>(tileset.walls.size() - 1u));
 		offset = tileset.walls[index];
 		shade = getShadingCase(dungeon, pos);
 		has_edges = true;
 
-	} else if (cell.terrain == core::Terrain::Floor) {
+	} else if (terrain == core::Terrain::Floor) {
 		// prepare floor
-		auto index = thor::random(0u, tileset.floors.size() - 1u);
+		auto index = rng(0u, static_cast<unsigned int>(tileset.floors.size() - 1u));
 		offset = tileset.floors[index];
 
 	}
 
 	// prepare tile
-	cell.tile.refresh(pos, tileset.tilesize, offset, tileset.tilesize, shade, has_edges);
+	dungeon.getColdCell(pos).tile.refresh(pos, tileset.tilesize, offset, tileset.tilesize, shade, has_edges);
+}
+
+void findWalls(core::Dungeon const& dungeon, unsigned int first,
+	unsigned int last, std::vector<sf::Vector2u>& walls) {
+	auto const size = dungeon.getSize();
+	ASSERT(last <= size.y);
+	sf::Vector2u pos;
+	for (pos.y = first; pos.y < last; ++pos.y) {
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			if (shouldBeWall(dungeon, pos)) {
+				walls.push_back(pos);
+			}
+		}
+	}
+}
+
+void prepareTiles(rpg::TilesetTemplate const& tileset, core::Dungeon& dungeon,
+	std::uint32_t seed, unsigned int first, unsigned int last) {
+	auto const size = dungeon.getSize();
+	ASSERT(last <= size.y);
+	sf::Vector2u pos;
+	for (pos.y = first; pos.y < last; ++pos.y) {
+		utils::RandomStream rng{utils::RandomStream::derive(seed, pos.y)};
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			prepareTile(tileset, dungeon, pos, rng);
+		}
+	}
 }
 
 void makeTransparent(core::Dungeon& dungeon, sf::Vector2u const & pos, bool transparent) {
-	for (auto& v: dungeon.getCell(pos).tile.vertices) {
+	for (auto& v: dungeon.getColdCell(pos).tile.vertices) {
 		if (transparent) {
 			v.color.a = 200u;
 		} else {
@@ -186,7 +209,8 @@ BuildSettings::BuildSettings()
 	: cell_size{30u}
 	, path_width{3u}
 	, random_transform{true}
-	, editor_mode{false} {
+	, editor_mode{false}
+	, seed{0u} {
 }
 
 // ---------------------------------------------------------------------------
@@ -294,8 +318,8 @@ DungeonBuilder::DungeonBuilder(sf::Vector2u const& grid_size)
 	, info{} {
 }
 
-void DungeonBuilder::operator()(rpg::TilesetTemplate const& tileset,
-	core::Dungeon& dungeon, BuildSettings const & settings) {
+void DungeonBuilder::placeFloors(core::Dungeon& dungeon,
+	BuildSettings const & settings) {
 	info = BuildInformation{};
 	ASSERT(grid_size == dungeon.getSize());
 	
@@ -312,44 +336,46 @@ void DungeonBuilder::operator()(rpg::TilesetTemplate const& tileset,
 		ASSERT(room.isValid(grid_size));
 		info.rooms.push_back(room(dungeon, settings));
 	}
+}
+
+void DungeonBuilder::highlight(core::Dungeon& dungeon,
+	std::vector<sf::Vector2u> const & autowalls) const {
+	// make corridors semi-transparent
+	for (auto const & corridor: info.corridors) {
+		for (auto const & pos: corridor) {
+			dungeon_impl::makeTransparent(dungeon, pos);
+		}
+	}
+	// make room's floor non-transparent
+	for (auto const & room: info.rooms) {
+		for (auto const & pos: room) {
+			dungeon_impl::makeTransparent(dungeon, pos, false);
+		}
+	}
+	// make auto-walls semi-transparent
+	for (auto const & pos: autowalls) {
+		dungeon_impl::makeTransparent(dungeon, pos);
+	}
+}
+
+void DungeonBuilder::operator()(rpg::TilesetTemplate const& tileset,
+	core::Dungeon& dungeon, BuildSettings const & settings) {
+	placeFloors(dungeon, settings);
 	
 	// place bordering walls
-	sf::Vector2u pos;
 	std::vector<sf::Vector2u> autowalls;
 	autowalls.reserve(5u * (grid_size.x + grid_size.x));
-	for (pos.y = 0u; pos.y < grid_size.y; ++pos.y) {
-		for (pos.x = 0u; pos.x < grid_size.x; ++pos.x) {
-			if (dungeon_impl::shouldBeWall(dungeon, pos)) {
-				dungeon_impl::placeWall(dungeon, pos);
-				autowalls.push_back(pos);
-			}
-		}
+	dungeon_impl::findWalls(dungeon, 0u, grid_size.y, autowalls);
+	for (auto const & pos: autowalls) {
+		dungeon_impl::placeWall(dungeon, pos);
 	}
 
 	// apply wall shading
-	for (pos.y = 0u; pos.y < grid_size.y; ++pos.y) {
-		for (pos.x = 0u; pos.x < grid_size.x; ++pos.x) {
-			dungeon_impl::prepareTile(tileset, dungeon, pos);
-		}
-	}
+	dungeon_impl::prepareTiles(tileset, dungeon, settings.seed, 0u,
+		grid_size.y);
 	
 	if (settings.editor_mode) {
-		// make corridors semi-transparent
-		for (auto const & corridor: info.corridors) {
-			for (auto const & pos: corridor) {
-				dungeon_impl::makeTransparent(dungeon, pos);
-			}
-		}
-		// make room's floor non-transparent
-		for (auto const & room: info.rooms) {
-			for (auto const & pos: room) {
-				dungeon_impl::makeTransparent(dungeon, pos, false);
-			}
-		}
-		// make auto-walls semi-transparent
-		for (auto const & pos: autowalls) {
-			dungeon_impl::makeTransparent(dungeon, pos);
-		}
+		highlight(dungeon, autowalls);
 	}
 }
 
@@ -5,7 +5,11 @@ namespace game {
 HudData::HudData() : core::ComponentData{}, hud{nullptr} {}
 
 ScriptData::ScriptData()
-	: core::ComponentData{}, is_active{true}, api{nullptr}, script{nullptr} {}
+	: core::ComponentData{}
+	, is_active{true}
+	, api{nullptr}
+	, script{nullptr}
+	, next_update{sf::Time::Zero} {}
 
 }  // ::rage
 
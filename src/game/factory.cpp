@@ -29,7 +29,7 @@ bool canHoldPowerup(Session const & session, utils::SceneID scene, sf::Vector2u
 		return false;
 	} 
 	auto const & cell = dungeon.getCell(pos);
-	if (cell.terrain != core::Terrain::Floor || cell.trigger != nullptr) {
+	if (dungeon.getTerrain(pos) != core::Terrain::Floor || cell.trigger != nullptr) {
 		return false;
 	}
 	for (auto id: cell.entities) {
@@ -48,12 +48,22 @@ bool canHoldPowerup(Session const & session, utils::SceneID scene, sf::Vector2u
 
 // --------------------------------------------------------------------
 
-Factory::Factory(core::LogContext& log, Session& session, Mod& mod)
+DungeonRequest::DungeonRequest()
+	: tileset{nullptr}
+	, grid_size{}
+	, settings{} {
+}
+
+// --------------------------------------------------------------------
+
+Factory::Factory(core::LogContext& log, Session& session, Mod& mod,
+	utils::JobSystem* jobs)
 	: utils::EventListener<rpg::ProjectileEvent, rpg::DeathEvent,
 		rpg::SpawnEvent, ReleaseEvent>{}
 	, utils::EventSender<core::InputEvent, rpg::ActionEvent, rpg::ItemEvent,
 		rpg::StatsEvent, rpg::SpawnEvent, PowerupEvent>{}
 	, log{log}
+	, jobs{jobs}
 	, max_num_players{session.movement.capacity()}
 	, session{session}
 	, mod{mod}
@@ -61,7 +71,8 @@ Factory::Factory(core::LogContext& log, Session& session, Mod& mod)
 	, release{}
 	, latest_player{0u}
 	, blood_texture{nullptr}
-	, gem_tpl{nullptr} {
+	, gem_tpl{nullptr}
+	, rng{} {
 	entity_cache.resize(max_num_players);
 }
 
@@ -128,28 +139,167 @@ utils::SceneID Factory::createDungeon(rpg::TilesetTemplate const& tileset,
 	auto tilesize = sf::Vector2f{tileset.tilesize};
 	auto id = session.dungeon.create(*tileset.tileset, grid_size, tilesize);
 	
+	// draw seeds like createDungeons does for a single floor
+	utils::RandomStream floor_rng{session.generator.rng.next()};
+	auto build_settings = settings;
+	build_settings.seed = rng.next();
+	
 	// generate dungeon content
-	session.generator.generate(id, grid_size);
+	auto& data = session.generator.allocate(id, grid_size);
+	if (!session.generator.populate(data, floor_rng)) {
+		log.error << "[Game/Generator] " << "The force has not been with the RNG oO\n";
+	}
 	
 	// populate dungeon
 	auto& dungeon = session.dungeon[id];
-	auto& builder = session.generator[id].builder;
+	auto& builder = data.builder;
 	modifier(builder);
 	if (settings.random_transform) {
 		for (auto& room: builder.rooms) {
-			room.angle = thor::random(0, 3) * 90.f;
-			room.flip_x = (bool)(thor::random(0, 1));
-			room.flip_y = (bool)(thor::random(0, 1));
+			room.angle = floor_rng(0, 3) * 90.f;
+			room.flip_x = (bool)(floor_rng(0, 1));
+			room.flip_y = (bool)(floor_rng(0, 1));
 		}
 	}
-	builder(tileset, dungeon, settings);
+	builder(tileset, dungeon, build_settings);
 	
 	// create pathfinding navigator
+	// note: editor dungeons use stub corridors, which are not related to
+	// the layout's cells, so hierarchical pathfinding is disabled there
+	auto cell_size = settings.editor_mode ? 0u : settings.cell_size;
 	auto& navigator = session.navigation.create(id, session.collision,
-		dungeon, builder);
+		dungeon, builder, cell_size);
 	session.path.addScene(id, navigator);
 	
-	// create provided entities
+	createEntities(id, builder, settings);
+	
+	return id;
+}
+
+std::vector<utils::SceneID> Factory::createDungeons(
+	std::vector<DungeonRequest> const & requests) {
+	struct Floor {
+		utils::SceneID id;
+		core::Dungeon* dungeon;
+		DungeonData* data;
+		utils::RandomStream rng;
+		BuildSettings settings;
+		std::vector<sf::Vector2u> autowalls;
+		std::unique_ptr<Navigator> navigator;
+		bool success;
+	};
+	struct Stripe {
+		std::size_t floor;
+		unsigned int first, last;
+		std::vector<sf::Vector2u> walls;
+	};
+	utils::JobSystem sequential;
+	auto& pool = jobs != nullptr ? *jobs : sequential;
+	
+	// create empty dungeons and draw their seeds in request order
+	std::vector<Floor> floors;
+	floors.reserve(requests.size());
+	for (auto const & request: requests) {
+		ASSERT(request.tileset != nullptr);
+		ASSERT(request.tileset->tileset != nullptr);
+		auto grid_size = request.grid_size;
+		session.generator.layoutifySize(grid_size);
+		auto tilesize = sf::Vector2f{request.tileset->tilesize};
+		floors.emplace_back();
+		auto& floor = floors.back();
+		floor.id = session.dungeon.create(*request.tileset->tileset,
+			grid_size, tilesize);
+		floor.dungeon = &session.dungeon[floor.id];
+		floor.data = &session.generator.allocate(floor.id, grid_size);
+		floor.rng.seed(session.generator.rng.next());
+		floor.settings = request.settings;
+		floor.settings.seed = rng.next();
+		floor.success = true;
+	}
+	
+	// generate layouts and place floor tiles
+	pool.run(floors.size(), [&](std::size_t i) {
+		auto& floor = floors[i];
+		auto& builder = floor.data->builder;
+		floor.success = session.generator.populate(*floor.data, floor.rng);
+		if (floor.settings.random_transform) {
+			for (auto& room: builder.rooms) {
+				room.angle = floor.rng(0, 3) * 90.f;
+				room.flip_x = (bool)(floor.rng(0, 1));
+				room.flip_y = (bool)(floor.rng(0, 1));
+			}
+		}
+		builder.placeFloors(*floor.dungeon, floor.settings);
+	});
+	
+	// search walls in stripes of rows
+	std::vector<Stripe> stripes;
+	for (auto i = 0u; i < floors.size(); ++i) {
+		auto height = floors[i].dungeon->getSize().y;
+		for (auto y = 0u; y < height; y += dungeon_impl::STRIPE_HEIGHT) {
+			stripes.emplace_back();
+			auto& stripe = stripes.back();
+			stripe.floor = i;
+			stripe.first = y;
+			stripe.last = std::min(y + dungeon_impl::STRIPE_HEIGHT, height);
+		}
+	}
+	pool.run(stripes.size(), [&](std::size_t i) {
+		auto& stripe = stripes[i];
+		dungeon_impl::findWalls(*floors[stripe.floor].dungeon, stripe.first,
+			stripe.last, stripe.walls);
+	});
+	
+	// place walls in stripe order
+	for (auto const & stripe: stripes) {
+		auto& floor = floors[stripe.floor];
+		for (auto const & pos: stripe.walls) {
+			dungeon_impl::placeWall(*floor.dungeon, pos);
+		}
+		floor.autowalls.insert(floor.autowalls.end(), stripe.walls.begin(),
+			stripe.walls.end());
+	}
+	
+	// prepare tiles in stripes of rows
+	pool.run(stripes.size(), [&](std::size_t i) {
+		auto const & stripe = stripes[i];
+		auto& floor = floors[stripe.floor];
+		dungeon_impl::prepareTiles(*requests[stripe.floor].tileset,
+			*floor.dungeon, floor.settings.seed, stripe.first, stripe.last);
+	});
+	
+	// finish dungeons and build their navigators
+	pool.run(floors.size(), [&](std::size_t i) {
+		auto& floor = floors[i];
+		auto const & builder = floor.data->builder;
+		if (floor.settings.editor_mode) {
+			builder.highlight(*floor.dungeon, floor.autowalls);
+		}
+		auto cell_size = floor.settings.editor_mode ? 0u
+			: floor.settings.cell_size;
+		floor.navigator = NavigationSystem::build(session.collision,
+			*floor.dungeon, builder, cell_size);
+	});
+	
+	// register navigators and spawn entities
+	std::vector<utils::SceneID> ids;
+	ids.reserve(floors.size());
+	for (auto& floor: floors) {
+		if (!floor.success) {
+			log.error << "[Game/Generator] " << "The force has not been with the RNG oO\n";
+		}
+		auto& navigator = session.navigation.add(floor.id,
+			std::move(floor.navigator));
+		session.path.addScene(floor.id, navigator);
+		createEntities(floor.id, floor.data->builder, floor.settings);
+		ids.push_back(floor.id);
+	}
+	
+	return ids;
+}
+
+void Factory::createEntities(utils::SceneID id, DungeonBuilder const & builder,
+	BuildSettings const & settings) {
 	rpg::SpawnMetaData spawn;
 	spawn.scene = id;
 	for (auto const & room: builder.rooms) {
@@ -169,31 +319,29 @@ utils::SceneID Factory::createDungeon(rpg::TilesetTemplate const& tileset,
 			createObject(*entity.ptr, spawn);
 		}
 	}
-	
-	return id;
 }
 
 void Factory::createAmbience(sf::Texture const & texture, rpg::SpawnMetaData const & data,
 	sf::Color const & color) {
 	ASSERT(data.scene > 0u);
 	
-	// query target cell
-	auto& dungeon = session.dungeon[data.scene];
-	auto& target = dungeon.getCell(data.pos).ambiences;
+	auto const & dungeon = session.dungeon[data.scene];
 	
 	// create sprite
-	target.emplace_back(texture);
-	auto& sprite = target.back();
+	sf::Sprite sprite{texture};
 	sprite.setOrigin(sf::Vector2f{texture.getSize()} / 2.f);
 	sprite.setColor(color);
 	
 	// set random offset and rotation
 	auto screen_pos = dungeon.toScreen(sf::Vector2f{data.pos});
 	auto tile_size = dungeon.getTileSize();
-	screen_pos.x += thor::random(-tile_size.x, tile_size.x) / 2.f;
-	screen_pos.y += thor::random(-tile_size.y, tile_size.y) / 2.f;
+	screen_pos.x += rng(-tile_size.x, tile_size.x) / 2.f;
+	screen_pos.y += rng(-tile_size.y, tile_size.y) / 2.f;
 	sprite.setPosition(screen_pos);
-	sprite.setRotation(thor::random(0.f, 360.f));
+	sprite.setRotation(rng(0.f, 360.f));
+	
+	// add to target cell (even if the dungeon is evicted)
+	session.dungeon.addAmbience(data.scene, data.pos, sprite);
 }
 
 core::ObjectID Factory::createObject(
@@ -362,7 +510,7 @@ core::ObjectID Factory::createBullet(rpg::CombatMetaData const& meta,
 
 core::ObjectID Factory::createBot(BotTemplate const& bot,
 	rpg::SpawnMetaData const& data, std::size_t level,
-	utils::Script const& script, bool hostile, float difficulty) {
+	AiScript const& script, bool hostile, float difficulty) {
 	ASSERT(bot.entity != nullptr);
 	ASSERT(bot.entity->collide);
 	ASSERT(bot.entity->max_sight > 0.f);
@@ -416,9 +564,10 @@ core::ObjectID Factory::createBot(BotTemplate const& bot,
 	// setup ai
 	auto& a = session.script.acquire(id);
 	a.api = std::make_unique<LuaApi>(log, id, hostile, session,
-		session.script, *this, *this, *this, session.path);
+		session.script, *this, *this, *this, session.path, session.navigation);
+	a.api->tick_rate = sf::milliseconds(bot.tick_rate);
 	a.script = &script;
-	script("onInit", a.api.get());
+	script(AiCallback::onInit, a.api.get());
 
 	entity_cache[id].hostile = hostile;
 
@@ -666,7 +815,7 @@ void Factory::handle(rpg::DeathEvent const& event) {
 	}
 
 	// add powerup
-	if (thor::random(0.f, 1.f) > 0.6f) {
+	if (rng(0.f, 1.f) > 0.6f) {
 		log.debug << "[Game/Factory] RNG rejected spawning a powerup :3\n";
 		return;
 	}
@@ -676,7 +825,7 @@ void Factory::handle(rpg::DeathEvent const& event) {
 		return;
 	}
 	
-	float v = thor::random(0.f, 1.f);
+	float v = rng(0.f, 1.f);
 	PowerupType type;
 	if (v < 0.5f) {
 		type = PowerupType::Life;
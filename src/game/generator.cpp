@@ -15,7 +15,8 @@ DungeonGenerator::DungeonGenerator(core::LogContext& log)
 	: log{log}
 	, data{}
 	, settings{}
-	, rooms{} {
+	, rooms{}
+	, rng{} {
 }
 
 void DungeonGenerator::layoutifySize(sf::Vector2u& grid_size) {
@@ -28,7 +29,7 @@ void DungeonGenerator::layoutifySize(sf::Vector2u& grid_size) {
 	grid_size.y = layout_size.y * settings.cell_size;
 }
 
-DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_size) {
+DungeonData& DungeonGenerator::allocate(utils::SceneID id, sf::Vector2u grid_size) {
 	// note: assuming synchronicity with core::DungeonSystem
 	ASSERT(id > 0u);
 	ASSERT(data.size() + 1u == id);
@@ -46,7 +47,18 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 	layout_size.y = static_cast<unsigned int>(
 		std::ceil(1.f * grid_size.y / settings.cell_size));
 
-	auto uptr = std::make_unique<DungeonData>(grid_size, layout_size);
+	data.push_back(std::make_unique<DungeonData>(grid_size, layout_size));
+	return *data.back();
+}
+
+bool DungeonGenerator::populate(DungeonData& result, utils::RandomStream& rng) const {
+	auto const grid_size = result.builder.grid_size;
+	sf::Vector2u layout_size;
+	layout_size.x = static_cast<unsigned int>(
+		std::ceil(1.f * grid_size.x / settings.cell_size));
+	layout_size.y = static_cast<unsigned int>(
+		std::ceil(1.f * grid_size.y / settings.cell_size));
+	bool success{true};
 
 	// determine number of nodes (rooms + deadends)
 	auto const num_cells = layout_size.x * layout_size.y;
@@ -75,15 +87,14 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 	};
 
 	// start at random cell
-	set({thor::random(0u, layout_size.x - 1u),
-		thor::random(0u, layout_size.y - 1u)});
+	set({rng(0u, layout_size.x - 1u), rng(0u, layout_size.y - 1u)});
 	auto i = 1u;
 	while (i < num_nodes) {
 		// pick random node
-		auto const j = thor::random(0u, openlist.size() - 1u);
+		auto const j = rng(0u, static_cast<unsigned int>(openlist.size() - 1u));
 		auto const origin = openlist[j];
 		// pick a random direction that leads to open space
-		utils::shuffle(directions);
+		utils::shuffle(directions, rng);
 		bool found{false};
 		for (auto const& dir : directions) {
 			auto pos = sf::Vector2u{sf::Vector2i{origin} + dir};
@@ -107,7 +118,7 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 			// try another position
 			utils::pop(openlist, origin);
 			if (openlist.empty()) {
-				log.error << "[Game/Generator] " << "The force has not been with the RNG oO\n";
+				success = false;
 				break;
 			}
 		}
@@ -123,7 +134,7 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 				continue;
 			}
 
-			uptr->graph.addNode(pos);
+			result.graph.addNode(pos);
 
 			// determine whether node is a room or a deadend
 			auto const n = num_rooms + num_deadends;
@@ -131,17 +142,17 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 				// all rooms and deadends have been placed
 				break;
 			}
-			auto const j = thor::random(0u, n);
+			auto const j = rng(0u, static_cast<unsigned int>(n));
 			if (j <= num_rooms) {
 				// create global offset
 				unsigned int left = pos.x * settings.cell_size;
 				unsigned int top = pos.y * settings.cell_size;
 				// pick random room
-				auto index = thor::random(0u, rooms.size()-1u);
+				auto index = rng(0u, static_cast<unsigned int>(rooms.size()-1u));
 				auto ptr = rooms[index];
 				//log.debug << "[Game/Generator] " << "Using room " << (index+1) << " / " << rooms.size() << "\n";
 				// add room
-				uptr->builder.rooms.emplace_back(left, top, *ptr);
+				result.builder.rooms.emplace_back(left, top, *ptr);
 				--num_rooms;
 
 			} else {
@@ -155,7 +166,7 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 	if (!redundant.empty()) {
 		auto num_redundant_paths = static_cast<std::size_t>(
 			std::ceil(settings.redundant_paths_ratio * num_cells));
-		utils::shuffle(redundant);
+		utils::shuffle(redundant, rng);
 		for (auto i = 0u; i < num_redundant_paths; ++i) {
 			auto pair = redundant.back();
 			redundant.pop_back();
@@ -168,7 +179,7 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 
 	// build actual paths
 	for (auto const& pair : paths) {
-		uptr->graph.addPath(pair.first, pair.second);
+		result.graph.addPath(pair.first, pair.second);
 		// note: positions are made global to the dungeon
 		auto src = pair.first;
 		src.x *= settings.cell_size;
@@ -180,11 +191,18 @@ DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_siz
 		dst.y *= settings.cell_size;
 		dst.x += origin;
 		dst.y += origin;
-		uptr->builder.paths.emplace_back(src, dst);
+		result.builder.paths.emplace_back(src, dst);
 	}
 	
-	data.push_back(std::move(uptr));
-	return *data.back();
+	return success;
+}
+
+DungeonData& DungeonGenerator::generate(utils::SceneID id, sf::Vector2u grid_size) {
+	auto& result = allocate(id, grid_size);
+	if (!populate(result, rng)) {
+		log.error << "[Game/Generator] " << "The force has not been with the RNG oO\n";
+	}
+	return result;
 }
 
 DungeonData& DungeonGenerator::operator[](utils::SceneID id) {
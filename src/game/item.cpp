@@ -9,19 +9,22 @@ float const MAX_WORTH_MODIFIER = 1.1;
 float const MIN_DAMAGE_MODIFIER = 0.5;
 float const MAX_DAMAGE_MODIFIER = 1.1;
 
-void randomize(float& factor, float min_base, float max_base, float exp) {
-	factor = rpg::extrapolate(factor, thor::random(min_base, max_base), exp);
+void randomize(utils::RandomStream& rng, float& factor, float min_base,
+	float max_base, float exp) {
+	factor = rpg::extrapolate(factor, rng(min_base, max_base), exp);
 }
 
-void randomize(
-	std::uint32_t& factor, float min_base, float max_base, float exp) {
-	factor = rpg::extrapolate(factor, thor::random(min_base, max_base), exp);
+void randomize(utils::RandomStream& rng, std::uint32_t& factor,
+	float min_base, float max_base, float exp) {
+	factor = rpg::extrapolate(factor, rng(min_base, max_base), exp);
 }
 
-void randomize(rpg::ItemTemplate& item, std::size_t level) {
-	randomize(item.worth, MIN_WORTH_MODIFIER, MAX_WORTH_MODIFIER, level);
+void randomize(
+	utils::RandomStream& rng, rpg::ItemTemplate& item, std::size_t level) {
+	randomize(rng, item.worth, MIN_WORTH_MODIFIER, MAX_WORTH_MODIFIER, level);
 	for (auto& dmg : item.damage) {
-		randomize(dmg.second, MIN_DAMAGE_MODIFIER, MAX_DAMAGE_MODIFIER, level);
+		randomize(rng, dmg.second, MIN_DAMAGE_MODIFIER, MAX_DAMAGE_MODIFIER,
+			level);
 	}
 
 	// [TODO] also modify:
@@ -16,19 +16,26 @@ float const ENEMY_SPOT_SIGHT_RADIO = 0.75f;
 LuaApi::LuaApi(core::LogContext& log, core::ObjectID actor, bool hostile,
 	rpg::Session const& session, ScriptManager const& script,
 	core::InputSender& input_sender, rpg::ActionSender& action_sender,
-	rpg::ItemSender& item_sender, PathSystem& path)
+	rpg::ItemSender& item_sender, PathSystem& path,
+	NavigationSystem& navigation)
 	: log{log}
 	, id{actor}
 	, hostile{hostile}
+	, tick_rate{sf::Time::Zero}
 	, session{session}
 	, script{script}
 	, input_sender{input_sender}
 	, action_sender{action_sender}
 	, item_sender{item_sender}
+	, navigation{navigation}
 	, tracer{log, path, session.movement, input_sender, actor} {
 	ASSERT(actor > 0u);
 }
 
+void LuaApi::setTickRate(unsigned int ms) {
+	tick_rate = sf::milliseconds(ms);
+}
+
 bool LuaApi::isHostile(core::ObjectID target) const {
 	if (!script.has(target)) {
 		// not a script, not a bot
@@ -298,8 +305,33 @@ void LuaApi::navigate(sf::Vector2u const & target) {
 	}
 }
 
+void LuaApi::chase(core::ObjectID target) {
+	ASSERT(session.movement.has(id));
+	if (!session.movement.has(target)) {
+		// ignore: target does not exist anymore
+		return;
+	}
+	auto const& data = session.movement.query(id);
+	auto const& other = session.movement.query(target);
+	if (data.scene != other.scene) {
+		// ignore: target cannot be reached
+		return;
+	}
+	auto field = navigation.getFlowField(other.scene, target, other.target);
+	if (tracer.isFollowing(field.get())) {
+		// note: the tracer steps on each tile reached
+		return;
+	}
+	if (field->getDirection(sf::Vector2u{data.pos}) == sf::Vector2i{}) {
+		// field does not cover the actor (yet)
+		navigate(other.target);
+		return;
+	}
+	tracer.follow(field);
+}
+
 void LuaApi::move(sf::Vector2i dir) {
-	if (hasPath()) {
+	if (hasPath() || tracer.isFollowing()) {
 		tracer.reset();
 	}
 	core::fixDirection(dir);
@@ -316,7 +348,7 @@ void LuaApi::moveTowards(sf::Vector2u pos) {
 }
 
 void LuaApi::look(sf::Vector2i dir) {
-	if (hasPath()) {
+	if (hasPath() || tracer.isFollowing()) {
 		tracer.reset();
 	}
 	core::fixDirection(dir);
@@ -303,6 +303,8 @@ Mod::Mod(core::LogContext& log, ResourceCache& cache, std::string const & name)
 	: log{log}
 	, cache{cache}
 	, processed_tilesets{}
+	, scripts{}
+	, script_seed{0u}
 	, name{name} {
 }
 
@@ -488,6 +490,8 @@ bool Mod::verify(utils::Logger& log) {
 AiScript& Mod::createScript(std::string const & fname) {
 	scripts.emplace_back();
 	auto& script = scripts.back();
+	script.seed(utils::RandomStream::derive(script_seed,
+		static_cast<std::uint32_t>(scripts.size())));
 	auto filename = get_filename<AiScript>(fname);
 	ASSERT(script.loadFromFile(filename));
 	return script;
@@ -497,6 +501,10 @@ std::list<AiScript>& Mod::getAllScripts() {
 	return scripts;
 }
 
+void Mod::setScriptSeed(std::uint32_t seed) {
+	script_seed = seed;
+}
+
 std::vector<sf::Texture const *> Mod::getAllAmbiences() {
 	std::vector<sf::Texture const *> out;
 	auto path = get_path<sf::Texture>() + "/ambience";
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <utils/assert.hpp>
 
 #include <core/collision.hpp>
@@ -8,6 +11,10 @@ namespace game {
 
 namespace navigator_impl {
 
+float const FLOW_FIELD_RANGE = 30.f;
+std::size_t const FLOW_FIELD_BUDGET = 4096u;
+std::size_t const FLOW_FIELD_TTL = 120u;
+
 float distance(sf::Vector2u const& u, sf::Vector2u const& v) {
 	auto dx = utils::distance(u.x, v.x);
 	auto dy = utils::distance(u.y, v.y);
@@ -18,6 +25,27 @@ float distance(sf::Vector2u const& u, sf::Vector2u const& v) {
 	return (max - min) + min * 1.414f;
 }
 
+bool canTraverse(core::Dungeon const& dungeon, sf::Vector2u const& pos) {
+	if (!dungeon.has(pos)) {
+		// ignore: invalid pos
+		return false;
+	}
+	if (core::checkTileCollision(dungeon.getTerrain(pos))) {
+		// ignore: tile collision
+		return false;
+	}
+	auto const& cell = dungeon.getCell(pos);
+	if (cell.trigger != nullptr && dynamic_cast<core::TeleportTrigger*>(cell.trigger.get()) != nullptr) {
+		// ignore: teleport triggers
+		return false;
+	}
+	return true;
+}
+
+sf::Vector2u getPortal(sf::Vector2u const& u, sf::Vector2u const& v) {
+	return {(u.x + v.x) / 2u, (u.y + v.y) / 2u};
+}
+
 }  // ::navigator_impl
 
 // ---------------------------------------------------------------------------
@@ -107,7 +135,11 @@ std::vector<sf::Vector2u> DungeonGraph::getNeighbors(
 
 NavigationScene::NavigationScene(
 	core::CollisionManager const& collision, core::Dungeon const& dungeon)
-	: collision{collision}, dungeon{dungeon} {}
+	: collision{collision}
+	, dungeon{dungeon}
+	, walkable{nullptr}
+	, snapshot{nullptr}
+	, snapshot_revision{0u} {}
 
 float NavigationScene::getDistance(
 	sf::Vector2u const& u, sf::Vector2u const& v) const {
@@ -134,19 +166,11 @@ std::vector<sf::Vector2u> NavigationScene::getNeighbors(
 				continue;
 			}
 			auto next = sf::Vector2u{sf::Vector2i{pos} + delta};
-			if (!dungeon.has(next)) {
-				// ignore: invalid pos
+			if (!navigator_impl::canTraverse(dungeon, next)) {
+				// ignore: invalid pos, tile collision or teleport trigger
 				continue;
 			}
 			auto const& cell = dungeon.getCell(next);
-			if (core::checkTileCollision(cell)) {
-				// ignore: tile collision
-				continue;
-			}
-			if (cell.trigger != nullptr && dynamic_cast<core::TeleportTrigger*>(cell.trigger.get()) != nullptr) {
-				// ignore: teleport triggers
-				continue;
-			}
 			auto colliders = core::checkObjectCollision(collision, cell, coll_data);
 			bool hit{false};
 			for (auto id: colliders) {
@@ -186,11 +210,11 @@ bool NavigationScene::canAccess(core::ObjectID actor,
 		// ignore: invalid pos
 		return false;
 	}
-	auto const& cell = dungeon.getCell(pos);
-	if (core::checkTileCollision(cell)) {
+	if (core::checkTileCollision(dungeon.getTerrain(pos))) {
 		// ignore: tile collision
 		return false;
 	}
+	auto const& cell = dungeon.getCell(pos);
 	if (!collision.has(actor)) {
 		// actor seems to be dead
 		return false;
@@ -205,24 +229,476 @@ bool NavigationScene::canAccess(core::ObjectID actor,
 
 // ---------------------------------------------------------------------------
 
-Navigator::Navigator(DungeonGraph&& graph, NavigationScene&& scene)
+core::Dungeon const& NavigationScene::getDungeon() const { return dungeon; }
+
+core::CollisionManager const& NavigationScene::getCollision() const {
+	return collision;
+}
+
+std::shared_ptr<WalkableMap const> NavigationScene::getWalkable() const {
+	if (walkable != nullptr) {
+		return walkable;
+	}
+	auto size = dungeon.getSize();
+	auto tiles = std::make_shared<WalkableMap>(size.x * size.y, 0u);
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < size.y; ++pos.y) {
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			(*tiles)[pos.x + pos.y * size.x] =
+				navigator_impl::canTraverse(dungeon, pos);
+		}
+	}
+	walkable = std::move(tiles);
+	return walkable;
+}
+
+NavigationSnapshot NavigationScene::createSnapshot() const {
+	NavigationSnapshot snapshot{dungeon.getSize(), getWalkable()};
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < snapshot.size.y; ++pos.y) {
+		for (pos.x = 0u; pos.x < snapshot.size.x; ++pos.x) {
+			auto const & entities = dungeon.getCell(pos).entities;
+			if (entities.empty()) {
+				continue;
+			}
+			auto index = pos.x + pos.y * snapshot.size.x;
+			// note: cells are visited by increasing index
+			for (auto id: entities) {
+				if (!collision.has(id) || collision.query(id).is_projectile) {
+					// ignore: object cannot block an actor
+					continue;
+				}
+				snapshot.occupants.emplace_back(index, id);
+			}
+		}
+	}
+	return snapshot;
+}
+
+std::shared_ptr<NavigationSnapshot const> NavigationScene::getSnapshot() const {
+	auto revision = dungeon.getRevision();
+	if (snapshot == nullptr || snapshot_revision != revision) {
+		snapshot = std::make_shared<NavigationSnapshot const>(createSnapshot());
+		snapshot_revision = revision;
+	}
+	return snapshot;
+}
+
+// ---------------------------------------------------------------------------
+
+NavigationSnapshot::NavigationSnapshot(sf::Vector2u const& size,
+	std::shared_ptr<WalkableMap const> walkable)
+	: size{size}
+	, walkable{std::move(walkable)}
+	, occupants{} {
+	ASSERT(this->walkable != nullptr);
+	ASSERT(this->walkable->size() == size.x * size.y);
+}
+
+// ---------------------------------------------------------------------------
+
+SnapshotScene::SnapshotScene(sf::Vector2u const& size)
+	: size{size}
+	, snapshot{nullptr} {
+}
+
+void SnapshotScene::setSnapshot(
+	std::shared_ptr<NavigationSnapshot const> snapshot) {
+	ASSERT(snapshot == nullptr || snapshot->size == size);
+	this->snapshot = std::move(snapshot);
+}
+
+float SnapshotScene::getDistance(
+	sf::Vector2u const& u, sf::Vector2u const& v) const {
+	return navigator_impl::distance(u, v);
+}
+
+sf::Vector2u SnapshotScene::getSize() const { return size; }
+
+std::vector<sf::Vector2u> SnapshotScene::getNeighbors(
+	core::ObjectID actor, sf::Vector2u const& pos,
+	std::vector<core::ObjectID> const& ignore) const {
+	ASSERT(snapshot != nullptr);
+	auto const& occupants = snapshot->occupants;
+	auto compare = [](std::pair<std::size_t, core::ObjectID> const& lhs,
+		std::size_t rhs) { return lhs.first < rhs; };
+	
+	std::vector<sf::Vector2u> straight, neighbors;
+	sf::Vector2i delta;
+	for (delta.y = -1; delta.y <= 1; ++delta.y) {
+		for (delta.x = -1; delta.x <= 1; ++delta.x) {
+			if (delta.x == 0 && delta.y == 0) {
+				// ignore: invalid direction
+				continue;
+			}
+			auto next = sf::Vector2u{sf::Vector2i{pos} + delta};
+			if (next.x >= size.x || next.y >= size.y) {
+				// ignore: invalid pos
+				continue;
+			}
+			auto index = next.x + next.y * size.x;
+			if (!(*snapshot->walkable)[index]) {
+				// ignore: tile collision or teleport trigger
+				continue;
+			}
+			auto i = std::lower_bound(occupants.begin(), occupants.end(),
+				index, compare);
+			bool hit{false};
+			for (; i != occupants.end() && i->first == index; ++i) {
+				if (i->second != actor && !utils::contains(ignore, i->second)) {
+					// ignore: object collision
+					hit = true;
+					break;
+				}
+			}
+			if (hit) {
+				continue;
+			}
+			
+			// add position (categorized by kind of direction)
+			if (delta.x * delta.y == 0) {
+				straight.push_back(next);
+			} else {
+				neighbors.push_back(next);
+			}
+		}
+	}
+	
+	// add straights to neighbors (so they get a lower priority)
+	utils::append(neighbors, straight);
+
+	return neighbors;
+}
+
+// ---------------------------------------------------------------------------
+
+TerrainScene::TerrainScene(core::Dungeon const& dungeon)
+	: dungeon{dungeon} {}
+
+float TerrainScene::getDistance(
+	sf::Vector2u const& u, sf::Vector2u const& v) const {
+	return navigator_impl::distance(u, v);
+}
+
+sf::Vector2u TerrainScene::getSize() const { return dungeon.getSize(); }
+
+std::vector<sf::Vector2u> TerrainScene::getNeighbors(
+	core::ObjectID actor, sf::Vector2u const& pos,
+	std::vector<core::ObjectID> const& ignore) const {
+	std::vector<sf::Vector2u> straight, neighbors;
+	sf::Vector2i delta;
+	for (delta.y = -1; delta.y <= 1; ++delta.y) {
+		for (delta.x = -1; delta.x <= 1; ++delta.x) {
+			if (delta.x == 0 && delta.y == 0) {
+				// ignore: invalid direction
+				continue;
+			}
+			auto next = sf::Vector2u{sf::Vector2i{pos} + delta};
+			if (!navigator_impl::canTraverse(dungeon, next)) {
+				continue;
+			}
+			// add position (categorized by kind of direction)
+			if (delta.x * delta.y == 0) {
+				straight.push_back(next);
+			} else {
+				neighbors.push_back(next);
+			}
+		}
+	}
+	
+	// add straights to neighbors (so they get a lower priority)
+	utils::append(neighbors, straight);
+
+	return neighbors;
+}
+
+// ---------------------------------------------------------------------------
+
+FlowField::FlowField(TerrainScene const& terrain, float range)
+	: terrain{terrain}
+	, size{terrain.getSize()}
+	, range{range}
+	, target{}
+	, distances(size.x * size.y, std::numeric_limits<float>::infinity())
+	, directions(size.x * size.y)
+	, valid{false}
+	, next_target{}
+	, next_distances(size.x * size.y, std::numeric_limits<float>::infinity())
+	, next_directions(size.x * size.y)
+	, closed(size.x * size.y, false)
+	, touched{}
+	, covered{}
+	, openlist{utils::CoordHash{size}}
+	, pending{false} {
+}
+
+std::size_t FlowField::getIndex(sf::Vector2u const& pos) const {
+	return pos.x + pos.y * size.x;
+}
+
+void FlowField::setTarget(sf::Vector2u const& target) {
+	if (pending ? next_target == target : valid && this->target == target) {
+		// field is (or will be) up to date
+		return;
+	}
+	if (target.x >= size.x || target.y >= size.y) {
+		// ignore: invalid pos
+		return;
+	}
+	
+	// reset tiles reached by the previous calculation
+	for (auto index: touched) {
+		next_distances[index] = std::numeric_limits<float>::infinity();
+		next_directions[index] = {};
+		closed[index] = false;
+	}
+	touched.clear();
+	openlist.clear();
+	
+	// start at the target
+	auto index = getIndex(target);
+	next_target = target;
+	next_distances[index] = 0.f;
+	touched.push_back(index);
+	openlist.insert(target, 0.f);
+	pending = true;
+}
+
+bool FlowField::resume(std::size_t& budget) {
+	while (pending && budget > 0u) {
+		if (openlist.empty()) {
+			// replace previous field
+			for (auto index: touched) {
+				closed[index] = false;
+			}
+			std::swap(distances, next_distances);
+			std::swap(directions, next_directions);
+			// note: the previous field's tiles are reset on next start
+			std::swap(touched, covered);
+			target = next_target;
+			valid = true;
+			pending = false;
+			break;
+		}
+		auto pos = openlist.extract();
+		auto index = getIndex(pos);
+		closed[index] = true;
+		--budget;
+		
+		for (auto const& next: terrain.getNeighbors(0u, pos)) {
+			auto other = getIndex(next);
+			if (closed[other]) {
+				continue;
+			}
+			auto dist = next_distances[index] + terrain.getDistance(pos, next);
+			if (dist > range || dist >= next_distances[other]) {
+				continue;
+			}
+			bool open = next_distances[other] < std::numeric_limits<float>::infinity();
+			next_distances[other] = dist;
+			next_directions[other] = Direction{
+				static_cast<std::int8_t>(static_cast<int>(pos.x) - static_cast<int>(next.x)),
+				static_cast<std::int8_t>(static_cast<int>(pos.y) - static_cast<int>(next.y))};
+			if (open) {
+				openlist.decrease(next, dist);
+			} else {
+				touched.push_back(other);
+				openlist.insert(next, dist);
+			}
+		}
+	}
+	return !pending;
+}
+
+bool FlowField::isPending() const { return pending; }
+
+bool FlowField::isValid() const { return valid; }
+
+sf::Vector2u FlowField::getTarget() const {
+	ASSERT(valid);
+	return target;
+}
+
+float FlowField::getDistance(sf::Vector2u const& pos) const {
+	if (!valid || pos.x >= size.x || pos.y >= size.y) {
+		return std::numeric_limits<float>::infinity();
+	}
+	return distances[getIndex(pos)];
+}
+
+sf::Vector2i FlowField::getDirection(sf::Vector2u const& pos) const {
+	if (!valid || pos.x >= size.x || pos.y >= size.y) {
+		return {};
+	}
+	return sf::Vector2i{directions[getIndex(pos)]};
+}
+
+// ---------------------------------------------------------------------------
+
+NavigationPlan::NavigationPlan()
+	: direct{true}
+	, source{}
+	, target{}
+	, first_portal{}
+	, last_portal{}
+	, max_length{0u}
+	, leg_length{0u}
+	, corridor{} {
+}
+
+// ---------------------------------------------------------------------------
+
+Navigator::Navigator(DungeonGraph&& graph, NavigationScene&& scene,
+	unsigned int cell_size)
 	: graph{std::move(graph)}
 	, scene{std::move(scene)}
+	, terrain{this->scene.getDungeon()}
+	, cell_size{cell_size}
 	, broadphase{this->graph}
-	, narrowphase{this->scene} {
+	, narrowphase{this->scene}
+	, corridorphase{this->terrain}
+	, routes{}
+	, corridors{}
+	, search{narrowphase} {
+}
+
+sf::Vector2u Navigator::getCenter(sf::Vector2u const& pos) const {
+	return {pos.x / cell_size * cell_size + cell_size / 2u,
+		pos.y / cell_size * cell_size + cell_size / 2u};
+}
+
+std::uint64_t Navigator::getKey(sf::Vector2u const& u,
+	sf::Vector2u const& v) const {
+	ASSERT(u.x <= 0xFFFFu && u.y <= 0xFFFFu);
+	ASSERT(v.x <= 0xFFFFu && v.y <= 0xFFFFu);
+	return static_cast<std::uint64_t>(u.x)
+		| static_cast<std::uint64_t>(u.y) << 16u
+		| static_cast<std::uint64_t>(v.x) << 32u
+		| static_cast<std::uint64_t>(v.y) << 48u;
+}
+
+utils::Path const& Navigator::getRoute(sf::Vector2u const& src,
+	sf::Vector2u const& dst) {
+	auto key = getKey(src, dst);
+	auto i = routes.find(key);
+	if (i == routes.end()) {
+		// note: the graph does not depend on the actor or its length
+		i = routes.emplace(key, broadphase(0u, src, dst, 0u)).first;
+	}
+	return i->second;
+}
+
+utils::Path const& Navigator::getCorridor(sf::Vector2u const& src,
+	sf::Vector2u const& dst) {
+	auto key = getKey(src, dst);
+	auto i = corridors.find(key);
+	if (i == corridors.end()) {
+		i = corridors.emplace(key, corridorphase(0u, src, dst, 3u * cell_size)).first;
+	}
+	return i->second;
+}
+
+NavigationPlan Navigator::plan(sf::Vector2u const& source,
+	sf::Vector2u const& target, std::size_t max_length) {
+	NavigationPlan plan;
+	plan.source = source;
+	plan.target = target;
+	plan.max_length = max_length;
+	
+	if (cell_size == 0u) {
+		return plan;
+	}
+	
+	// determine rooms
+	auto const src = getCenter(source);
+	auto const dst = getCenter(target);
+	auto const size = graph.getSize();
+	if (src == dst || src.x >= size.x || src.y >= size.y || dst.x >= size.x
+		|| dst.y >= size.y || graph.getNode(src) == nullptr
+		|| graph.getNode(dst) == nullptr) {
+		// no hierarchy necessary or possible
+		return plan;
+	}
+	auto const& route = getRoute(src, dst);
+	if (route.size() < 2u || route.front() != dst) {
+		// rooms are not connected
+		return plan;
+	}
+	
+	// determine portals (from source to target)
+	std::vector<sf::Vector2u> portals;
+	portals.reserve(route.size() - 1u);
+	for (auto i = route.size() - 1u; i > 0u; --i) {
+		portals.push_back(navigator_impl::getPortal(route[i], route[i - 1u]));
+	}
+	
+	// legs between two portals: terrain only, cached per layout
+	// note: all paths start with their target, so the legs are composed
+	// backwards
+	for (auto i = portals.size() - 1u; i > 0u; --i) {
+		auto const& leg = getCorridor(portals[i - 1u], portals[i]);
+		if (leg.empty() || leg.front() != portals[i]) {
+			// portals are not connected via terrain
+			plan.corridor.clear();
+			return plan;
+		}
+		plan.corridor.insert(plan.corridor.end(), std::next(leg.begin()),
+			leg.end());
+	}
+	
+	plan.direct = false;
+	plan.first_portal = portals.front();
+	plan.last_portal = portals.back();
+	plan.leg_length = 3u * cell_size;
+	return plan;
+}
+
+void Navigator::start(core::ObjectID actor, sf::Vector2u const& source,
+	sf::Vector2u const& target, std::size_t max_length,
+	std::vector<core::ObjectID> const& ignore) {
+	search.start(actor, plan(source, target, max_length), ignore);
+}
+
+bool Navigator::resume(std::size_t& budget) {
+	return search.resume(budget);
+}
+
+utils::Path Navigator::getPath() const {
+	return search.getPath();
+}
+
+utils::Path Navigator::operator()(core::ObjectID actor,
+	sf::Vector2u const& source, sf::Vector2u const& target,
+	std::size_t max_length) {
+	start(actor, source, target, max_length);
+	
+	auto budget = std::numeric_limits<std::size_t>::max();
+	resume(budget);
+	
+	return getPath();
 }
 
 // ---------------------------------------------------------------------------
 
+namespace navigator_impl {
+
+FlowEntry::FlowEntry(TerrainScene const& terrain)
+	: field{std::make_shared<FlowField>(terrain, FLOW_FIELD_RANGE)}
+	, idle{0u} {
+}
+
+}  // ::navigator_impl
+
+// ---------------------------------------------------------------------------
+
 NavigationSystem::NavigationSystem()
-	: navis{} {
+	: navis{}
+	, fields{} {
 }
 
-Navigator& NavigationSystem::create(utils::SceneID id,
+std::unique_ptr<Navigator> NavigationSystem::build(
 	core::CollisionManager const& collision, core::Dungeon const& dungeon,
-	DungeonBuilder const& builder) {
-	ASSERT(id > 0u);
-	ASSERT(navis.size() == id - 1u);
+	DungeonBuilder const& builder, unsigned int cell_size) {
 	// create graph
 	DungeonGraph graph{builder.grid_size};
 	for (auto const& path : builder.paths) {
@@ -237,10 +713,24 @@ Navigator& NavigationSystem::create(utils::SceneID id,
 	// create scene
 	NavigationScene scene{collision, dungeon};
 	// create navigation
-	navis.push_back(nullptr);
-	auto& tmp = navis.back();
-	tmp = std::make_unique<Navigator>(std::move(graph), std::move(scene));
-	return *tmp;
+	return std::make_unique<Navigator>(std::move(graph), std::move(scene),
+		cell_size);
+}
+
+Navigator& NavigationSystem::add(utils::SceneID id,
+	std::unique_ptr<Navigator> navigator) {
+	ASSERT(id > 0u);
+	ASSERT(navis.size() == id - 1u);
+	ASSERT(navigator != nullptr);
+	navis.push_back(std::move(navigator));
+	fields.emplace_back();
+	return *navis.back();
+}
+
+Navigator& NavigationSystem::create(utils::SceneID id,
+	core::CollisionManager const& collision, core::Dungeon const& dungeon,
+	DungeonBuilder const& builder, unsigned int cell_size) {
+	return add(id, build(collision, dungeon, builder, cell_size));
 }
 
 Navigator& NavigationSystem::operator[](utils::SceneID id) {
@@ -248,7 +738,41 @@ Navigator& NavigationSystem::operator[](utils::SceneID id) {
 	return *navis.at(id - 1u);
 }
 
+std::shared_ptr<FlowField const> NavigationSystem::getFlowField(
+	utils::SceneID id, core::ObjectID target, sf::Vector2u const& pos) {
+	ASSERT(id > 0u);
+	auto& scene = fields.at(id - 1u);
+	auto i = scene.find(target);
+	if (i == scene.end()) {
+		i = scene.emplace(target,
+			navigator_impl::FlowEntry{navis[id - 1u]->terrain}).first;
+	}
+	auto& entry = i->second;
+	entry.idle = 0u;
+	entry.field->setTarget(pos);
+	return entry.field;
+}
+
+void NavigationSystem::update(std::size_t budget) {
+	for (auto& scene: fields) {
+		auto i = scene.begin();
+		while (i != scene.end()) {
+			auto& entry = i->second;
+			if (++entry.idle > navigator_impl::FLOW_FIELD_TTL) {
+				// note: actors might still use the field
+				i = scene.erase(i);
+				continue;
+			}
+			if (budget > 0u) {
+				entry.field->resume(budget);
+			}
+			++i;
+		}
+	}
+}
+
 void NavigationSystem::clear() {
+	fields.clear();
 	navis.clear();
 }
 
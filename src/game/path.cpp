@@ -1,7 +1,10 @@
+#include <algorithm>
+#include <cmath>
 #include <SFML/System/Clock.hpp>
 
 #include <utils/assert.hpp>
 #include <utils/algorithm.hpp>
+#include <core/collision.hpp>
 #include <core/teleport.hpp>
 #include <game/path.hpp>
 
@@ -10,13 +13,59 @@ namespace game {
 namespace path_impl {
 
 std::size_t const MAX_PATH_LENGTH = 30u;
+std::size_t const EXPANSION_SLICE = 32u;
+std::size_t const MAX_EXPANSIONS = 4096u;
+std::size_t const MAX_WORKERS = 4u;
+std::size_t const MAX_SEARCHES = 4u;
+
+std::size_t getDefaultWorkers() {
+	// keep one core for the game's thread
+	auto num_cores = std::max(1u, std::thread::hardware_concurrency());
+	return std::min<std::size_t>(num_cores - 1u, MAX_WORKERS);
+}
+
+std::size_t getMaxLength(sf::Vector2u const& source,
+	sf::Vector2u const& target) {
+	auto dist = static_cast<unsigned int>(std::ceil(
+		navigator_impl::distance(source, target)));
+	return std::max(20u, dist * 3u);
+}
+
+Search::Search(NavigationScene const& scene)
+	: narrowphase{scene}
+	, search{narrowphase} {}
+
+SearchPool::SearchPool()
+	: idle{}
+	, num_active{0u} {}
+
 Request::Request()
 	: actor{0u}
 	, scene{0u}
 	, source{}
 	, target{}
+	, path{}
+	, search{nullptr}
+	, expanded{0u} {}
+
+Job::Job()
+	: actor{0u}
+	, scene{0u}
+	, snapshot{nullptr}
+	, plan{}
+	, ignore{}
 	, path{} {}
 
+Worker::Worker(sf::Vector2u const& size)
+	: scene{size}
+	, narrowphase{scene}
+	, search{narrowphase} {}
+
+Stats::Stats()
+	: completed{0u}
+	, pending{0u}
+	, expanded{0u} {}
+
 }  // ::path_impl
 
 // ---------------------------------------------------------------------------
@@ -24,12 +73,55 @@ Request::Request()
 PathSystem::PathSystem(core::LogContext& log)
 	: log{log}
 	, scenes{}
-	, requests{} {}
+	, pools{}
+	, requests{}
+	, stats{}
+	, workers{}
+	, jobs{}
+	, mutex{}
+	, condition{}
+	, running{false}
+	, busy{0u}
+	, completed{0u}
+	, expanded{0u} {}
+
+PathSystem::~PathSystem() {
+	stop();
+}
+
+void PathSystem::start(std::size_t num_workers) {
+	ASSERT(workers.empty());
+	running = true;
+	workers.reserve(num_workers);
+	for (auto i = 0u; i < num_workers; ++i) {
+		workers.emplace_back(&PathSystem::work, this);
+	}
+}
+
+void PathSystem::stop() {
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		running = false;
+	}
+	condition.notify_all();
+	for (auto& worker: workers) {
+		worker.join();
+	}
+	workers.clear();
+	
+	// populate remaining jobs
+	for (auto& job: jobs) {
+		job.path.set_value({job.plan.source});
+	}
+	jobs.clear();
+}
 
 void PathSystem::addScene(utils::SceneID id, Navigator& navigator) {
 	scenes.resize(id + 1u);
+	pools.resize(id + 1u);
 	// register scene with navigation
 	scenes[id] = &navigator;
+	pools[id] = path_impl::SearchPool{};
 }
 
 std::future<Path> PathSystem::schedule(core::ObjectID actor,
@@ -39,11 +131,10 @@ std::future<Path> PathSystem::schedule(core::ObjectID actor,
 	ASSERT(scenes[scene] != nullptr);
 
 	path_impl::Request* request{nullptr};
-	auto i = requests.begin();
-	++i; // ignore front
-	for (; i != requests.end(); ++i) {
-		if (i->actor == actor) {
-			request = &*i;
+	for (auto& pending: requests) {
+		if (pending.search == nullptr && pending.actor == actor) {
+			// note: a started request is continued instead
+			request = &pending;
 			break;
 		}
 	}
@@ -64,36 +155,184 @@ std::future<Path> PathSystem::schedule(core::ObjectID actor,
 	return request->path.get_future();
 }
 
-std::size_t PathSystem::calculate(sf::Time const& max_elapse) {
+void PathSystem::release(path_impl::Request& request) {
+	if (request.search == nullptr) {
+		return;
+	}
+	// keep search for the scene's next request
+	auto& pool = pools[request.scene];
+	ASSERT(pool.num_active > 0u);
+	--pool.num_active;
+	pool.idle.push_back(std::move(request.search));
+}
+
+std::size_t PathSystem::calculateSync(sf::Time const& max_elapse) {
 	sf::Clock clock;
-	sf::Time min{max_elapse * 10.f}, max{sf::Time::Zero}, avg{sf::Time::Zero};
+	// note: at least one slice is calculated per call
+	bool progressed{false};
 	
-	for (auto& current: requests) {
-		// determine maximum path length
-		auto dist = static_cast<unsigned int>(std::ceil(navigator_impl::distance(current.source, current.target)));
-		auto max_length = std::max(20u, dist * 3u);
+	while (!requests.empty() &&
+		(!progressed || clock.getElapsedTime() < max_elapse)) {
+		auto current = requests.begin();
+		auto& navi = *scenes[current->scene];
 		
-		// trigger pathfinding
-		auto& navi = *scenes[current.scene];
-		auto path = navi.narrowphase(current.actor, current.source, current.target, max_length);
-		current.path.set_value(std::move(path));
+		if (current->search == nullptr) {
+			auto const & collision = navi.scene.getCollision();
+			if (!collision.has(current->actor)) {
+				// actor seems to be dead
+				current->path.set_value({current->source});
+				requests.erase(current);
+				++stats.completed;
+				progressed = true;
+				continue;
+			}
+			auto& pool = pools[current->scene];
+			if (pool.idle.empty()) {
+				if (pool.num_active >= path_impl::MAX_SEARCHES) {
+					// all searches of this scene are suspended: retry later
+					requests.splice(requests.end(), requests, current);
+					continue;
+				}
+				pool.idle.push_back(
+					std::make_unique<path_impl::Search>(navi.scene));
+			}
+			current->search = std::move(pool.idle.back());
+			pool.idle.pop_back();
+			++pool.num_active;
+			// trigger (hierarchical) pathfinding
+			// note: ignore the same objects as the workers do
+			current->search->search.start(current->actor,
+				navi.plan(current->source, current->target,
+					path_impl::getMaxLength(current->source, current->target)),
+				collision.query(current->actor).ignore);
+		}
+		
+		// continue pathfinding for a slice of nodes
+		auto const slice = std::min(path_impl::EXPANSION_SLICE,
+			path_impl::MAX_EXPANSIONS - current->expanded);
+		auto budget = slice;
+		auto done = current->search->search.resume(budget);
+		current->expanded += slice - budget;
+		stats.expanded += slice - budget;
+		progressed = true;
+		
+		if (!done) {
+			if (current->expanded < path_impl::MAX_EXPANSIONS) {
+				// continue after all other requests had their turn
+				requests.splice(requests.end(), requests, current);
+				continue;
+			}
+			log.debug << "[Game/Path] Request of actor #" << current->actor
+				<< " stopped after " << current->expanded << " nodes\n";
+		}
 		
-		auto delta = clock.restart();
-		min = std::min(min, delta);
-		max = std::max(max, delta);
-		avg += delta;
+		current->path.set_value(current->search->search.getPath());
+		release(*current);
+		requests.erase(current);
+		++stats.completed;
 	}
 	
-	auto n = requests.size();
+	stats.pending = requests.size();
+	
+	return stats.completed;
+}
+
+std::size_t PathSystem::dispatch() {
+	std::deque<path_impl::Job> batch;
+	std::size_t finished{0u};
+	
+	for (auto& request: requests) {
+		// note: a suspended search is restarted by the workers
+		release(request);
+		auto& navi = *scenes[request.scene];
+		auto const & collision = navi.scene.getCollision();
+		if (!collision.has(request.actor)) {
+			// actor seems to be dead
+			request.path.set_value({request.source});
+			++finished;
+			continue;
+		}
+		// plan request (using cached routes and corridors)
+		batch.emplace_back();
+		auto& job = batch.back();
+		job.actor = request.actor;
+		job.scene = request.scene;
+		// note: the snapshot is shared until the scene's occupancy changes
+		job.snapshot = navi.scene.getSnapshot();
+		job.plan = navi.plan(request.source, request.target,
+			path_impl::getMaxLength(request.source, request.target));
+		job.ignore = collision.query(request.actor).ignore;
+		job.path = std::move(request.path);
+	}
 	requests.clear();
 	
-	if (n > 0u && max > sf::milliseconds(5u)) {
-		log.debug << "[Game/Path] " << n << " paths calculated within "
-			<< avg << " (min: " << min << ", max: " << max << ", avg: "
-			<< (avg / (1.f * n)) << ")\n";
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		for (auto& job: batch) {
+			jobs.push_back(std::move(job));
+		}
+		stats.completed = completed + finished;
+		stats.expanded = expanded;
+		stats.pending = jobs.size() + busy;
+		completed = 0u;
+		expanded = 0u;
 	}
+	condition.notify_all();
+	
+	return stats.completed;
+}
+
+void PathSystem::work() {
+	// pathfinding objects of this worker, created per scene on demand
+	std::vector<std::unique_ptr<path_impl::Worker>> contexts;
 	
-	return n;
+	std::unique_lock<std::mutex> lock{mutex};
+	while (true) {
+		condition.wait(lock, [&]() { return !running || !jobs.empty(); });
+		if (!running) {
+			break;
+		}
+		auto job = std::move(jobs.front());
+		jobs.pop_front();
+		++busy;
+		lock.unlock();
+		
+		auto const & size = job.snapshot->size;
+		if (contexts.size() <= job.scene) {
+			contexts.resize(job.scene + 1u);
+		}
+		auto& context = contexts[job.scene];
+		if (context == nullptr || context->scene.getSize() != size) {
+			// note: a scene id might be reused by another dungeon
+			context = std::make_unique<path_impl::Worker>(size);
+		}
+		
+		// calculate path based on the snapshot
+		// note: a capped search provides the closest path
+		context->scene.setSnapshot(job.snapshot);
+		context->search.start(job.actor, job.plan, job.ignore);
+		auto budget = path_impl::MAX_EXPANSIONS;
+		context->search.resume(budget);
+		job.path.set_value(context->search.getPath());
+		context->scene.setSnapshot(nullptr);
+		
+		lock.lock();
+		--busy;
+		++completed;
+		expanded += path_impl::MAX_EXPANSIONS - budget;
+	}
+}
+
+std::size_t PathSystem::calculate(sf::Time const& max_elapse) {
+	if (!workers.empty()) {
+		return dispatch();
+	}
+	stats = path_impl::Stats{};
+	return calculateSync(max_elapse);
+}
+
+path_impl::Stats const & PathSystem::getStats() const {
+	return stats;
 }
 
 }  // ::rage
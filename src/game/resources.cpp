@@ -13,7 +13,8 @@ GeneratorSettings::GeneratorSettings()
 	, room_density{0.5f}
 	, deadend_density{0.1f}
 	, ambience_density{0.25f}
-	, redundant_paths_ratio{0.25f} {}
+	, redundant_paths_ratio{0.25f}
+	, seed{0u} {}
 
 void GeneratorSettings::loadFromTree(utils::ptree_type const& ptree) {
 	cell_size = ptree.get<unsigned int>("<xmlattr>.cell_size");
@@ -25,6 +26,7 @@ void GeneratorSettings::loadFromTree(utils::ptree_type const& ptree) {
 	deadend_density = ptree.get<float>("<xmlattr>.deadend_density");
 	ambience_density = ptree.get<float>("<xmlattr>.ambience_density");
 	redundant_paths_ratio = ptree.get<float>("<xmlattr>.redundant_paths_ratio");
+	seed = ptree.get<std::uint32_t>("<xmlattr>.seed", 0u);
 }
 
 void GeneratorSettings::saveToTree(utils::ptree_type& ptree) const {
@@ -33,6 +35,7 @@ void GeneratorSettings::saveToTree(utils::ptree_type& ptree) const {
 	ptree.put("<xmlattr>.deadend_density", deadend_density);
 	ptree.put("<xmlattr>.ambience_density", ambience_density);
 	ptree.put("<xmlattr>.redundant_paths_ratio", redundant_paths_ratio);
+	ptree.put("<xmlattr>.seed", seed);
 }
 
 void GeneratorSettings::verify() const {
@@ -59,7 +62,8 @@ BotTemplate::BotTemplate()
 	, properties{0.f}
 	, items{}
 	, perks{}
-	, entity{nullptr} {}
+	, entity{nullptr}
+	, tick_rate{0u} {}
 
 void BotTemplate::loadFromTree(utils::ptree_type const& ptree) {
 	// parse general data
@@ -71,6 +75,7 @@ void BotTemplate::loadFromTree(utils::ptree_type const& ptree) {
 	} else {
 		color = sf::Color::White;
 	}
+	tick_rate = ptree.get<unsigned int>("general.<xmlattr>.tick_rate", 0u);
 	// parse attributes
 	rpg::parse(ptree, attributes, "attributes");
 	// parse boni
@@ -99,6 +104,9 @@ void BotTemplate::saveToTree(utils::ptree_type& ptree) const {
 	utils::ptree_type c;
 	rpg::dump(c, color);
 	ptree.add_child("general.color", c);
+	if (tick_rate > 0u) {
+		ptree.put("general.<xmlattr>.tick_rate", tick_rate);
+	}
 	// dump attributes
 	rpg::dump(ptree, attributes, "attributes");
 	// dump boni
@@ -308,7 +316,38 @@ bool operator!=(RoomTemplate const & lhs, RoomTemplate const & rhs) {
 
 // ---------------------------------------------------------------------------
 
-AiScript::AiScript() : utils::Script{} { bindAll(*this); }
+AiScript::AiScript()
+	: utils::Script{}
+	, callbacks{} {
+	bindAll(*this);
+}
+
+bool AiScript::loadFromMemory(std::string const& string) {
+	auto result = utils::Script::loadFromMemory(string);
+	refresh();
+	return result;
+}
+
+bool AiScript::loadFromFile(std::string const& fname) {
+	auto result = utils::Script::loadFromFile(fname);
+	refresh();
+	return result;
+}
+
+void AiScript::refresh() {
+	for (auto& pair : callbacks) {
+		auto object = get<sol::object>(to_string(pair.first));
+		if (object.get_type() == sol::type::function) {
+			pair.second = object.as<sol::function>();
+		} else {
+			pair.second = sol::function{};
+		}
+	}
+}
+
+bool AiScript::has(AiCallback callback) const {
+	return callbacks[callback].valid();
+}
 
 // ---------------------------------------------------------------------------
 
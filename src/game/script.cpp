@@ -1,3 +1,5 @@
+#include <SFML/System/Clock.hpp>
+#include <game/resources.hpp>
 #include <game/script.hpp>
 
 namespace game {
@@ -5,11 +7,17 @@ namespace game {
 namespace script_impl {
 
 unsigned int const UPDATE_DELAY = 200; // ms
+std::size_t const NUM_BUCKETS = 12u;
+unsigned int const UPDATE_BUDGET = 2; // ms
+float const FAR_DISTANCE = 16.f;
+unsigned int const FAR_TICK_FACTOR = 4u;
 
 Context::Context(core::LogContext& log, ScriptManager& script_manager)
 	: log{log}
 	, script_manager{script_manager}
-	, update_delay{sf::Time::Zero} {
+	, time{sf::Time::Zero}
+	, budget{sf::milliseconds(UPDATE_BUDGET)}
+	, cursor{0u} {
 }
 
 // ---------------------------------------------------------------------------
@@ -30,10 +38,10 @@ void onCollision(Context& context, core::CollisionEvent const& event) {
 	auto& script = *actor.script;
 
 	if (event.collider > 0u) {
-		script("onObjectCollision", actor.api.get(), event.collider, event.pos);
+		script(AiCallback::onObjectCollision, actor.api.get(), event.collider, event.pos);
 
 	} else {
-		script("onTileCollision", actor.api.get(), event.pos);
+		script(AiCallback::onTileCollision, actor.api.get(), event.pos);
 	}
 
 	// notify tracer
@@ -55,7 +63,7 @@ void onTeleport(Context& context, core::TeleportEvent const& event) {
 	ASSERT(actor.script != nullptr);
 	auto& script = *actor.script;
 	
-	script("onTeleport", actor.api.get(), event.src_scene, event.src_pos,
+	script(AiCallback::onTeleport, actor.api.get(), event.src_scene, event.src_pos,
 		event.dst_scene, event.dst_pos);
 }
 
@@ -68,7 +76,7 @@ void onIdle(Context& context, ScriptData& actor) {
 	ASSERT(actor.script != nullptr);
 	auto& script = *actor.script;
 
-	script("onIdle", actor.api.get());
+	script(AiCallback::onIdle, actor.api.get());
 }
 
 void onMove(Context& context, core::MoveEvent const& event) {
@@ -88,11 +96,11 @@ void onMove(Context& context, core::MoveEvent const& event) {
 
 	switch (event.type) {
 		case core::MoveEvent::Left:
-			script("onTileLeft", actor.api.get(), event.source);
+			script(AiCallback::onTileLeft, actor.api.get(), event.source);
 			break;
 
 		case core::MoveEvent::Reached:
-			script("onTileReached", actor.api.get(), event.target);
+			script(AiCallback::onTileReached, actor.api.get(), event.target);
 			break;
 	}
 
@@ -113,11 +121,11 @@ void onFocus(Context& context, core::FocusEvent const& event) {
 
 		switch (event.type) {
 			case core::FocusEvent::Gained:
-				script("onGotFocus", actor.api.get(), event.observed);
+				script(AiCallback::onGotFocus, actor.api.get(), event.observed);
 				break;
 
 			case core::FocusEvent::Lost:
-				script("onLostFocus", actor.api.get(), event.observed);
+				script(AiCallback::onLostFocus, actor.api.get(), event.observed);
 				break;
 		}
 	}
@@ -134,11 +142,11 @@ void onFocus(Context& context, core::FocusEvent const& event) {
 
 		switch (event.type) {
 			case core::FocusEvent::Gained:
-				script("onWasFocused", actor.api.get(), event.observer);
+				script(AiCallback::onWasFocused, actor.api.get(), event.observer);
 				break;
 
 			case core::FocusEvent::Lost:
-				script("onWasUnfocused", actor.api.get(), event.observer);
+				script(AiCallback::onWasUnfocused, actor.api.get(), event.observer);
 				break;
 		}
 	}
@@ -156,12 +164,12 @@ void onEffect(Context& context, rpg::EffectEvent const& event) {
 
 		switch (event.type) {
 			case rpg::EffectEvent::Add:
-				script("onEffectReceived", actor.api.get(), event.effect,
+				script(AiCallback::onEffectReceived, actor.api.get(), event.effect,
 					event.causer);
 				break;
 
 			case rpg::EffectEvent::Remove:
-				script("onEffectFaded", actor.api.get(), event.effect);
+				script(AiCallback::onEffectFaded, actor.api.get(), event.effect);
 				break;
 		}
 	}
@@ -178,7 +186,7 @@ void onEffect(Context& context, rpg::EffectEvent const& event) {
 
 		switch (event.type) {
 			case rpg::EffectEvent::Add:
-				script("onEffectInflicted", actor.api.get(), event.effect,
+				script(AiCallback::onEffectInflicted, actor.api.get(), event.effect,
 					event.actor);
 				break;
 
@@ -200,7 +208,7 @@ void onStats(Context& context, rpg::StatsEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onStatsReceived", actor.api.get(), event.delta[rpg::Stat::Life],
+		script(AiCallback::onStatsReceived, actor.api.get(), event.delta[rpg::Stat::Life],
 			event.delta[rpg::Stat::Mana], event.delta[rpg::Stat::Stamina],
 			event.causer);
 	}
@@ -215,7 +223,7 @@ void onStats(Context& context, rpg::StatsEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onStatsInflicted", actor.api.get(),
+		script(AiCallback::onStatsInflicted, actor.api.get(),
 			event.delta[rpg::Stat::Life], event.delta[rpg::Stat::Mana],
 			event.delta[rpg::Stat::Stamina], event.actor);
 	}
@@ -232,7 +240,7 @@ void onDeath(Context& context, rpg::DeathEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onDeath", actor.api.get(), event.causer);
+		script(AiCallback::onDeath, actor.api.get(), event.causer);
 	}
 
 	if (event.causer > 0u && context.script_manager.has(event.causer)) {
@@ -245,7 +253,7 @@ void onDeath(Context& context, rpg::DeathEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onEnemyKilled", actor.api.get(), event.actor);
+		script(AiCallback::onEnemyKilled, actor.api.get(), event.actor);
 	}
 }
 
@@ -260,7 +268,7 @@ void onSpawn(Context& context, rpg::SpawnEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onSpawned", actor.api.get(), event.causer);
+		script(AiCallback::onSpawned, actor.api.get(), event.causer);
 	}
 
 	if (event.causer > 0u && context.script_manager.has(event.causer)) {
@@ -273,7 +281,7 @@ void onSpawn(Context& context, rpg::SpawnEvent const& event) {
 		ASSERT(actor.script != nullptr);
 		auto& script = *actor.script;
 
-		script("onCausedSpawn", actor.api.get(), event.actor);
+		script(AiCallback::onCausedSpawn, actor.api.get(), event.actor);
 	}
 }
 
@@ -292,7 +300,7 @@ void onFeedback(Context& context, rpg::FeedbackEvent const& event) {
 	ASSERT(actor.script != nullptr);
 	auto& script = *actor.script;
 	
-	script("onFeedback", actor.api.get(), event.type);
+	script(AiCallback::onFeedback, actor.api.get(), event.type);
 }
 
 void onPathFailed(Context& context, PathFailedEvent const& event) {
@@ -310,7 +318,7 @@ void onPathFailed(Context& context, PathFailedEvent const& event) {
 	ASSERT(actor.script != nullptr);
 	auto& script = *actor.script;
 
-	script("onPathFailed", actor.api.get(), event.pos);
+	script(AiCallback::onPathFailed, actor.api.get(), event.pos);
 }
 
 void onUpdate(Context& context, ScriptData& actor) {
@@ -322,20 +330,85 @@ void onUpdate(Context& context, ScriptData& actor) {
 	ASSERT(actor.script != nullptr);
 	auto& script = *actor.script;
 
-	script("onUpdate", actor.api.get());
+	script(AiCallback::onUpdate, actor.api.get());
 }
 
 // ---------------------------------------------------------------------------
 
-void update(Context& context, sf::Time const& elapsed) {
-	auto max = sf::milliseconds(script_impl::UPDATE_DELAY);
-	context.update_delay += elapsed;
-	if (context.update_delay >= max) {
-		context.update_delay -= max;
-		for (auto& data : context.script_manager) {
-			onUpdate(context, data);
+sf::Time getPhase(core::ObjectID id) {
+	auto bucket = static_cast<sf::Int64>(id % NUM_BUCKETS + 1u);
+	return sf::milliseconds(UPDATE_DELAY) * bucket
+		/ static_cast<sf::Int64>(NUM_BUCKETS);
+}
+
+bool isFar(ScriptData const& data) {
+	ASSERT(data.api != nullptr);
+	auto const& session = data.api->session;
+	if (session.player.size() == 0u || !session.movement.has(data.id)) {
+		return false;
+	}
+	auto const& actor = session.movement.query(data.id);
+	for (auto const& player : session.player) {
+		if (!session.movement.has(player.id)) {
+			continue;
+		}
+		auto const& other = session.movement.query(player.id);
+		if (other.scene != actor.scene) {
+			continue;
+		}
+		auto delta = other.pos - actor.pos;
+		if (delta.x * delta.x + delta.y * delta.y
+			<= FAR_DISTANCE * FAR_DISTANCE) {
+			return false;
+		}
+	}
+	return true;
+}
+
+sf::Time getTickRate(ScriptData const& data) {
+	ASSERT(data.api != nullptr);
+	auto rate = data.api->tick_rate;
+	if (rate <= sf::Time::Zero) {
+		rate = sf::milliseconds(UPDATE_DELAY);
+	}
+	if (isFar(data)) {
+		rate *= static_cast<sf::Int64>(FAR_TICK_FACTOR);
+	}
+	return rate;
+}
+
+std::size_t update(Context& context, sf::Time const& elapsed) {
+	sf::Clock clock;
+	context.time += elapsed;
+
+	auto begin = context.script_manager.begin();
+	auto n = context.script_manager.size();
+	std::size_t num_updates{0u};
+	for (auto k = 0u; k < n; ++k) {
+		auto& data = *(begin + (context.cursor + k) % n);
+		if (data.next_update == sf::Time::Zero) {
+			// spread first updates across the buckets
+			data.next_update = context.time + getPhase(data.id);
+			continue;
+		}
+		if (!data.is_active || data.next_update > context.time) {
+			continue;
+		}
+		if (num_updates > 0u && clock.getElapsedTime() >= context.budget) {
+			// continue here next frame
+			context.cursor = (context.cursor + k) % n;
+			return num_updates;
+		}
+		auto rate = getTickRate(data);
+		data.next_update += rate;
+		if (data.next_update <= context.time) {
+			// do not catch up missed updates
+			data.next_update = context.time + rate;
 		}
+		onUpdate(context, data);
+		++num_updates;
 	}
+	return num_updates;
 }
 
 }  // ::script_impl
@@ -16,6 +16,7 @@ PathTracer::PathTracer(core::LogContext& log, PathSystem& pathfinder,
 	, actor{actor}
 	, request{}
 	, path{}
+	, field{nullptr}
 	, current{}
 	, target{} {}
 
@@ -24,10 +25,19 @@ bool PathTracer::requestIsReady() const {
 	return status == std::future_status::ready;
 }
 
+void PathTracer::step(sf::Vector2i const& dir) {
+	core::InputEvent event;
+	event.actor = actor;
+	event.move = dir;
+	event.look = dir;
+	input_sender.send(event);
+}
+
 void PathTracer::reset() {
 	state = PathTracer::Idle;
 	request = std::future<Path>{};
 	path.clear();
+	field = nullptr;
 	current = sf::Vector2u{};
 	// target = sf::Vector2u{};
 	(void)log;
@@ -40,9 +50,25 @@ void PathTracer::pathfind(sf::Vector2u const& target) {
 	current = data.target;
 	request = std::future<Path>{};
 	path.clear();
+	field = nullptr;
 	state = PathTracer::Trigger;
 }
 
+void PathTracer::follow(std::shared_ptr<FlowField const> field) {
+	ASSERT(field != nullptr);
+	request = std::future<Path>{};
+	path.clear();
+	this->field = std::move(field);
+	state = PathTracer::Follow;
+	// start at the current position
+	auto const& data = movement_manager.query(actor);
+	core::MoveEvent event;
+	event.source = sf::Vector2u{data.pos};
+	event.target = event.source;
+	event.type = core::MoveEvent::Reached;
+	handle(event);
+}
+
 void PathTracer::handle(core::MoveEvent const& event) {
 	switch (event.type) {
 		case core::MoveEvent::Left: {
@@ -55,6 +81,18 @@ void PathTracer::handle(core::MoveEvent const& event) {
 
 		case core::MoveEvent::Reached:
 			current = event.target;
+			if (state == PathTracer::Follow) {
+				auto dir = field->getDirection(current);
+				if (dir == sf::Vector2i{}) {
+					// target reached or field left
+					step(dir);
+					field = nullptr;
+					state = PathTracer::Idle;
+				} else {
+					step(dir);
+				}
+				return;
+			}
 			if (state != PathTracer::Trace) {
 				return;
 			}
@@ -70,11 +108,7 @@ void PathTracer::handle(core::MoveEvent const& event) {
 				auto next = path.back();
 				auto v = sf::Vector2i{next} - sf::Vector2i{current};
 				core::fixDirection(v);
-				core::InputEvent event;
-				event.actor = actor;
-				event.move = v;
-				event.look = v;
-				input_sender.send(event);
+				step(v);
 			} else {
 				state = PathTracer::Idle;
 			}
@@ -86,6 +120,7 @@ void PathTracer::handle(core::CollisionEvent const& event) {
 	// force abort
 	request = std::future<Path>{};
 	path.clear();
+	field = nullptr;
 	state = PathTracer::Idle;
 }
 
@@ -130,6 +165,7 @@ boost::optional<PathFailedEvent> PathTracer::update() {
 			break;
 
 		case PathTracer::Trace:
+		case PathTracer::Follow:
 			// tracing is done on entering a tile
 			break;
 	}
@@ -139,6 +175,11 @@ boost::optional<PathFailedEvent> PathTracer::update() {
 
 bool PathTracer::isRunning() const { return state != PathTracer::Idle; }
 
+bool PathTracer::isFollowing(FlowField const* field) const {
+	return state == PathTracer::Follow
+		&& (field == nullptr || this->field.get() == field);
+}
+
 std::vector<sf::Vector2u> const& PathTracer::getPath() const { return path; }
 
 }  // ::rage
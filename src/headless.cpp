@@ -0,0 +1,241 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <utils/assert.hpp>
+#include <utils/filesystem.hpp>
+#include <utils/fixed_timestep.hpp>
+#include <utils/random.hpp>
+#include <engine/engine.hpp>
+#include <state/game.hpp>
+#include <state/resources.hpp>
+
+// Runs the full engine without a window and reports per-system timings
+//
+// usage: racod_headless [num_dungeons] [num_bots] [num_ticks] [seed] [tick_rate]
+//
+// the seed defaults to the one of the global config (or 1 if that is zero),
+// so repeated runs simulate the same dungeons and bots. The tick rate (in
+// ticks per second) defaults to the one of the global config as well.
+//
+// note: textures and the lightmap still need an OpenGL context, so run
+// this via xvfb-run on machines without a display.
+
+namespace {
+
+void printUsage() {
+	std::cerr << "usage: racod_headless [num_dungeons] [num_bots] "
+		<< "[num_ticks] [seed] [tick_rate]\n";
+}
+
+// keeps the value if the argument is missing, prints usage if it is invalid
+bool parseArg(int argc, char** argv, int i, std::size_t& value,
+	std::size_t max=std::numeric_limits<std::size_t>::max()) {
+	if (argc <= i) {
+		return true;
+	}
+	std::string const arg{argv[i]};
+	try {
+		std::size_t pos{0u};
+		// note: stoul accepts negative numbers by wrapping them around
+		if (arg.find('-') == std::string::npos) {
+			auto parsed = std::stoul(arg, &pos);
+			if (pos == arg.size() && parsed <= max) {
+				value = parsed;
+				return true;
+			}
+		}
+	} catch (std::invalid_argument const&) {
+		// reported below
+	} catch (std::out_of_range const&) {
+		// reported below
+	}
+	std::cerr << "Invalid argument #" << i << ": '" << arg << "'\n";
+	printUsage();
+	return false;
+}
+
+void printTimings(utils::FixedTimestep const& sim, sf::Time const& total) {
+	// same categories as the ingame time monitor
+	std::vector<std::string> const systems{"behavior", "physics", "avatar",
+		"ui", "combat", "ai", "path", "cleanup"};
+	auto const& hists = sim.getHistograms();
+
+	std::cout << std::left << std::setw(10) << "system" << std::right
+		<< std::setw(12) << "total (ms)" << std::setw(12) << "mean (us)"
+		<< std::setw(12) << "p50 (us)" << std::setw(12) << "p95 (us)"
+		<< std::setw(12) << "max (us)" << "\n";
+	for (auto const& name : systems) {
+		auto i = hists.find(name);
+		if (i == hists.end()) {
+			continue;
+		}
+		auto const& hist = i->second;
+		std::cout << std::left << std::setw(10) << name << std::right
+			<< std::setw(12) << hist.getTotal().asMilliseconds()
+			<< std::setw(12) << hist.getMean().asMicroseconds()
+			<< std::setw(12) << hist.getPercentile(0.5f).asMicroseconds()
+			<< std::setw(12) << hist.getPercentile(0.95f).asMicroseconds()
+			<< std::setw(12) << hist.getMax().asMicroseconds() << "\n";
+	}
+	auto secs = total.asSeconds();
+	std::cout << "\n" << sim.getNumTicks() << " ticks of "
+		<< sim.getStep().asMilliseconds() << "ms in " << secs << "s";
+	if (secs > 0.f) {
+		std::cout << " (" << sim.getNumTicks() / secs << " ticks/s, "
+			<< sim.getNumTicks() * sim.getStep().asSeconds() / secs
+			<< "x realtime)";
+	}
+	std::cout << "\n";
+}
+
+}  // ::anon
+
+int main(int argc, char** argv) {
+	std::size_t num_dungeons{1u}, num_bots{50u}, num_ticks{1000u};
+	if (!parseArg(argc, argv, 1, num_dungeons) ||
+		!parseArg(argc, argv, 2, num_bots) ||
+		!parseArg(argc, argv, 3, num_ticks)) {
+		return EXIT_FAILURE;
+	}
+	if (num_dungeons == 0u) {
+		std::cerr << "At least one dungeon is required\n";
+		return EXIT_FAILURE;
+	}
+
+	assert_impl::fname = engine::get_preference_dir() + "crash.log";
+
+	core::LogContext log;
+	log.warning.add(std::cerr);
+	log.error.add(std::cerr);
+
+	// prepare filesystem (the lightmap is cached there)
+	auto path = engine::get_preference_dir();
+	if (!utils::file_exists(path)) {
+		utils::create_dir(path);
+	}
+	if (!utils::file_exists(path + "cache/")) {
+		utils::create_dir(path + "cache/");
+	}
+
+	game::ResourceCache cache;
+	game::Mod mod{log, cache, "data"};
+	game::Localization locale;
+	state::GlobalSettings globals;
+	if (!globals.loadFromFile(mod.name + "/xml/" + globals.getFilename())) {
+		std::cerr << "Cannot load global config: " << globals.last_error << "\n";
+		return EXIT_FAILURE;
+	}
+	if (!locale.loadFromFile(mod.name + "/xml/" + locale.getFilename())) {
+		log.warning << "[Headless] No localization found\n";
+	}
+
+	std::size_t seed_arg{globals.dungeon_gen.seed};
+	if (!parseArg(argc, argv, 4, seed_arg,
+		std::numeric_limits<std::uint32_t>::max())) {
+		return EXIT_FAILURE;
+	}
+	auto seed = static_cast<std::uint32_t>(seed_arg);
+	if (seed == 0u) {
+		seed = 1u;
+	}
+	std::cout << "seed " << seed << "\n";
+	std::size_t tick_rate_arg{globals.tick_rate};
+	if (!parseArg(argc, argv, 5, tick_rate_arg,
+		std::numeric_limits<unsigned int>::max())) {
+		return EXIT_FAILURE;
+	}
+	auto tick_rate = static_cast<unsigned int>(tick_rate_arg);
+	if (tick_rate < state::getMinTickRate()) {
+		std::cerr << "Tick rate needs to be at least "
+			<< state::getMinTickRate() << "\n";
+		return EXIT_FAILURE;
+	}
+
+	// the screen size only affects the cameras, nothing is drawn
+	sf::Vector2u const screen_size{
+		state::MIN_SCREEN_WIDTH, state::MIN_SCREEN_HEIGHT};
+	engine::Engine engine{log, globals.max_num_objects, screen_size,
+		globals.zoom, globals.audio_poolsize, globals.path_workers, mod, cache,
+		locale};
+	engine.setSeed(seed);
+	engine.physics.collision.setCheckInterval(state::getCollisionInterval(
+		globals.collision_rate, tick_rate));
+	utils::RandomStream rng{
+		engine::deriveSeed(seed, engine::SeedStream::Placement)};
+
+	std::vector<std::string> tilesets, bots, scripts;
+	mod.getAllFiles<rpg::TilesetTemplate>(tilesets);
+	mod.getAllFiles<game::BotTemplate>(bots);
+	mod.getAllFiles<game::AiScript>(scripts);
+	if (tilesets.empty() || bots.empty() || scripts.empty()) {
+		std::cerr << "Mod provides no tilesets, bots or ai scripts\n";
+		return EXIT_FAILURE;
+	}
+
+	// create dungeons
+	game::BuildSettings build_settings;
+	build_settings.cell_size = globals.dungeon_gen.cell_size;
+	build_settings.path_width = 3u;
+	std::vector<game::DungeonRequest> requests(num_dungeons);
+	for (auto i = 0u; i < num_dungeons; ++i) {
+		auto& request = requests[i];
+		request.tileset =
+			&mod.get<rpg::TilesetTemplate>(tilesets[i % tilesets.size()]);
+		request.grid_size = globals.dungeon_size;
+		request.settings = build_settings;
+	}
+	sf::Clock clock;
+	auto scenes = engine.factory.createDungeons(requests);
+	std::cout << num_dungeons << " dungeons of " << globals.dungeon_size.x
+		<< "x" << globals.dungeon_size.y << " created in "
+		<< clock.restart().asMilliseconds() << "ms\n";
+
+	// spawn bots: two hostile parties per dungeon, so they fight each other
+	std::vector<game::AiScript const*> parties;
+	for (auto i = 0u; i < 2u * scenes.size(); ++i) {
+		parties.push_back(&mod.createScript(scripts[i % scripts.size()]));
+	}
+	for (auto i = 0u; i < num_bots; ++i) {
+		auto k = i % scenes.size();
+		auto hostile = (i / scenes.size()) % 2u == 0u;
+		auto const& dungeon = engine.dungeon[scenes[k]];
+		auto const& rooms = engine.generator[scenes[k]].builder.info.rooms;
+		ASSERT(!rooms.empty());
+		rpg::SpawnMetaData spawn;
+		spawn.scene = scenes[k];
+		spawn.direction = {0, -1};
+		state::searchPosition(rooms[i % rooms.size()], spawn.pos, dungeon, rng);
+		auto const& bot = mod.get<game::BotTemplate>(bots[i % bots.size()]);
+		auto const& script = *parties[2u * k + (hostile ? 0u : 1u)];
+		engine.factory.createBot(bot, spawn, 1u, script, hostile);
+	}
+	std::cout << num_bots << " bots spawned in "
+		<< clock.restart().asMilliseconds() << "ms\n\n";
+
+	// run simulation as fast as possible
+	utils::FixedTimestep sim{
+		sf::milliseconds(static_cast<sf::Int32>(core::MAX_FRAMETIME_MS)), 1u};
+	sim.setTickRate(tick_rate);
+	auto record = [&](std::string const& name, sf::Time const& t) {
+		sim.record(name, t);
+	};
+	sf::Clock total, local;
+	for (auto i = 0u; i < num_ticks; ++i) {
+		local.restart();
+		engine.cleanup();
+		sim.record("cleanup", local.restart());
+		sim.update(sim.getStep(), [&](sf::Time const& t) {
+			engine.update(t, false, record);
+		});
+		// grant the minimum budget the game grants per frame
+		local.restart();
+		engine.ai.path.calculate(sf::milliseconds(5));
+		sim.record("path", local.restart());
+	}
+	printTimings(sim, total.getElapsedTime());
+}
@@ -1,5 +1,3 @@
-#include <Thor/Math.hpp>
-
 #include <rpg/algorithm.hpp>
 #include <rpg/balance.hpp>
 #include <rpg/combat.hpp>
@@ -29,7 +27,8 @@ Context::Context(core::LogContext& log, StatsSender& stats_sender,
 	, stats{stats}
 	, interact{interact}
 	, variance{variance}
-	, projectiles{} {}
+	, projectiles{}
+	, rng{} {}
 
 // ---------------------------------------------------------------------------
 
@@ -230,7 +229,7 @@ std::vector<EffectEmitter> getEffectEmitters(CombatMetaData const& data) {
 	return emitters;
 }
 
-void randomize(Context const& context, int& value) {
+void randomize(Context& context, int& value) {
 	// save sign
 	bool negative = value < 0;
 	value = std::abs(value);
@@ -245,7 +244,7 @@ void randomize(Context const& context, int& value) {
 	}
 	// pick random value
 	ASSERT(min <= max);
-	value = thor::random(min, max);
+	value = context.rng(min, max);
 }
 
 void onCombat(Context& context, CombatEvent const& event) {
@@ -371,7 +370,7 @@ void onCombat(Context& context, CombatEvent const& event) {
 		if (emitter.effect == nullptr) {
 			continue;
 		}
-		if (thor::random(0.f, 1.f) <= emitter.ratio) {
+		if (context.rng(0.f, 1.f) <= emitter.ratio) {
 			// inflcit effect
 			effect.effect = emitter.effect;
 			context.effect_sender.send(effect);
@@ -438,4 +437,8 @@ void CombatSystem::update(sf::Time const& elapsed) {
 void CombatSystem::clear() {
 }
 
+void CombatSystem::setSeed(std::uint32_t seed) {
+	context.rng.seed(seed);
+}
+
 }  // ::game
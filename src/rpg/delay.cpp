@@ -40,13 +40,16 @@ core::ObjectID queryInteractable(Context& context, core::ObjectID actor) {
 	auto const& dungeon = context.dungeon[actor_move.scene];
 	auto const& actor_focus = context.focus.query(actor);
 	auto pos = sf::Vector2u{sf::Vector2i{actor_move.pos} + actor_focus.look};
-	ASSERT(dungeon.has(pos));
-	auto const& cell = dungeon.getCell(pos);
+	auto cell = dungeon.tryGetCell(pos);
+	if (cell == nullptr) {
+		// looking out of the dungeon
+		return 0u;
+	}
 
 	// seek interactables
 	std::vector<InteractData const*> objects;
 	bool found_barrier{false};
-	for (auto id : cell.entities) {
+	for (auto id : cell->entities) {
 		if (!context.interact.has(id)) {
 			continue;
 		}
@@ -17,7 +17,8 @@ Context::Context(core::LogContext& log, core::InputSender& input_sender,
 	, action_sender{action_sender}
 	, dungeon{dungeon}
 	, movement{movement}
-	, focus{focus} {
+	, focus{focus}
+	, rng{} {
 	// register player actions as gameplay actions in priority order
 	gameplay_actions = {PlayerAction::Pause, PlayerAction::Attack,
 		PlayerAction::Interact, PlayerAction::UseSlot, PlayerAction::PrevSlot,
@@ -111,7 +112,7 @@ void updateInput(Context& context, InputData& data, sf::Time const& elapsed) {
 }
 
 void adjustMovement(
-	Context const& context, InputData const& data, sf::Vector2i& vector) {
+	Context& context, InputData const& data, sf::Vector2i& vector) {
 	if (vector == sf::Vector2i{}) {
 		return;
 	}
@@ -125,8 +126,7 @@ void adjustMovement(
 		if (!dungeon.has(target)) {
 			return false;
 		}
-		auto const& cell = dungeon.getCell(target);
-		return !core::checkTileCollision(cell);
+		return !core::checkTileCollision(dungeon.getTerrain(target));
 	};
 	// check given movement
 	if (canAccess(vector)) {
@@ -137,7 +137,7 @@ void adjustMovement(
 	auto right = core::rotate(vector, true);
 	auto left = core::rotate(vector, false);
 	sf::Vector2i decision, other;
-	if (thor::random(0u, 1u) == 0u) {
+	if (context.rng(0u, 1u) == 0u) {
 		decision = right;
 		other = left;
 	} else {
@@ -174,6 +174,8 @@ InputSystem::InputSystem(core::LogContext& log, std::size_t max_objects,
 
 void InputSystem::reset() { context.mapper = utils::InputMapper{}; }
 
+void InputSystem::setSeed(std::uint32_t seed) { context.rng.seed(seed); }
+
 void InputSystem::handle(DeathEvent const& event) {
 	if (!has(event.actor)) {
 		return;
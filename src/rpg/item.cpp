@@ -431,7 +431,7 @@ bool hasItem(ItemData const& actor, ItemTemplate const& data, std::size_t quanti
 }
 
 void dropItems(ItemData& actor, InteractData& corpse, std::size_t num_players,
-	float loot_ratio, drop::Predicate pred) {
+	float loot_ratio, drop::Predicate pred, utils::RandomStream& rng) {
 	ASSERT(loot_ratio >= 0.f);
 	ASSERT(loot_ratio <= 1.f);
 	// collect, count and shuffle all items
@@ -444,7 +444,7 @@ void dropItems(ItemData& actor, InteractData& corpse, std::size_t num_players,
 		}
 		pair.second.clear();
 	}
-	utils::shuffle(items);
+	utils::shuffle(items, rng);
 
 	// prepare dropping
 	decltype(corpse.loot) loot;
@@ -516,7 +516,7 @@ void dropItems(ItemData& actor, InteractData& corpse, std::size_t num_players,
 	}
 
 	// finally shuffle loot and merge it with previous loot
-	utils::shuffle(loot);
+	utils::shuffle(loot, rng);
 	for (auto player = 0u; player < num_players; ++player) {
 		utils::append(corpse.loot[player], loot[player]);
 	}
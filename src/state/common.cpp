@@ -5,6 +5,7 @@ namespace state {
 
 unsigned int const MIN_SCREEN_WIDTH = 800u;
 unsigned int const MIN_SCREEN_HEIGHT = 600u;
+std::size_t const MAX_TICKS_PER_FRAME = 5u;
 
 void apply(core::LogContext& log, sf::Window& window,
 	state::Settings const & settings, unsigned int framelimit) {
@@ -252,7 +253,8 @@ GameContext::GameContext(App& app, LobbyContext lobby)
 	, parent{app.getContext()}
 	, lobby{lobby}
 	, engine{parent.log, parent.globals.max_num_objects, app.getWindow().getSize(), parent.globals.zoom,
-		parent.globals.audio_poolsize, parent.mod, parent.cache,
+		parent.globals.audio_poolsize, parent.globals.path_workers,
+		parent.mod, parent.cache,
 		parent.locale}
 	, mutex{}
 	, saver{parent.log, engine.session, mutex} {
@@ -8,14 +8,13 @@
 
 namespace state {
 
-void searchPosition(std::vector<sf::Vector2u> const & tiles, sf::Vector2u& pos, core::Dungeon const & dungeon, unsigned int max_step) {
+void searchPosition(std::vector<sf::Vector2u> const & tiles, sf::Vector2u& pos, core::Dungeon const & dungeon, utils::RandomStream& rng, unsigned int max_step) {
 	do {
-		pos = utils::randomAt(tiles);
+		pos = utils::randomAt(tiles, rng);
 	} while (!core::getFreePosition([&](sf::Vector2u const & p) {
 		if (dungeon.has(p)) {
-			auto const & cell = dungeon.getCell(p);
-			return cell.terrain == core::Terrain::Floor
-				&& cell.entities.empty();
+			return dungeon.getTerrain(p) == core::Terrain::Floor
+				&& dungeon.getCell(p).entities.empty();
 		}
 		return false;
 	}, pos, max_step));
@@ -30,10 +29,15 @@ GameState::GameState(App& app)
 	, freezed{false}
 	, difficulty{}
 	, fps{}
-	, time_monitor{} {
+	, time_monitor{}
+	, simulation{sf::milliseconds(static_cast<sf::Int32>(core::MAX_FRAMETIME_MS)),
+		MAX_TICKS_PER_FRAME} {
 	auto& context = app.getContext();
 	ASSERT(context.game != nullptr);
 	auto& game = *context.game;
+	simulation.setTickRate(context.globals.tick_rate);
+	game.engine.physics.collision.setCheckInterval(getCollisionInterval(
+		context.globals.collision_rate, context.globals.tick_rate));
 	
 	auto const & hud_font = game.engine.mod.get<sf::Font>(context.globals.widget.font);
 	auto const & combat_font = game.engine.mod.get<sf::Font>(context.globals.combat.font);
@@ -81,6 +85,16 @@ GameState::GameState(App& app)
 	bot_level /= game.lobby.players.size();
 	context.log.debug << "[State/Game] Average bot level is " << bot_level << "\n";
 	
+	// seed all random streams (a fixed seed reproduces the dungeons)
+	auto seed = context.globals.dungeon_gen.seed;
+	if (seed == 0u) {
+		seed = std::random_device{}();
+	}
+	context.log.debug << "[State/Game] Seed is " << seed << "\n";
+	game.engine.setSeed(seed);
+	utils::RandomStream rng{
+		engine::deriveSeed(seed, engine::SeedStream::Placement)};
+	
 	auto num_bots = 3u + game.lobby.players.size() / 2;
 	auto min_num_bots = static_cast<std::uint32_t>(std::ceil(num_bots * 0.5f));
 	auto max_num_bots = num_bots * 2u;
@@ -119,15 +133,29 @@ GameState::GameState(App& app)
 	build_settings.cell_size = settings.cell_size;
 	build_settings.path_width = 3u;
 	
-	std::vector<utils::SceneID> scenes;
+	// build all dungeons in parallel
+	std::vector<game::DungeonRequest> requests(game.lobby.num_dungeons);
+	for (auto& request: requests) {
+		request.tileset = &game.engine.mod.get<rpg::TilesetTemplate>(utils::randomAt(tilesets, rng));
+		request.grid_size = game.lobby.dungeon_size;
+		request.settings = build_settings;
+	}
+	sf::Clock clock;
+	auto scenes = game.engine.factory.createDungeons(requests);
+	context.log.debug << "[State/Game] " << scenes.size() << " dungeons created in "
+		<< clock.getElapsedTime().asMilliseconds() << "ms\n";
+	
 	game::BuildInformation::Floors const * player_start{nullptr};
 	for (auto i = 0u; i < game.lobby.num_dungeons; ++i) {
-		auto const & tileset = game.engine.mod.get<rpg::TilesetTemplate>(utils::randomAt(tilesets));
-		
-		auto scene = game.engine.factory.createDungeon(tileset, game.lobby.dungeon_size, build_settings);
+		auto scene = scenes[i];
 		auto& dungeon = game.engine.dungeon[scene];
 		auto& builder = game.engine.generator[scene].builder;
 		context.log.debug << "[State/Game] " << builder.rooms.size() << " rooms created\n";
+		auto memory = dungeon.getMemoryUsage();
+		context.log.debug << "[State/Game] Dungeon #" << (int)scene << " uses "
+			<< memory.terrain_bytes / 1024u << " KiB of terrain, "
+			<< memory.hot_bytes / 1024u << " KiB of simulation cells and "
+			<< memory.cold_bytes / 1024u << " KiB of render cells\n";
 		
 		rpg::SpawnMetaData spawn;
 		spawn.scene = scene;
@@ -135,9 +163,9 @@ GameState::GameState(App& app)
 		auto dist = [&](game::BuildInformation::Floors const & v) {
 			for (auto const & pos: v) {
 				// generator setting!!
-				if (thor::random(0.f, 1.f) < settings.ambience_density) {
+				if (rng(0.f, 1.f) < settings.ambience_density) {
 					spawn.pos = pos;
-					auto const & tex = *all_ambiences[thor::random(0u, all_ambiences.size()-1u)];
+					auto const & tex = *utils::randomAt(all_ambiences, rng);
 					game.engine.factory.createAmbience(tex, spawn);
 				}
 			}
@@ -151,14 +179,14 @@ GameState::GameState(App& app)
 		
 		if (player_start == nullptr) {
 			// add player(s)
-			player_start = &utils::randomAt(builder.info.rooms);
+			player_start = &utils::randomAt(builder.info.rooms, rng);
 			std::size_t i{0u};
 			for (auto& player: game.lobby.players) {
 				auto color = context.globals.player_colors[i];
 				if (game.lobby.num_players == 1u) {
 					color = sf::Color::Transparent;
 				}
-				searchPosition(*player_start, spawn.pos, dungeon);
+				searchPosition(*player_start, spawn.pos, dungeon, rng);
 				player.id = game.engine.factory.createPlayer(player.tpl, player.keys, spawn, color);
 				
 				// add regeneration effect (ALPHA ONLY!)
@@ -182,7 +210,7 @@ GameState::GameState(App& app)
 		}
 		
 		// add bots
-		auto const & encounter = *utils::randomAt(encounters);
+		auto const & encounter = *utils::randomAt(encounters, rng);
 		spawn.direction = {0, -1};
 		auto lvl = bot_level + scene - 1;
 		auto diff = diffic;
@@ -201,33 +229,30 @@ GameState::GameState(App& app)
 				continue;
 			}
 			// create new script instance
-			auto& script = game.engine.mod.createScript(utils::randomAt(scripts));
+			auto& script = game.engine.mod.createScript(utils::randomAt(scripts, rng));
 			
 			// test whether neither last dungeon nor last room
 			if (i < game.lobby.num_dungeons - 1u || n < builder.info.rooms.size() - 1u) {
-				searchPosition(room, spawn.pos, dungeon);
-				for (auto i = 0; i < thor::random(min_num_bots, max_num_bots); ++i) {
+				searchPosition(room, spawn.pos, dungeon, rng);
+				for (auto i = 0u; i < rng(min_num_bots, static_cast<std::uint32_t>(max_num_bots)); ++i) {
 					// spawn near position
 					core::getFreePosition([&](sf::Vector2u const & p) {
 						if (dungeon.has(p)) {
-							auto const & cell = dungeon.getCell(p);
-							return cell.terrain == core::Terrain::Floor
-								&& cell.entities.empty();
+							return dungeon.getTerrain(p) == core::Terrain::Floor
+								&& dungeon.getCell(p).entities.empty();
 						}
 						return false;
 					}, spawn.pos, 100u);
-					auto const & bot = encounter.pick(thor::random(0.f, 1.f));
+					auto const & bot = encounter.pick(rng(0.f, 1.f));
 					game.engine.factory.createBot(bot, spawn, lvl, script, true, diff);
 				}
 			} else {
 				// place racod in last dungeon's last room
-				searchPosition(room, spawn.pos, dungeon);
+				searchPosition(room, spawn.pos, dungeon, rng);
 				game.engine.factory.createBot(boss, spawn, lvl + lvl / 10, script, true, 3.f * diff * game.lobby.players.size());
 			}
 			++n;
 		}
-		
-		scenes.push_back(scene);
 	}
 	
 	// create stairs
@@ -246,12 +271,12 @@ GameState::GameState(App& app)
 		auto const & dst_builder = game.engine.generator[spawn2.scene].builder;
 		
 		// pick random room within dungeon
-		auto const & src_room = utils::randomAt(src_builder.info.rooms);
-		auto const & dst_room = utils::randomAt(dst_builder.info.rooms);
+		auto const & src_room = utils::randomAt(src_builder.info.rooms, rng);
+		auto const & dst_room = utils::randomAt(dst_builder.info.rooms, rng);
 		
 		// pick random position
-		searchPosition(src_room, spawn1.pos, src_dungeon);
-		searchPosition(dst_room, spawn2.pos, dst_dungeon);
+		searchPosition(src_room, spawn1.pos, src_dungeon, rng);
+		searchPosition(dst_room, spawn2.pos, dst_dungeon, rng);
 		
 		// place stairs and teleport triggers
 		game.engine.factory.createObject(downstairs, spawn1);
@@ -431,29 +456,23 @@ void GameState::update(sf::Time const& elapsed) {
 	}
 	
 	sf::Clock local, clock;
-	for (auto ptr : game.engine.session.systems) {
-		ptr->cleanup();
-	}
-	game.engine.session.id_manager.cleanup();
+	game.engine.cleanup();
+	game.engine.pageDungeons();
 	time_monitor["cleanup"] += clock.restart().asMilliseconds();
 	time_monitor.update(elapsed);
 
-	core::updateChunked([&](sf::Time const& t) {
-		time_monitor["behavior"] += game.engine.behavior.update(t).asMilliseconds();
-		time_monitor["physics"] += game.engine.physics.update(t).asMilliseconds();
-		time_monitor["avatar"] += game.engine.avatar.update(t).asMilliseconds();
-		time_monitor["ui"] += game.engine.ui.update(t, context.settings.autocam).asMilliseconds();
-		{
-			sf::Clock clock;
-			game.engine.combat.update(t);
-			time_monitor["combat"] += clock.restart().asMilliseconds();
-		}
-		game.engine.factory.update(t);
-	}, elapsed, sf::milliseconds(core::MAX_FRAMETIME_MS));
-
-	time_monitor["ai"] += game.engine.ai.update(elapsed).asMilliseconds();
+	auto measure = [&](std::string const& name, sf::Time const& t) {
+		time_monitor[name] += t.asMilliseconds();
+		simulation.record(name, t);
+	};
+	simulation.update(elapsed, [&](sf::Time const& t) {
+		game.engine.update(t, context.settings.autocam, measure);
+	});
+	// render between the last and the next tick
+	game.engine.ui.render.setLookahead(simulation.getRemainder());
 
-	auto remain = sf::milliseconds(1000 / 60) - local.getElapsedTime();
+	// spend the rest of a step on pathfinding
+	auto remain = simulation.getStep() - local.getElapsedTime();
 	if (remain <= sf::milliseconds(5u)) {
 		remain = sf::milliseconds(5u);
 	}
@@ -461,6 +480,7 @@ void GameState::update(sf::Time const& elapsed) {
 	game.engine.ai.path.calculate(remain);
 	auto delta = clock.restart();
 	time_monitor["ai"] += delta.asMilliseconds();
+	simulation.record("path", delta);
 	
 	time_monitor["save"] += game.saver.getElapsedTime().asMilliseconds();
 	
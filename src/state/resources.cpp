@@ -1,9 +1,27 @@
+#include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <core/common.hpp>
+#include <game/path.hpp>
 #include <state/resources.hpp>
 
 namespace state {
 
+unsigned int getMinTickRate() {
+	return static_cast<unsigned int>(std::ceil(1000.f / core::MAX_FRAMETIME_MS));
+}
+
+sf::Time getCollisionInterval(unsigned int collision_rate,
+	unsigned int tick_rate) {
+	ASSERT(tick_rate > 0u);
+	// note: bullets are checked at most once per tick
+	auto rate = std::max(1u, std::min(collision_rate, tick_rate));
+	return sf::microseconds(1000000 / rate);
+}
+
+// --------------------------------------------------------------------
+
 FontSettings::FontSettings()
 	: font{""}
 	, char_size{10u} {
@@ -46,6 +64,9 @@ GlobalSettings::GlobalSettings()
 	, player_colors{sf::Color::Blue, sf::Color::Red, sf::Color::Green,
 		sf::Color::Yellow, sf::Color::Cyan, sf::Color::Magenta}
 	, max_num_objects{30000u}
+	, path_workers{game::path_impl::getDefaultWorkers()}
+	, tick_rate{getMinTickRate()}
+	, collision_rate{getMinTickRate()}
 	, max_num_players{6u}
 	, framelimit{60u}
 	, audio_poolsize{16u}
@@ -78,6 +99,13 @@ void GlobalSettings::loadFromTree(utils::ptree_type const& ptree) {
 			elem.a = 255u;
 	});
 	max_num_objects = ptree.get<std::size_t>("engine.<xmlattr>.max_num_objects");
+	path_workers = ptree.get<std::size_t>("engine.<xmlattr>.path_workers",
+		game::path_impl::getDefaultWorkers());
+	// note: slower ticks would exceed the maximum movement step
+	tick_rate = std::max(getMinTickRate(), ptree.get<unsigned int>(
+		"engine.<xmlattr>.tick_rate", getMinTickRate()));
+	collision_rate = std::max(1u, ptree.get<unsigned int>(
+		"engine.<xmlattr>.collision_rate", getMinTickRate()));
 	max_num_players = player_colors.size();
 	widget.loadFromTree(ptree.get_child("ui.widget"));
 	title.loadFromTree(ptree.get_child("ui.title"));
@@ -140,6 +168,9 @@ void GlobalSettings::saveToTree(utils::ptree_type& ptree) const {
 			child.put("<xmlattr>.b", elem.b);
 	});
 	ptree.put("engine.<xmlattr>.max_num_objects", max_num_objects);
+	ptree.put("engine.<xmlattr>.path_workers", path_workers);
+	ptree.put("engine.<xmlattr>.tick_rate", tick_rate);
+	ptree.put("engine.<xmlattr>.collision_rate", collision_rate);
 	utils::ptree_type w, t, c, n;
 	widget.saveToTree(w);
 	ptree.add_child("ui.widget", w);
@@ -14,7 +14,8 @@ EngineState::EngineState(state::App& app, std::string const & mod_name)
 	, cache{}
 	, mod{app.getContext().log, cache, mod_name}
 	, engine{app.getContext().log, app.getContext().globals.max_num_objects,
-		app.getWindow().getSize(), 1.f, 16u, mod, cache,
+		app.getWindow().getSize(), 1.f, 16u,
+		app.getContext().globals.path_workers, mod, cache,
 		app.getContext().locale}
 	, current_room{}
 	, current_name{""}
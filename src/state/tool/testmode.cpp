@@ -16,6 +16,7 @@ Memory get(core::DungeonSystem const & system) {
 	for (auto const & uptr: system) {
 		auto size = uptr->getSize();
 		mem.alloc += sizeof(core::Dungeon);
+		mem.alloc += size.x * size.y * sizeof(core::Terrain);
 		mem.alloc += size.x * size.y * sizeof(core::BaseCell);
 	}
 	mem.used = mem.alloc;
@@ -248,6 +249,55 @@ void TestMode::updateMonitor() {
 	}
 	ImGui::Columns(1);
 	ImGui::Separator();
+
+	// show tick time distribution per system
+	auto const & sim = parent.simulation;
+	ImGui::Text("Tick time per system (%'lu ticks, %d ms dropped):",
+		static_cast<unsigned long>(sim.getNumTicks()),
+		sim.getDroppedTime().asMilliseconds());
+	ImGui::Columns(4, "tick-columns");
+	ImGui::Separator();
+	ImGui::Text("System"); ImGui::NextColumn();
+	ImGui::Text("p50 (us)"); ImGui::NextColumn();
+	ImGui::Text("p95 (us)"); ImGui::NextColumn();
+	ImGui::Text("Max (us)"); ImGui::NextColumn();
+	ImGui::Separator();
+	for (auto const & pair: sim.getHistograms()) {
+		ImGui::Text("%s", pair.first.c_str()); ImGui::NextColumn();
+		ImGui::Text("%'ld", static_cast<long>(pair.second.getPercentile(0.5f).asMicroseconds())); ImGui::NextColumn();
+		ImGui::Text("%'ld", static_cast<long>(pair.second.getPercentile(0.95f).asMicroseconds())); ImGui::NextColumn();
+		ImGui::Text("%'ld", static_cast<long>(pair.second.getMax().asMicroseconds())); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+	ImGui::Separator();
+
+	// show pathfinding workload of the last frame
+	auto const & path = parent.getContext().game->engine.ai.path.getStats();
+	ImGui::Text("Pathfinding per frame:");
+	ImGui::Text("%'lu completed, %'lu pending, %'lu nodes expanded",
+		path.completed, path.pending, path.expanded);
+
+	// show rendering workload of the last frame
+	auto const & render = parent.getContext().game->engine.ui.render.getStats();
+	ImGui::Text("Rendering per frame:");
+	ImGui::Text("%'lu terrain chunks, %'lu terrain vertices fetched",
+		render.chunks, render.terrain_vertices);
+	ImGui::Text("%'lu objects culled, %'lu rejected as not visible",
+		render.objects, render.rejected);
+	ImGui::Text("%'lu draw calls, %'lu sprites in %'lu batches",
+		render.draw_calls, render.sprites, render.batches);
+	ImGui::Text("%'lu lights culled, %'lu discarded",
+		render.lights, render.discarded);
+	ImGui::Text("%'lu merged edges, %'lu edge/light pairs",
+		render.edges, render.light_edges);
+
+	// show shadowcasting workload of the last frame
+	auto const & lighting = parent.getContext().game->engine.ui.lighting.getStats();
+	ImGui::Text("Shadowcasting per frame:");
+	ImGui::Text("%'lu edges near %'lu shadowcasting lights",
+		lighting.edges, lighting.shadows);
+	ImGui::Text("%'lu polygon vertices, %'lu polygons reused, %'lu computed",
+		lighting.vertices, lighting.cached, lighting.computed);
 }
 
 void TestMode::updateInspector() {
@@ -368,9 +418,8 @@ void TestMode::updateSpawner() {
 				// spawn at near position
 				core::getFreePosition([&](sf::Vector2u const & p) {
 					if (dungeon.has(p)) {
-						auto const & cell = dungeon.getCell(p);
-						return cell.terrain == core::Terrain::Floor
-							&& cell.entities.empty();
+						return dungeon.getTerrain(p) == core::Terrain::Floor
+							&& dungeon.getCell(p).entities.empty();
 					}
 					return false;
 				}, spawn.pos, 1000u);
@@ -429,6 +478,12 @@ void TestMode::updateTeleporter() {
 			auto& data = engine.session.movement.query(object);
 			core::vanish(engine.dungeon[data.scene], data);
 			core::spawn(dungeon, data, target_pos);
+			// propagate move to update focus
+			core::MoveEvent event;
+			event.actor = object;
+			event.target = target_pos;
+			event.type = core::MoveEvent::Left;
+			engine.physics.focus.receive(event);
 		}
 	}
 }
@@ -493,7 +548,7 @@ void TestMode::reloadScripts() {
 	// reinit AIs
 	for (auto& data: engine.session.script) {
 		auto const & script = *data.script;
-		script("onInit", data.api.get());
+		script(game::AiCallback::onInit, data.api.get());
 		++m;
 	}
 	context.log.debug << "[State/TestMode] Reloaded " << n
@@ -0,0 +1,62 @@
+#include <utils/assert.hpp>
+#include <utils/fixed_timestep.hpp>
+
+namespace utils {
+
+FixedTimestep::FixedTimestep(sf::Time const& step, std::size_t max_steps)
+	: step{step}
+	, accumulator{}
+	, dropped{}
+	, max_steps{max_steps}
+	, num_ticks{0u}
+	, histograms{} {
+	ASSERT(step > sf::Time::Zero);
+	ASSERT(max_steps > 0u);
+}
+
+void FixedTimestep::setTickRate(unsigned int hz) {
+	ASSERT(hz > 0u);
+	setStep(sf::microseconds(1000000 / hz));
+}
+
+void FixedTimestep::setStep(sf::Time const& step) {
+	ASSERT(step > sf::Time::Zero);
+	this->step = step;
+	accumulator = accumulator % step;
+}
+
+sf::Time FixedTimestep::getStep() const { return step; }
+
+void FixedTimestep::setMaxSteps(std::size_t max_steps) {
+	ASSERT(max_steps > 0u);
+	this->max_steps = max_steps;
+}
+
+std::size_t FixedTimestep::getMaxSteps() const { return max_steps; }
+
+sf::Time FixedTimestep::getRemainder() const { return accumulator; }
+
+float FixedTimestep::getAlpha() const {
+	return accumulator.asSeconds() / step.asSeconds();
+}
+
+std::uint64_t FixedTimestep::getNumTicks() const { return num_ticks; }
+
+sf::Time FixedTimestep::getDroppedTime() const { return dropped; }
+
+void FixedTimestep::reset() {
+	accumulator = sf::Time::Zero;
+	dropped = sf::Time::Zero;
+	num_ticks = 0u;
+	histograms.clear();
+}
+
+void FixedTimestep::record(std::string const& name, sf::Time const& duration) {
+	histograms[name].add(duration);
+}
+
+FixedTimestep::Histograms const& FixedTimestep::getHistograms() const {
+	return histograms;
+}
+
+}  // ::utils
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cmath>
+#include <utils/assert.hpp>
+#include <utils/histogram.hpp>
+
+namespace utils {
+
+std::size_t const Histogram::NUM_BUCKETS;
+
+Histogram::Histogram()
+	: buckets{}
+	, count{0u}
+	, total{0}
+	, min{0}
+	, max{0} {}
+
+void Histogram::add(sf::Time const& duration) {
+	auto us = duration.asMicroseconds();
+	if (us < 0) {
+		us = 0;
+	}
+	// determine power of two
+	std::size_t i = 0u;
+	while (i + 1u < NUM_BUCKETS && (sf::Int64{1} << i) <= us) {
+		++i;
+	}
+	++buckets[i];
+	if (count == 0u || us < min) {
+		min = us;
+	}
+	if (count == 0u || us > max) {
+		max = us;
+	}
+	total += us;
+	++count;
+}
+
+void Histogram::clear() {
+	buckets.fill(0u);
+	count = 0u;
+	total = 0;
+	min = 0;
+	max = 0;
+}
+
+std::uint64_t Histogram::getCount() const { return count; }
+
+sf::Time Histogram::getMin() const { return sf::microseconds(min); }
+
+sf::Time Histogram::getMax() const { return sf::microseconds(max); }
+
+sf::Time Histogram::getMean() const {
+	if (count == 0u) {
+		return sf::Time::Zero;
+	}
+	return sf::microseconds(total / static_cast<sf::Int64>(count));
+}
+
+sf::Time Histogram::getTotal() const { return sf::microseconds(total); }
+
+sf::Time Histogram::getPercentile(float ratio) const {
+	ASSERT(ratio >= 0.f);
+	ASSERT(ratio <= 1.f);
+	if (count == 0u) {
+		return sf::Time::Zero;
+	}
+	auto rank = static_cast<std::uint64_t>(std::ceil(ratio * count));
+	if (rank == 0u) {
+		rank = 1u;
+	}
+	std::uint64_t sum = 0u;
+	for (auto i = 0u; i < NUM_BUCKETS; ++i) {
+		sum += buckets[i];
+		if (sum >= rank) {
+			auto bound = i == 0u ? sf::Int64{0} : (sf::Int64{1} << i) - 1;
+			return sf::microseconds(std::min(bound, max));
+		}
+	}
+	return sf::microseconds(max);
+}
+
+std::uint64_t Histogram::getBucket(std::size_t i) const {
+	ASSERT(i < NUM_BUCKETS);
+	return buckets[i];
+}
+
+}  // ::utils
@@ -0,0 +1,88 @@
+#include <utils/assert.hpp>
+#include <utils/job_system.hpp>
+
+namespace utils {
+
+JobSystem::JobSystem(std::size_t num_workers)
+	: workers{}
+	, mutex{}
+	, wakeup{}
+	, finished{}
+	, job{nullptr}
+	, num_jobs{0u}
+	, generation{0u}
+	, busy{0u}
+	, next{0u}
+	, stopping{false} {
+	workers.reserve(num_workers);
+	for (auto i = 0u; i < num_workers; ++i) {
+		workers.emplace_back([this]() { work(); });
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		stopping = true;
+	}
+	wakeup.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+void JobSystem::process() {
+	std::size_t i;
+	while ((i = next++) < num_jobs) {
+		(*job)(i);
+	}
+}
+
+void JobSystem::work() {
+	std::size_t seen{0u};
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock{mutex};
+			wakeup.wait(lock, [&]() { return stopping || generation != seen; });
+			if (stopping) {
+				return;
+			}
+			seen = generation;
+		}
+		process();
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			--busy;
+		}
+		finished.notify_one();
+	}
+}
+
+std::size_t JobSystem::size() const { return workers.size() + 1u; }
+
+void JobSystem::run(std::size_t num_jobs, Job const& job) {
+	if (workers.empty() || num_jobs < 2u) {
+		// not worth waking up any worker
+		for (auto i = 0u; i < num_jobs; ++i) {
+			job(i);
+		}
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		ASSERT(busy == 0u);
+		this->job = &job;
+		this->num_jobs = num_jobs;
+		next = 0u;
+		busy = workers.size();
+		++generation;
+	}
+	wakeup.notify_all();
+	process();
+	// wait for all workers to finish this batch
+	std::unique_lock<std::mutex> lock{mutex};
+	finished.wait(lock, [&]() { return busy == 0u; });
+	this->job = nullptr;
+}
+
+}  // ::utils
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
@@ -11,6 +13,14 @@ float const MAX_LIGHT_RADIUS = 320.f;
 
 Edge::Edge() : u{}, v{} {}
 
+bool operator==(Edge const & lhs, Edge const & rhs) {
+	return lhs.u == rhs.u && lhs.v == rhs.v;
+}
+
+bool operator!=(Edge const & lhs, Edge const & rhs) {
+	return !(lhs == rhs);
+}
+
 // ---------------------------------------------------------------------------
 
 Light::Light()
@@ -23,6 +33,25 @@ Light::Light()
 
 // ---------------------------------------------------------------------------
 
+EdgeRange::EdgeRange()
+	: first{0u}
+	, last{0u} {
+}
+
+// ---------------------------------------------------------------------------
+
+float getLightRange(Light const & light) {
+	// half lightmap (0.75 * MAX_LIGHT_RADIUS) scaled like in prepareLight
+	return 0.75f * 3.f * light.radius;
+}
+
+float getShadowRange(Light const & light) {
+	// half lightmap (0.75 * MAX_LIGHT_RADIUS) scaled like in update
+	return 0.75f * 2.f * light.radius;
+}
+
+// ---------------------------------------------------------------------------
+
 sf::Vector2f getFarPoint(
 	sf::Vector2f const& origin, sf::Vector2f pos, sf::FloatRect const& box) {
 	ASSERT(origin != pos);
@@ -72,6 +101,325 @@ sf::Texture createLightmap(float radius, sf::Shader& shader) {
 
 // ---------------------------------------------------------------------------
 
+namespace lighting_impl {
+
+using Coord = float sf::Vector2f::*;
+
+/// Merge edges located on lines of constant `line` coordinate
+/**
+ *	@pre all edges satisfy u.*line == v.*line
+ *	@return end of the merged edges
+ */
+std::vector<Edge>::iterator mergeLines(std::vector<Edge>::iterator begin,
+	std::vector<Edge>::iterator end, Coord line, Coord run) {
+	if (begin == end) {
+		return end;
+	}
+	// let each edge run in ascending direction
+	for (auto i = begin; i != end; ++i) {
+		if (i->v.*run < i->u.*run) {
+			std::swap(i->u, i->v);
+		}
+	}
+	std::sort(begin, end, [&](Edge const & lhs, Edge const & rhs) {
+		if (lhs.u.*line != rhs.u.*line) {
+			return lhs.u.*line < rhs.u.*line;
+		}
+		return lhs.u.*run < rhs.u.*run;
+	});
+	// join each edge with its predecessor if they touch or overlap
+	auto last = begin;
+	for (auto i = std::next(begin); i != end; ++i) {
+		if (i->u.*line == last->u.*line && i->u.*run <= last->v.*run) {
+			last->v.*run = std::max(last->v.*run, i->v.*run);
+		} else {
+			*(++last) = *i;
+		}
+	}
+	return std::next(last);
+}
+
+bool clipEdge(sf::Vector2f const & min, sf::Vector2f const & max, Edge& edge) {
+	// clip using Liang-Barsky
+	auto delta = edge.v - edge.u;
+	float p[4] = {-delta.x, delta.x, -delta.y, delta.y};
+	float q[4] = {edge.u.x - min.x, max.x - edge.u.x, edge.u.y - min.y,
+		max.y - edge.u.y};
+	float t0{0.f}, t1{1.f};
+	for (auto i = 0u; i < 4u; ++i) {
+		if (p[i] == 0.f) {
+			if (q[i] < 0.f) {
+				// parallel and outside
+				return false;
+			}
+			continue;
+		}
+		auto t = q[i] / p[i];
+		if (p[i] < 0.f) {
+			t0 = std::max(t0, t);
+		} else {
+			t1 = std::min(t1, t);
+		}
+	}
+	if (t0 >= t1) {
+		return false;
+	}
+	auto u = edge.u;
+	edge.u = u + t0 * delta;
+	edge.v = u + t1 * delta;
+	return true;
+}
+
+float cross(sf::Vector2f const & lhs, sf::Vector2f const & rhs) {
+	return lhs.x * rhs.y - lhs.y * rhs.x;
+}
+
+/// Cast ray and return distance to the nearest obstacle
+float castRay(sf::Vector2f const & origin, sf::Vector2f const & direction,
+	float range, std::vector<Edge> const & edges) {
+	// distance to the border of the square
+	auto dist = std::numeric_limits<float>::max();
+	if (direction.x != 0.f) {
+		dist = std::min(dist, range / std::abs(direction.x));
+	}
+	if (direction.y != 0.f) {
+		dist = std::min(dist, range / std::abs(direction.y));
+	}
+	// distance to the nearest edge
+	for (auto const & edge : edges) {
+		auto segment = edge.v - edge.u;
+		auto denom = cross(direction, segment);
+		if (denom == 0.f) {
+			// parallel
+			continue;
+		}
+		auto diff = edge.u - origin;
+		auto t = cross(diff, segment) / denom;
+		auto s = cross(diff, direction) / denom;
+		// tolerate rounding errors when hitting the endpoints
+		auto tolerance = 0.001f / std::sqrt(
+			segment.x * segment.x + segment.y * segment.y);
+		if (t >= 0.f && s >= -tolerance && s <= 1.f + tolerance) {
+			dist = std::min(dist, t);
+		}
+	}
+	return dist;
+}
+
+}  // ::lighting_impl
+
+void mergeEdges(std::vector<Edge>& edges) {
+	// drop degenerated edges
+	auto end = std::remove_if(edges.begin(), edges.end(),
+		[](Edge const & edge) { return edge.u == edge.v; });
+	// group horizontal and vertical edges
+	auto horizontal = std::partition(edges.begin(), end,
+		[](Edge const & edge) { return edge.u.y == edge.v.y; });
+	auto vertical = std::partition(horizontal, end,
+		[](Edge const & edge) { return edge.u.x == edge.v.x; });
+	// merge each group and keep other edges behind them
+	auto last = lighting_impl::mergeLines(edges.begin(), horizontal,
+		&sf::Vector2f::y, &sf::Vector2f::x);
+	last = std::move(horizontal, lighting_impl::mergeLines(horizontal,
+		vertical, &sf::Vector2f::x, &sf::Vector2f::y), last);
+	last = std::move(vertical, end, last);
+	edges.erase(last, edges.end());
+}
+
+void clipEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<Edge>& result) {
+	sf::Vector2f const size{range, range};
+	auto min = origin - size;
+	auto max = origin + size;
+	for (auto edge : edges) {
+		if (lighting_impl::clipEdge(min, max, edge)) {
+			result.push_back(edge);
+		}
+	}
+}
+
+void clipEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<std::size_t> const & indices,
+	EdgeRange const & subset, std::vector<Edge>& result) {
+	ASSERT(subset.first <= subset.last);
+	ASSERT(subset.last <= indices.size());
+	sf::Vector2f const size{range, range};
+	auto min = origin - size;
+	auto max = origin + size;
+	for (auto i = subset.first; i < subset.last; ++i) {
+		ASSERT(indices[i] < edges.size());
+		auto edge = edges[indices[i]];
+		if (lighting_impl::clipEdge(min, max, edge)) {
+			result.push_back(edge);
+		}
+	}
+}
+
+void selectEdges(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<std::size_t>& indices) {
+	sf::Vector2f const size{range, range};
+	auto min = origin - size;
+	auto max = origin + size;
+	for (auto i = 0u; i < edges.size(); ++i) {
+		auto const & edge = edges[i];
+		// compare bounding box of the edge with the square
+		if (std::max(edge.u.x, edge.v.x) < min.x ||
+			std::min(edge.u.x, edge.v.x) > max.x ||
+			std::max(edge.u.y, edge.v.y) < min.y ||
+			std::min(edge.u.y, edge.v.y) > max.y) {
+			continue;
+		}
+		indices.push_back(i);
+	}
+}
+
+void computeVisibility(sf::Vector2f const & origin, float range,
+	std::vector<Edge> const & edges, std::vector<sf::Vector2f>& fan) {
+	ASSERT(range > 0.f);
+	float const epsilon = 0.0001f;
+
+	// determine angles of all rays
+	std::vector<float> angles;
+	angles.reserve(6u * edges.size() + 12u);
+	auto addRays = [&](sf::Vector2f const & pos) {
+		auto delta = pos - origin;
+		if (delta == sf::Vector2f{}) {
+			return;
+		}
+		auto angle = std::atan2(delta.y, delta.x);
+		angles.push_back(angle - epsilon);
+		angles.push_back(angle);
+		angles.push_back(angle + epsilon);
+	};
+	addRays(origin + sf::Vector2f{-range, -range});
+	addRays(origin + sf::Vector2f{range, -range});
+	addRays(origin + sf::Vector2f{range, range});
+	addRays(origin + sf::Vector2f{-range, range});
+	for (auto const & edge : edges) {
+		addRays(edge.u);
+		addRays(edge.v);
+	}
+	std::sort(angles.begin(), angles.end());
+	angles.erase(std::unique(angles.begin(), angles.end()), angles.end());
+
+	// cast rays in angular order
+	fan.clear();
+	fan.push_back(origin);
+	for (auto angle : angles) {
+		sf::Vector2f direction{std::cos(angle), std::sin(angle)};
+		auto dist = lighting_impl::castRay(origin, direction, range, edges);
+		auto pos = origin + dist * direction;
+		if (fan.size() == 1u || fan.back() != pos) {
+			fan.push_back(pos);
+		}
+	}
+	// close polygon
+	auto first = fan[1u];
+	fan.push_back(first);
+}
+
+// ---------------------------------------------------------------------------
+
+VisibilityCache::Entry::Entry()
+	: origin{}
+	, range{0.f}
+	, edges{}
+	, fan{}
+	, used{false} {
+}
+
+VisibilityCache::VisibilityCache()
+	: entries{}
+	, clipped{}
+	, num_hits{0u}
+	, num_misses{0u} {
+}
+
+std::vector<sf::Vector2f> const & VisibilityCache::lookup(
+	sf::Vector2f const & origin, float range) {
+	// search polygon computed with the same geometry
+	for (auto& entry : entries) {
+		if (entry.origin == origin && entry.range == range &&
+			entry.edges == clipped) {
+			entry.used = true;
+			++num_hits;
+			return entry.fan;
+		}
+	}
+
+	// compute new polygon
+	entries.emplace_back();
+	auto& entry = entries.back();
+	entry.origin = origin;
+	entry.range = range;
+	entry.edges = clipped;
+	entry.used = true;
+	computeVisibility(origin, range, entry.edges, entry.fan);
+	++num_misses;
+	return entry.fan;
+}
+
+std::vector<sf::Vector2f> const & VisibilityCache::query(
+	sf::Vector2f const & origin, float range, std::vector<Edge> const & edges) {
+	clipped.clear();
+	clipEdges(origin, range, edges, clipped);
+	return lookup(origin, range);
+}
+
+std::vector<sf::Vector2f> const & VisibilityCache::query(
+	sf::Vector2f const & origin, float range, std::vector<Edge> const & edges,
+	std::vector<std::size_t> const & indices, EdgeRange const & subset) {
+	clipped.clear();
+	clipEdges(origin, range, edges, indices, subset, clipped);
+	return lookup(origin, range);
+}
+
+void VisibilityCache::cleanup() {
+	entries.erase(std::remove_if(entries.begin(), entries.end(),
+		[](Entry const & entry) { return !entry.used; }), entries.end());
+	for (auto& entry : entries) {
+		entry.used = false;
+	}
+	num_hits = 0u;
+	num_misses = 0u;
+}
+
+std::size_t VisibilityCache::size() const {
+	return entries.size();
+}
+
+std::size_t VisibilityCache::getNumHits() const {
+	return num_hits;
+}
+
+std::size_t VisibilityCache::getNumMisses() const {
+	return num_misses;
+}
+
+// ---------------------------------------------------------------------------
+
+namespace lighting_impl {
+
+Stats::Stats()
+	: edges{0u}
+	, shadows{0u}
+	, vertices{0u}
+	, cached{0u}
+	, computed{0u} {
+}
+
+bool needsShadowMap(std::vector<Light> const & lights, std::size_t lod) {
+	if (lod == 0u) {
+		return false;
+	}
+	return std::any_of(lights.begin(), lights.end(),
+		[&](Light const & light) { return light.lod <= lod; });
+}
+
+}  // ::lighting_impl
+
+// ---------------------------------------------------------------------------
+
 LightingSystem::LightingSystem(
 	sf::Vector2u const& size, sf::Texture const& lightmap)
 	: shadow_buffer{}
@@ -83,7 +431,10 @@ LightingSystem::LightingSystem(
 	, light_sprite{}
 	, lod{0u}
 	, num_drawn_lights{0u}
-	, num_drawn_shadows{0u} {
+	, num_drawn_shadows{0u}
+	, visibility{}
+	, fan_vertices{sf::TrianglesFan}
+	, stats{} {
 	resize(size);
 	// prepare light sprite
 	auto map_size = sf::Vector2f{lightmap.getSize()};
@@ -112,6 +463,10 @@ sf::Texture const & LightingSystem::getLightmap() const {
 	return *light_sprite.getTexture();
 }
 
+lighting_impl::Stats const & LightingSystem::getStats() const {
+	return stats;
+}
+
 void LightingSystem::resize(sf::Vector2u const& size) {
 	// resize default view
 	auto window_size = sf::Vector2f{size};
@@ -128,27 +483,30 @@ void LightingSystem::clear() {
 	shadow_buffer.clear(shadow);
 	light_buffer.clear(shadow);
 	fog_buffer.clear(shadow);
+	// drop polygons of lights which were not drawn last frame
+	visibility.cleanup();
+	stats = lighting_impl::Stats{};
 }
 
 void LightingSystem::update(sf::View const& scene, sf::View const& screen,
-	std::vector<Edge> const& edges, std::vector<Light> const& lights) {
+	std::vector<Edge> const& edges, std::vector<std::size_t> const& indices,
+	std::vector<Light> const& lights, std::vector<EdgeRange> const& ranges) {
 	// tba: ASSERT buffers to be created
+	ASSERT(ranges.size() == lights.size());
 
 	if (lod == 0u) {
 		// lighting is disabled!
 		return;
 	}
 
-	// prepare rendering
-	sf::VertexArray gloom{sf::Quads};
-	auto size = scene.getSize();
-	sf::FloatRect box{scene.getCenter() - size / 2.f, size};
-
 	num_drawn_shadows = 0u;
-	if (!edges.empty()) {
+	if (lighting_impl::needsShadowMap(lights, lod)) {
+		auto map_size = sf::Vector2f{light_sprite.getTexture()->getSize()};
+
 		// create shadowmaps
 		shadow_buffer.setView(screen);
-		for (auto const& light : lights) {
+		for (auto i = 0u; i < lights.size(); ++i) {
+			auto const & light = lights[i];
 			if (light.lod > lod) {
 				// this shadow is not drawn at this low level of details
 				continue;
@@ -160,21 +518,33 @@ void LightingSystem::update(sf::View const& scene, sf::View const& screen,
 			prepareLight(light);
 			float scale = 2.f * light.radius / MAX_LIGHT_RADIUS;  // shorter shadows
 			light_sprite.setScale({scale, scale});
-			light_sprite.setColor(sf::Color::White);
-			tmp_buffer.draw(light_sprite);
 			
 			if (light.cast_shadow) {
-				// cast shadows
-				gloom.clear();
-				for (auto const& edge : edges) {
-					auto p = getFarPoint(light.pos, edge.u, box);
-					auto q = getFarPoint(light.pos, edge.v, box);
-					gloom.append({edge.u, shadow});
-					gloom.append({edge.v, shadow});
-					gloom.append({q, shadow});
-					gloom.append({p, shadow});
+				if (shadow != sf::Color::Black) {
+					// tint the light where it is shadowed
+					light_sprite.setColor(shadow);
+					tmp_buffer.draw(light_sprite);
+				}
+				// note: the edges are already merged per camera
+				auto const & edge_range = ranges[i];
+				ASSERT(edge_range.first <= edge_range.last);
+				ASSERT(edge_range.last <= indices.size());
+				stats.edges += edge_range.last - edge_range.first;
+				// draw visible part of the light
+				auto range = map_size.x / 2.f * scale;
+				auto const & fan = visibility.query(
+					light.pos, range, edges, indices, edge_range);
+				fan_vertices.clear();
+				for (auto const & pos : fan) {
+					fan_vertices.append({pos, sf::Color::White,
+						map_size / 2.f + (pos - light.pos) / scale});
 				}
-				tmp_buffer.draw(gloom, sf::BlendMultiply);
+				tmp_buffer.draw(fan_vertices, light_sprite.getTexture());
+				++stats.shadows;
+				stats.vertices += fan.size();
+			} else {
+				light_sprite.setColor(sf::Color::White);
+				tmp_buffer.draw(light_sprite);
 			}
 
 			// apply this shadowmap to primary buffer
@@ -186,6 +556,8 @@ void LightingSystem::update(sf::View const& scene, sf::View const& screen,
 		if (num_drawn_shadows > 0u) {
 			shadow_buffer.display();
 		}
+		stats.cached = visibility.getNumHits();
+		stats.computed = visibility.getNumMisses();
 	}
 
 	light_buffer.setView(scene);
@@ -1,13 +1,68 @@
+#include <cmath>
 #include <iostream>
 #include <utils/lua_utils.hpp>
 
 namespace utils {
 
+namespace lua_impl {
+
+RandomStream& getStream(lua_State* state) {
+	auto ptr = lua_touserdata(state, lua_upvalueindex(1));
+	ASSERT(ptr != nullptr);
+	return *static_cast<RandomStream*>(ptr);
+}
+
+// same semantics as lua's math.random
+int random(lua_State* state) {
+	auto& rng = getStream(state);
+	auto r = rng.next() / static_cast<lua_Number>(4294967296.0);
+	lua_Number low, up;
+	switch (lua_gettop(state)) {
+		case 0:
+			lua_pushnumber(state, r);
+			return 1;
+		case 1:
+			low = 1;
+			up = luaL_checknumber(state, 1);
+			break;
+		case 2:
+			low = luaL_checknumber(state, 1);
+			up = luaL_checknumber(state, 2);
+			break;
+		default:
+			return luaL_error(state, "wrong number of arguments");
+	}
+	luaL_argcheck(state, low <= up, 2, "interval is empty");
+	lua_pushnumber(state, std::floor(r * (up - low + 1)) + low);
+	return 1;
+}
+
+// same semantics as lua's math.randomseed
+int randomseed(lua_State* state) {
+	auto& rng = getStream(state);
+	rng.seed(static_cast<std::uint32_t>(luaL_checkinteger(state, 1)));
+	return 0;
+}
+
+}  // ::lua_impl
+
 Script::Script()
 	: lua{}
 	, loaded{false}
-	, filename{} {
+	, filename{}
+	, rng{std::make_unique<RandomStream>()} {
 	lua.open_libraries(sol::lib::base, sol::lib::math, sol::lib::table);
+	
+	// replace math.random to use the script's own stream
+	auto state = lua.lua_state();
+	lua_getglobal(state, "math");
+	lua_pushlightuserdata(state, rng.get());
+	lua_pushcclosure(state, lua_impl::random, 1);
+	lua_setfield(state, -2, "random");
+	lua_pushlightuserdata(state, rng.get());
+	lua_pushcclosure(state, lua_impl::randomseed, 1);
+	lua_setfield(state, -2, "randomseed");
+	lua_pop(state, 1);
 }
 
 bool Script::loadFromMemory(std::string const& string) {
@@ -40,4 +95,8 @@ std::string Script::getFilename() const {
 	return filename;
 }
 
+void Script::seed(std::uint32_t seed) {
+	rng->seed(seed);
+}
+
 }  // ::utils
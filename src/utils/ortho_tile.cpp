@@ -158,6 +158,29 @@ void OrthoTile::refresh(sf::Vector2u const& tile_pos,
 	}
 }
 
+sf::Vector2u OrthoTile::getOffset(sf::Vector2u const& tile_size) const {
+	ASSERT(vertices.size() == 4u);
+	// note: texcoords are `offset * (tile_size + 2) + 1` due to the atlas
+	auto const & tex = vertices[0].texCoords;
+	return {static_cast<unsigned int>(tex.x - 1.f) / (tile_size.x + 2u),
+		static_cast<unsigned int>(tex.y - 1.f) / (tile_size.y + 2u)};
+}
+
+ShadingCase OrthoTile::getShading() const {
+	ASSERT(vertices.size() == 4u);
+	ShadingCase shading = 0u;
+	ShadingCase const flags[] = {ShadeTopLeft, ShadeTopRight,
+		ShadeBottomRight, ShadeBottomLeft};
+	for (auto i = 0u; i < 4u; ++i) {
+		// note: alpha is ignored, because the editor modifies it
+		auto const & c = vertices[i].color;
+		if (c.r == 0u && c.g == 0u && c.b == 0u) {
+			shading |= flags[i];
+		}
+	}
+	return shading;
+}
+
 void OrthoTile::fetchTile(sf::VertexArray& out) const {
 	ASSERT(vertices.size() == 4u);
 	if (std_tri) {
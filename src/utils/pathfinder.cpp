@@ -1,5 +1,6 @@
 #include <iostream>
 
+#include <utils/assert.hpp>
 #include <utils/pathfinder.hpp>
 
 namespace utils {
@@ -25,38 +26,70 @@ bool ClosedlistEqual::operator()(PathNode const& lhs, PathNode const& rhs) const
 	return lhs.pos == rhs.pos;
 }
 
-/*
-// ---------------------------------------------------------------------------
+// --------------------------------------------------------------------
 
-PathDict::PathDict(sf::Vector2u const& grid_size)
-	: grid_size{grid_size}, nodes{} {
-	nodes.resize(grid_size.x * grid_size.y);
-	clear();
+DictNode::DictNode(sf::Vector2u pos)
+	: pos{pos}
+	, previous{nullptr}
+	, f{0.f}
+	, g{0.f}
+	, status{NodeStatus::Unknown}
+	, generation{0u} {
 }
 
-void PathDict::clear() {
+// --------------------------------------------------------------------
+
+PathDict::PathDict(sf::Vector2u const& grid_size)
+	: grid_size{grid_size}
+	, nodes{}
+	, generation{1u} {
+	nodes.reserve(grid_size.x * grid_size.y);
 	sf::Vector2u pos;
 	for (pos.y = 0u; pos.y < grid_size.y; ++pos.y) {
 		for (pos.x = 0u; pos.x < grid_size.x; ++pos.x) {
-			at(pos) = PathNode{pos};
+			nodes.emplace_back(pos);
 		}
 	}
 }
 
-PathNode& PathDict::at(sf::Vector2u const& pos) {
-	std::size_t index = pos.x + pos.y * grid_size.x;
-	return nodes.at(index);
+void PathDict::clear() {
+	++generation;
+	if (generation == 0u) {
+		// overflow: reset all nodes once
+		for (auto& node: nodes) {
+			node.generation = 0u;
+		}
+		generation = 1u;
+	}
+}
+
+bool PathDict::has(sf::Vector2u const& pos) const {
+	return pos.x < grid_size.x && pos.y < grid_size.y;
+}
+
+DictNode& PathDict::at(sf::Vector2u const& pos) {
+	ASSERT(has(pos));
+	auto& node = nodes[pos.x + pos.y * grid_size.x];
+	if (node.generation != generation) {
+		// node is outdated
+		node = DictNode{pos};
+		node.generation = generation;
+	}
+	return node;
 }
 
-// ---------------------------------------------------------------------------
+// --------------------------------------------------------------------
 
-CoordHash::CoordHash(sf::Vector2u const& grid_size) : grid_size{grid_size} {}
+CoordHash::CoordHash(sf::Vector2u const& grid_size)
+	: grid_size{grid_size} {
+}
 
-std::size_t CoordHash::range() const { return grid_size.x * grid_size.y; }
+std::size_t CoordHash::range() const {
+	return grid_size.x * grid_size.y;
+}
 
 std::size_t CoordHash::operator()(sf::Vector2u const& pos) const {
 	return pos.x + pos.y * grid_size.x;
 }
-*/
 
 }  // ::utils
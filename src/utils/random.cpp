@@ -0,0 +1,52 @@
+#include <utils/assert.hpp>
+#include <utils/random.hpp>
+
+namespace utils {
+
+RandomStream::RandomStream(std::uint32_t seed)
+	: engine{seed}
+	, initial{seed} {}
+
+void RandomStream::seed(std::uint32_t seed) {
+	engine.seed(seed);
+	initial = seed;
+}
+
+std::uint32_t RandomStream::getSeed() const { return initial; }
+
+std::uint32_t RandomStream::next() {
+	return static_cast<std::uint32_t>(engine());
+}
+
+int RandomStream::operator()(int min, int max) {
+	ASSERT(min <= max);
+	auto range = static_cast<std::uint64_t>(
+		static_cast<std::int64_t>(max) - static_cast<std::int64_t>(min)) + 1u;
+	// scale to range (range is at most 2^32)
+	auto offset = (next() * range) >> 32u;
+	return static_cast<int>(static_cast<std::int64_t>(min) +
+		static_cast<std::int64_t>(offset));
+}
+
+unsigned int RandomStream::operator()(unsigned int min, unsigned int max) {
+	ASSERT(min <= max);
+	auto range = static_cast<std::uint64_t>(max - min) + 1u;
+	auto offset = (next() * range) >> 32u;
+	return min + static_cast<unsigned int>(offset);
+}
+
+float RandomStream::operator()(float min, float max) {
+	ASSERT(min <= max);
+	// use 24 bits to stay within float's precision
+	auto ratio = (next() >> 8u) / static_cast<float>(1u << 24u);
+	return min + ratio * (max - min);
+}
+
+std::uint32_t RandomStream::derive(std::uint32_t seed, std::uint32_t stream) {
+	std::seed_seq seq{seed, stream};
+	std::uint32_t out;
+	seq.generate(&out, &out + 1);
+	return out;
+}
+
+}  // ::utils
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <utils/assert.hpp>
+#include <utils/sprite_batch.hpp>
+
+namespace utils {
+
+SpriteBatch::Batch::Batch()
+	: texture{nullptr}
+	, blend{sf::BlendAlpha}
+	, brightness{1.f}
+	, min_saturation{0.f}
+	, max_saturation{1.f}
+	, vertices{sf::Triangles} {
+}
+
+SpriteBatch::SpriteBatch()
+	: pool{}
+	, num_batches{0u}
+	, num_sprites{0u} {
+}
+
+void SpriteBatch::clear() {
+	for (auto i = 0u; i < num_batches; ++i) {
+		pool[i].vertices.clear();
+	}
+	num_batches = 0u;
+	num_sprites = 0u;
+}
+
+void SpriteBatch::add(sf::Sprite const & sprite, sf::Transform const & matrix,
+	float brightness, float min_saturation,
+	float max_saturation, sf::BlendMode const & blend) {
+	ASSERT(brightness >= 0.f);
+	ASSERT(brightness <= 1.f);
+	auto texture = sprite.getTexture();
+	if (texture == nullptr) {
+		return;
+	}
+	auto color = sprite.getColor();
+	if (min_saturation <= 0.f && max_saturation >= 1.f) {
+		// clamping has no effect, so brightness can be applied per vertex
+		color.r = static_cast<sf::Uint8>(color.r * brightness);
+		color.g = static_cast<sf::Uint8>(color.g * brightness);
+		color.b = static_cast<sf::Uint8>(color.b * brightness);
+		brightness = 1.f;
+		min_saturation = 0.f;
+		max_saturation = 1.f;
+	}
+
+	// continue most recent group if possible
+	// note: joining an earlier group would change the drawing order
+	Batch* batch{nullptr};
+	if (num_batches > 0u) {
+		auto& last = pool[num_batches - 1u];
+		if (last.texture == texture && last.blend == blend &&
+			last.brightness == brightness &&
+			last.min_saturation == min_saturation &&
+			last.max_saturation == max_saturation) {
+			batch = &last;
+		}
+	}
+	if (batch == nullptr) {
+		// start new group
+		if (pool.size() <= num_batches) {
+			pool.emplace_back();
+		}
+		batch = &pool[num_batches++];
+		batch->texture = texture;
+		batch->blend = blend;
+		batch->brightness = brightness;
+		batch->min_saturation = min_saturation;
+		batch->max_saturation = max_saturation;
+	}
+
+	// determine quad like sf::Sprite does
+	auto const rect = sprite.getTextureRect();
+	auto const w = static_cast<float>(std::abs(rect.width));
+	auto const h = static_cast<float>(std::abs(rect.height));
+	auto const left = static_cast<float>(rect.left);
+	auto const right = left + rect.width;
+	auto const top = static_cast<float>(rect.top);
+	auto const bottom = top + rect.height;
+	auto transform = matrix * sprite.getTransform();
+	sf::Vertex const tl{transform.transformPoint(0.f, 0.f), color, {left, top}};
+	sf::Vertex const tr{transform.transformPoint(w, 0.f), color, {right, top}};
+	sf::Vertex const br{transform.transformPoint(w, h), color, {right, bottom}};
+	sf::Vertex const bl{transform.transformPoint(0.f, h), color, {left, bottom}};
+	auto& vertices = batch->vertices;
+	vertices.append(tl);
+	vertices.append(tr);
+	vertices.append(br);
+	vertices.append(tl);
+	vertices.append(br);
+	vertices.append(bl);
+	++num_sprites;
+}
+
+std::size_t SpriteBatch::size() const {
+	return num_batches;
+}
+
+std::size_t SpriteBatch::getNumSprites() const {
+	return num_sprites;
+}
+
+SpriteBatch::Batch const & SpriteBatch::operator[](std::size_t i) const {
+	ASSERT(i < num_batches);
+	return pool[i];
+}
+
+std::size_t SpriteBatch::draw(sf::RenderTarget& target, sf::Shader* shader) const {
+	sf::RenderStates states;
+	states.shader = shader;
+	for (auto i = 0u; i < num_batches; ++i) {
+		auto const & batch = pool[i];
+		if (shader != nullptr) {
+			shader->setParameter("brightness", batch.brightness);
+			shader->setParameter("min_saturation", batch.min_saturation);
+			shader->setParameter("max_saturation", batch.max_saturation);
+			shader->setParameter("texture", sf::Shader::CurrentTexture);
+		}
+		states.texture = batch.texture;
+		states.blendMode = batch.blend;
+		target.draw(batch.vertices, states);
+	}
+	return num_batches;
+}
+
+}  // ::utils
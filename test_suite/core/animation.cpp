@@ -527,4 +527,61 @@ BOOST_AUTO_TEST_CASE(event_cannot_change_torso_base_to_null) {
 		data.tpl.torso[core::SpriteTorsoLayer::Base], &fix.demo_template.torso);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_update_equals_sequential_update) {
+	auto& fix = Singleton<AnimationFixture>::get();
+	fix.reset();
+
+	struct Run {
+		core::AnimationSender animation_sender;
+		core::AnimationManager animation_manager;
+		core::animation_impl::Context context;
+
+		Run(AnimationFixture& fix)
+			: animation_sender{}
+			, animation_manager{1000u}
+			, context{fix.log, animation_sender, animation_manager} {
+			for (core::ObjectID id = 1u; id <= 1000u; ++id) {
+				auto& data = animation_manager.acquire(id);
+				data.tpl.legs[core::SpriteLegLayer::Base] = &fix.demo_template.legs;
+				data.tpl.torso[core::SpriteTorsoLayer::Base] = &fix.demo_template.torso;
+				data.is_moving = id % 2u == 0u;
+				if (id % 3u == 0u) {
+					data.current = core::AnimationAction::Range;
+				}
+				data.torso.elapsed = sf::milliseconds(id % 50u);
+			}
+		}
+	};
+
+	Run sequential{fix}, parallel{fix};
+	utils::JobSystem jobs{3u};
+	std::vector<core::animation_impl::Chunk> chunks;
+	for (auto i = 0u; i < 20u; ++i) {
+		core::animation_impl::updateRange(sequential.context,
+			sequential.animation_manager.begin(),
+			sequential.animation_manager.end(), sf::milliseconds(10));
+		core::animation_impl::updateParallel(parallel.context, jobs, chunks,
+			parallel.animation_manager.begin(),
+			parallel.animation_manager.end(), sf::milliseconds(10));
+	}
+	BOOST_CHECK_EQUAL(chunks.size(), 4u);
+
+	// compare results
+	auto const& expected = sequential.animation_sender.data();
+	auto const& actual = parallel.animation_sender.data();
+	BOOST_REQUIRE(!expected.empty());
+	BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+	for (auto i = 0u; i < expected.size(); ++i) {
+		BOOST_CHECK_EQUAL(expected[i].actor, actual[i].actor);
+		BOOST_CHECK(expected[i].action == actual[i].action);
+	}
+	for (core::ObjectID id = 1u; id <= 1000u; ++id) {
+		auto const& lhs = sequential.animation_manager.query(id);
+		auto const& rhs = parallel.animation_manager.query(id);
+		BOOST_CHECK(lhs.current == rhs.current);
+		BOOST_CHECK_EQUAL(lhs.torso.index, rhs.torso.index);
+		BOOST_CHECK_EQUAL(lhs.legs.index, rhs.legs.index);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
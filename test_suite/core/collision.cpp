@@ -19,6 +19,7 @@ struct CollisionFixture {
 	core::CollisionManager collision_manager;
 	core::DungeonSystem dungeon_system;
 	core::MovementManager movement_manager;
+	core::collision_impl::Broadphase broadphase;
 	core::collision_impl::Context context;
 
 	CollisionFixture()
@@ -30,8 +31,9 @@ struct CollisionFixture {
 		, collision_manager{}
 		, dungeon_system{}
 		, movement_manager{}
+		, broadphase{}
 		, context{log, collision_sender, move_sender, teleport_sender,
-			collision_manager, dungeon_system, movement_manager} {
+			collision_manager, dungeon_system, movement_manager, broadphase} {
 		// add a scenes
 		auto scene = dungeon_system.create(
 			dummy_tileset, sf::Vector2u{5u, 6u}, sf::Vector2f{1.f, 1.f});
@@ -39,7 +41,7 @@ struct CollisionFixture {
 		auto& dungeon = dungeon_system[1u];
 		for (auto y = 1u; y <= 5u; ++y) {
 			for (auto x = 1u; x <= 4u; ++x) {
-				dungeon.getCell({x, y}).terrain = core::Terrain::Floor;
+				dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 			}
 		}
 	}
@@ -56,6 +58,7 @@ struct CollisionFixture {
 		}
 		// remove components
 		for (auto id : ids) {
+			broadphase.remove(id);
 			collision_manager.release(id);
 			movement_manager.release(id);
 		}
@@ -81,6 +84,7 @@ struct CollisionFixture {
 		mve.pos = sf::Vector2f{pos};
 		auto& dungeon = dungeon_system[1u];
 		dungeon.getCell(pos).entities.push_back(id);
+		core::collision_impl::syncBroadphase(context, id);
 		return id;
 	}
 };
@@ -90,21 +94,15 @@ struct CollisionFixture {
 BOOST_AUTO_TEST_SUITE(collision_test)
 
 BOOST_AUTO_TEST_CASE(tile_collision_occures_for_void_tiles) {
-	core::DungeonCell cell;
-	cell.terrain = core::Terrain::Void;
-	BOOST_CHECK(core::checkTileCollision(cell));
+	BOOST_CHECK(core::checkTileCollision(core::Terrain::Void));
 }
 
 BOOST_AUTO_TEST_CASE(tile_collision_occures_for_wall_tiles) {
-	core::DungeonCell cell;
-	cell.terrain = core::Terrain::Wall;
-	BOOST_CHECK(core::checkTileCollision(cell));
+	BOOST_CHECK(core::checkTileCollision(core::Terrain::Wall));
 }
 
 BOOST_AUTO_TEST_CASE(tile_collision_does_not_occure_for_floor_tiles) {
-	core::DungeonCell cell;
-	cell.terrain = core::Terrain::Floor;
-	BOOST_CHECK(!core::checkTileCollision(cell));
+	BOOST_CHECK(!core::checkTileCollision(core::Terrain::Floor));
 }
 
 BOOST_AUTO_TEST_CASE(regular_objects_collision_fails_if_bullet_passed_in) {
@@ -397,7 +395,7 @@ BOOST_AUTO_TEST_CASE(bullets_tile_collision_is_checked_on_tile_reached) {
 	m_a.target = event.target;
 	m_a.pos = sf::Vector2f{event.target};
 	// propagate movement
-	auto const& f_a = fix.collision_manager.query(actor);
+	auto& f_a = fix.collision_manager.query(actor);
 	core::collision_impl::onTileReached(fix.context, f_a, event);
 	// expect tile collision
 	auto const& colls = fix.collision_sender.data();
@@ -429,6 +427,272 @@ BOOST_AUTO_TEST_CASE(bullets_object_collision_is_checked_on_bullet_check) {
 	BOOST_CHECK(!colls[0].reset);
 }
 
+BOOST_AUTO_TEST_CASE(bullets_object_collision_is_checked_in_batch) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto actor = fix.add_object({1u, 1u}, true);
+	auto other = fix.add_object({2u, 1u}, false);
+	fix.add_object({4u, 5u}, false);
+	// move bullet close to other object
+	auto& m_a = fix.movement_manager.query(actor);
+	m_a.pos.x += 0.75f;
+	// trigger all bullets' collision checks
+	core::collision_impl::checkBullets(fix.context);
+	// expect object collision
+	auto const& colls = fix.collision_sender.data();
+	BOOST_REQUIRE_EQUAL(colls.size(), 1u);
+	BOOST_CHECK_EQUAL(colls[0].actor, actor);
+	BOOST_CHECK_EQUAL(colls[0].collider, other);
+	BOOST_CHECK(!colls[0].reset);
+	// expect collider to be ignored by further checks
+	fix.collision_sender.clear();
+	core::collision_impl::checkBullets(fix.context);
+	BOOST_CHECK(fix.collision_sender.data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(bullet_hits_are_ignored_in_sorted_order) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto bullet = fix.add_object({1u, 1u}, true);
+	auto& c_b = fix.collision_manager.query(bullet);
+	c_b.ignore.push_back(5u);
+	core::collision_impl::onBulletHit(fix.context, c_b, {7u, 2u, 5u});
+	BOOST_REQUIRE_EQUAL(c_b.ignore.size(), 3u);
+	BOOST_CHECK_EQUAL(c_b.ignore[0], 2u);
+	BOOST_CHECK_EQUAL(c_b.ignore[1], 5u);
+	BOOST_CHECK_EQUAL(c_b.ignore[2], 7u);
+	BOOST_CHECK(core::collision_impl::isIgnored(c_b, 7u));
+	BOOST_CHECK(!core::collision_impl::isIgnored(c_b, 3u));
+}
+
+BOOST_AUTO_TEST_CASE(swept_distance_is_measured_to_closest_point_of_segment) {
+	auto dist = core::collision_impl::getSweptDistance(
+		{1.f, 1.f}, {5.f, 1.f}, {3.f, 2.f});
+	BOOST_CHECK_CLOSE(dist, 1.f, 0.0001f);
+	dist = core::collision_impl::getSweptDistance(
+		{1.f, 1.f}, {5.f, 1.f}, {7.f, 1.f});
+	BOOST_CHECK_CLOSE(dist, 4.f, 0.0001f);
+	dist = core::collision_impl::getSweptDistance(
+		{1.f, 1.f}, {1.f, 1.f}, {1.f, 3.f});
+	BOOST_CHECK_CLOSE(dist, 4.f, 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(fast_bullet_hits_object_passed_between_checks) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto bullet = fix.add_object({1u, 1u}, true);
+	auto object = fix.add_object({2u, 1u}, false);
+	auto& c_b = fix.collision_manager.query(bullet);
+	c_b.last_pos = {1.f, 1.f};
+	c_b.last_scene = 1u;
+	// bullet passed the object since its last check
+	auto& m_b = fix.movement_manager.query(bullet);
+	m_b.pos = {4.f, 1.f};
+	core::collision_impl::checkBullets(fix.context);
+
+	auto const& colls = fix.collision_sender.data();
+	BOOST_REQUIRE_EQUAL(colls.size(), 1u);
+	BOOST_CHECK_EQUAL(colls[0].actor, bullet);
+	BOOST_CHECK_EQUAL(colls[0].collider, object);
+	BOOST_CHECK_VECTOR_CLOSE(c_b.last_pos, m_b.pos, 0.0001f);
+	BOOST_CHECK_EQUAL(c_b.last_scene, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(unchecked_bullet_only_tests_its_current_position) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto bullet = fix.add_object({1u, 1u}, true);
+	fix.add_object({2u, 1u}, false);
+	auto& m_b = fix.movement_manager.query(bullet);
+	m_b.pos = {4.f, 1.f};
+	core::collision_impl::checkBullets(fix.context);
+
+	BOOST_CHECK(fix.collision_sender.data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(bullet_sweep_compares_colliders_at_the_same_time) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto bullet = fix.add_object({1u, 1u}, true);
+	auto late = fix.add_object({2u, 1u}, false);
+	auto leaving = fix.add_object({3u, 2u}, false);
+	auto& c_b = fix.collision_manager.query(bullet);
+	c_b.last_pos = {1.f, 1.f};
+	c_b.last_scene = 1u;
+	// object entered the path after the bullet passed
+	auto& c_l = fix.collision_manager.query(late);
+	c_l.last_pos = {4.f, 5.f};
+	c_l.last_scene = 1u;
+	// object left the path after the bullet passed
+	auto& c_o = fix.collision_manager.query(leaving);
+	c_o.last_pos = {3.f, 1.f};
+	c_o.last_scene = 1u;
+	auto& m_b = fix.movement_manager.query(bullet);
+	m_b.pos = {4.f, 1.f};
+	core::collision_impl::checkBullets(fix.context);
+
+	auto const& colls = fix.collision_sender.data();
+	BOOST_REQUIRE_EQUAL(colls.size(), 1u);
+	BOOST_CHECK_EQUAL(colls[0].collider, leaving);
+	// expect all positions to be remembered
+	BOOST_CHECK_VECTOR_CLOSE(c_l.last_pos, sf::Vector2f(2.f, 1.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(c_o.last_pos, sf::Vector2f(3.f, 2.f), 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(bullet_hits_passed_objects_before_reaching_a_wall) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto& dungeon = fix.dungeon_system[1u];
+	dungeon.getTerrain({3u, 1u}) = core::Terrain::Wall;
+	auto bullet = fix.add_object({1u, 1u}, true);
+	auto object = fix.add_object({2u, 1u}, false);
+	auto& c_b = fix.collision_manager.query(bullet);
+	c_b.last_pos = {1.f, 1.f};
+	c_b.last_scene = 1u;
+	// bullet reached the wall before the next check
+	core::MoveEvent event;
+	event.actor = bullet;
+	event.source = {2u, 1u};
+	event.target = {3u, 1u};
+	event.type = core::MoveEvent::Reached;
+	auto& m_b = fix.movement_manager.query(bullet);
+	m_b.target = event.target;
+	m_b.pos = sf::Vector2f{event.target};
+	core::collision_impl::onTileReached(fix.context, c_b, event);
+
+	auto const& colls = fix.collision_sender.data();
+	BOOST_REQUIRE_EQUAL(colls.size(), 2u);
+	BOOST_CHECK_EQUAL(colls[0].collider, object);
+	BOOST_CHECK(!colls[0].reset);
+	BOOST_CHECK_EQUAL(colls[1].collider, 0u);
+	BOOST_CHECK(colls[1].reset);
+	// expect the next check not to hit the object again
+	fix.collision_sender.clear();
+	core::collision_impl::checkBullets(fix.context);
+	BOOST_CHECK(fix.collision_sender.data().empty());
+	dungeon.getTerrain({3u, 1u}) = core::Terrain::Floor;
+}
+
+BOOST_AUTO_TEST_CASE(bullet_sweep_is_clipped_at_walls) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto& dungeon = fix.dungeon_system[1u];
+	dungeon.getTerrain({3u, 1u}) = core::Terrain::Wall;
+	auto to = core::collision_impl::clipSweep(
+		dungeon, {1.f, 1.f}, {4.f, 1.f});
+	BOOST_CHECK_GE(to.x, 2.f);
+	BOOST_CHECK_LT(to.x, 2.5f);
+	BOOST_CHECK_CLOSE(to.y, 1.f, 0.0001f);
+
+	// cannot sweep out of a wall
+	to = core::collision_impl::clipSweep(dungeon, {3.f, 1.f}, {4.f, 1.f});
+	BOOST_CHECK_VECTOR_CLOSE(to, sf::Vector2f(3.f, 1.f), 0.0001f);
+	dungeon.getTerrain({3u, 1u}) = core::Terrain::Floor;
+}
+
+BOOST_AUTO_TEST_CASE(broadphase_only_tracks_regular_objects) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	fix.add_object({1u, 1u}, true);
+	auto object = fix.add_object({2u, 1u}, false);
+	BOOST_CHECK_EQUAL(fix.broadphase.size(), 1u);
+
+	std::vector<core::ObjectID> candidates;
+	fix.broadphase.query(
+		fix.dungeon_system[1u], {1.f, 1.f}, 1.f, candidates);
+	BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+	BOOST_CHECK_EQUAL(candidates[0], object);
+}
+
+BOOST_AUTO_TEST_CASE(broadphase_moves_object_between_buckets) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto object = fix.add_object({1u, 1u}, false);
+	// move object into another bucket
+	auto& m_o = fix.movement_manager.query(object);
+	m_o.pos = {4.f, 5.f};
+	core::collision_impl::syncBroadphase(fix.context, object);
+
+	std::vector<core::ObjectID> candidates;
+	fix.broadphase.query(
+		fix.dungeon_system[1u], {1.f, 1.f}, 1.f, candidates);
+	BOOST_CHECK(candidates.empty());
+	fix.broadphase.query(
+		fix.dungeon_system[1u], {4.f, 4.5f}, 1.f, candidates);
+	BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+	BOOST_CHECK_EQUAL(candidates[0], object);
+}
+
+BOOST_AUTO_TEST_CASE(broadphase_drops_vanished_objects) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	fix.add_object({1u, 1u}, false);
+	auto object = fix.add_object({2u, 1u}, false);
+	BOOST_REQUIRE_EQUAL(fix.broadphase.size(), 2u);
+
+	auto& m_o = fix.movement_manager.query(object);
+	m_o.scene = 0u;
+	core::collision_impl::syncBroadphase(fix.context, object);
+	BOOST_CHECK_EQUAL(fix.broadphase.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(bullet_skips_stale_candidates_of_other_scenes) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto bullet = fix.add_object({1u, 1u}, true);
+	auto object = fix.add_object({2u, 1u}, false);
+	// object vanished without updating the broadphase
+	auto& m_o = fix.movement_manager.query(object);
+	m_o.scene = 0u;
+	std::vector<core::ObjectID> candidates, objects;
+	core::collision_impl::queryBullet(fix.context,
+		fix.collision_manager.query(bullet), candidates, objects);
+	BOOST_CHECK(objects.empty());
+}
+
+BOOST_AUTO_TEST_CASE(syncing_spawned_object_adds_it_to_broadphase) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto first = fix.add_object({1u, 1u}, false);
+	fix.broadphase.remove(first);
+	auto second = fix.add_object({2u, 1u}, false);
+	fix.broadphase.remove(second);
+	core::collision_impl::syncBroadphase(fix.context, second);
+	std::vector<core::ObjectID> candidates;
+	fix.broadphase.query(
+		fix.dungeon_system[1u], {1.f, 1.f}, 1.f, candidates);
+	BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+	BOOST_CHECK_EQUAL(candidates[0], second);
+}
+
+BOOST_AUTO_TEST_CASE(touching_scene_of_placed_object_modifies_its_dungeon) {
+	auto& fix = Singleton<CollisionFixture>::get();
+	fix.reset();
+
+	auto object = fix.add_object({1u, 1u}, false);
+	auto& dungeon = fix.dungeon_system[1u];
+	auto revision = dungeon.getRevision();
+	core::collision_impl::touchScene(fix.context, object);
+	BOOST_CHECK_NE(dungeon.getRevision(), revision);
+	// object left the scene
+	revision = dungeon.getRevision();
+	fix.movement_manager.query(object).scene = 0u;
+	core::collision_impl::touchScene(fix.context, object);
+	BOOST_CHECK_EQUAL(dungeon.getRevision(), revision);
+}
+
 // ---------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(leaving_tile_is_not_forwarded_if_a_collision_happened) {
@@ -498,7 +762,7 @@ BOOST_AUTO_TEST_CASE(reaching_tile_is_not_forwarded_if_a_collision_happened) {
 	m_a.target = event.target;
 	m_a.pos = sf::Vector2f{event.target};
 	// propagate movement
-	auto const& f_a = fix.collision_manager.query(actor);
+	auto& f_a = fix.collision_manager.query(actor);
 	core::collision_impl::onTileReached(fix.context, f_a, event);
 	// expect collision event
 	auto const& colls = fix.collision_sender.data();
@@ -523,7 +787,7 @@ BOOST_AUTO_TEST_CASE(reaching_tile_is_forwarded_if_a_no_collision_happened) {
 	m_a.target = event.target;
 	m_a.pos = sf::Vector2f{event.target};
 	// propagate movement
-	auto const& f_a = fix.collision_manager.query(actor);
+	auto& f_a = fix.collision_manager.query(actor);
 	core::collision_impl::onTileReached(fix.context, f_a, event);
 	// expect no collision event
 	auto const& colls = fix.collision_sender.data();
@@ -0,0 +1,129 @@
+#include <boost/test/unit_test.hpp>
+#include <testsuite/sfml_system.hpp>
+
+#include <core/dungeon.hpp>
+
+namespace dungeon_test {
+
+void prepare(core::Dungeon& dungeon, sf::Texture const & texture) {
+	auto size = dungeon.getSize();
+	sf::Vector2u tile_size{32u, 32u};
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < size.y; ++pos.y) {
+		for (pos.x = 0u; pos.x < size.x; ++pos.x) {
+			dungeon.getTerrain(pos) = core::Terrain::Floor;
+			dungeon.getColdCell(pos).tile.refresh(pos, tile_size,
+				{pos.x % 3u, pos.y % 2u}, tile_size,
+				(pos.x + pos.y) % 16u, pos.x == 2u);
+			if (pos.y == 3u) {
+				// semi-transparent like corridors
+				for (auto& v: dungeon.getColdCell(pos).tile.vertices) {
+					v.color.a = 200u;
+				}
+			}
+		}
+	}
+	sf::Sprite sprite{texture};
+	sprite.setPosition(12.f, 7.f);
+	sprite.setOrigin(3.f, 4.f);
+	sprite.setRotation(45.f);
+	sprite.setColor(sf::Color::Red);
+	dungeon.getColdCell({3u, 2u}).ambiences.push_back(sprite);
+}
+
+void checkEqual(core::RenderCell const & lhs, core::RenderCell const & rhs) {
+	BOOST_REQUIRE_EQUAL(lhs.tile.vertices.size(), rhs.tile.vertices.size());
+	for (auto i = 0u; i < lhs.tile.vertices.size(); ++i) {
+		auto const & u = lhs.tile.vertices[i];
+		auto const & v = rhs.tile.vertices[i];
+		BOOST_CHECK_VECTOR_EQUAL(u.position, v.position);
+		BOOST_CHECK_VECTOR_EQUAL(u.texCoords, v.texCoords);
+		BOOST_CHECK(u.color == v.color);
+	}
+	BOOST_CHECK_EQUAL(lhs.tile.edges.size(), rhs.tile.edges.size());
+	BOOST_REQUIRE_EQUAL(lhs.ambiences.size(), rhs.ambiences.size());
+	for (auto i = 0u; i < lhs.ambiences.size(); ++i) {
+		auto const & u = lhs.ambiences[i];
+		auto const & v = rhs.ambiences[i];
+		BOOST_CHECK(u.getTexture() == v.getTexture());
+		BOOST_CHECK_VECTOR_EQUAL(u.getPosition(), v.getPosition());
+		BOOST_CHECK_VECTOR_EQUAL(u.getOrigin(), v.getOrigin());
+		BOOST_CHECK_CLOSE(u.getRotation(), v.getRotation(), 0.0001f);
+		BOOST_CHECK(u.getColor() == v.getColor());
+	}
+}
+
+}  // ::dungeon_test
+
+BOOST_AUTO_TEST_SUITE(dungeon_test)
+
+BOOST_AUTO_TEST_CASE(snapshot_rebuilds_render_cells) {
+	sf::Texture tileset, ambience;
+	core::Dungeon original{1u, tileset, sf::Vector2u{6u, 5u},
+		sf::Vector2f{32.f, 32.f}};
+	core::Dungeon copy{2u, tileset, sf::Vector2u{6u, 5u},
+		sf::Vector2f{32.f, 32.f}};
+	dungeon_test::prepare(original, ambience);
+
+	core::RenderSnapshot snapshot;
+	core::dungeon_impl::takeSnapshot(original, snapshot);
+	BOOST_CHECK_EQUAL(snapshot.tiles.size(), 30u);
+	BOOST_CHECK_EQUAL(snapshot.ambiences.size(), 1u);
+	core::dungeon_impl::applySnapshot(copy, snapshot);
+
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < 5u; ++pos.y) {
+		for (pos.x = 0u; pos.x < 6u; ++pos.x) {
+			dungeon_test::checkEqual(
+				original.getColdCell(pos), copy.getColdCell(pos));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(evicted_dungeon_keeps_simulation_cells) {
+	sf::Texture tileset, ambience;
+	core::DungeonSystem system;
+	auto id = system.create(tileset, sf::Vector2u{6u, 5u},
+		sf::Vector2f{32.f, 32.f});
+	dungeon_test::prepare(system[id], ambience);
+	system[id].getTerrain({4u, 3u}) = core::Terrain::Wall;
+	BOOST_CHECK(system.isResident(id));
+	BOOST_CHECK_EQUAL(system.getSnapshotMemory(), 0u);
+
+	system.evict(id);
+	BOOST_CHECK(!system.isResident(id));
+	BOOST_CHECK(!system[id].hasColdCells());
+	BOOST_CHECK(system.getSnapshotMemory() > 0u);
+	BOOST_CHECK(system[id].getTerrain({4u, 3u}) == core::Terrain::Wall);
+	BOOST_CHECK(system[id].getTerrain({1u, 1u}) == core::Terrain::Floor);
+
+	// evicting twice does not overwrite the snapshot
+	system.evict(id);
+	system.restore(id);
+	BOOST_CHECK(system.isResident(id));
+	BOOST_CHECK_EQUAL(system.getSnapshotMemory(), 0u);
+	BOOST_CHECK_EQUAL(system[id].getColdCell({3u, 2u}).ambiences.size(), 1u);
+	BOOST_CHECK(!system[id].getColdCell({2u, 1u}).tile.edges.empty());
+	BOOST_CHECK_EQUAL(system[id].getColdCell({1u, 1u}).tile.getShading(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(ambiences_can_be_added_to_evicted_dungeon) {
+	sf::Texture tileset, ambience;
+	core::DungeonSystem system;
+	auto id = system.create(tileset, sf::Vector2u{6u, 5u},
+		sf::Vector2f{32.f, 32.f});
+	dungeon_test::prepare(system[id], ambience);
+	system.evict(id);
+
+	sf::Sprite sprite{ambience};
+	sprite.setPosition(100.f, 50.f);
+	system.addAmbience(id, {1u, 4u}, sprite);
+	system.restore(id);
+
+	auto const & ambiences = system[id].getColdCell({1u, 4u}).ambiences;
+	BOOST_REQUIRE_EQUAL(ambiences.size(), 1u);
+	BOOST_CHECK_VECTOR_EQUAL(ambiences[0].getPosition(),
+		sf::Vector2f(100.f, 50.f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
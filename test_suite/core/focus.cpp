@@ -16,6 +16,7 @@ struct FocusFixture {
 	core::FocusManager focus_manager;
 	core::DungeonSystem dungeon_system;
 	core::MovementManager movement_manager;
+	core::focus_impl::SightIndex sight_index;
 	core::focus_impl::Context context;
 
 	FocusFixture()
@@ -26,8 +27,9 @@ struct FocusFixture {
 		, focus_manager{}
 		, dungeon_system{}
 		, movement_manager{}
+		, sight_index{}
 		, context{log, focus_sender, focus_manager, dungeon_system,
-			  movement_manager} {
+			  movement_manager, sight_index} {
 		// add a scenes
 		auto scene = dungeon_system.create(
 			dummy_tileset, sf::Vector2u{12u, 10u}, sf::Vector2f{1.f, 1.f});
@@ -35,7 +37,7 @@ struct FocusFixture {
 		auto& dungeon = dungeon_system[1u];
 		for (auto y = 1u; y < 10u; ++y) {
 			for (auto x = 1u; x < 12u; ++x) {
-				dungeon.getCell({x, y}).terrain = core::Terrain::Floor;
+				dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 			}
 		}
 	}
@@ -45,9 +47,8 @@ struct FocusFixture {
 		// clear dungeon
 		for (auto y = 0u; y < 10u; ++y) {
 			for (auto x = 0u; x < 12u; ++x) {
-				auto& cell = dungeon.getCell({x, y});
-				cell.entities.clear();
-				cell.terrain = core::Terrain::Floor;
+				dungeon.getCell({x, y}).entities.clear();
+				dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 			}
 		}
 		// remove components
@@ -60,6 +61,7 @@ struct FocusFixture {
 		id_manager.reset();
 		focus_manager.cleanup();
 		movement_manager.cleanup();
+		sight_index.prune(focus_manager);
 		// reset event senders
 		focus_sender.clear();
 	}
@@ -147,7 +149,7 @@ BOOST_AUTO_TEST_CASE(traversal_pass_walls) {
 	auto const& dungeon = fixture.dungeon_system[1];
 	auto id = fixture.add_object({1u, 1u}, {1, 0}, 5.f);
 	fixture.add_object({3u, 1u}, {0, 1}, 5.f);
-	fixture.dungeon_system[1u].getCell({2u, 1u}).terrain = core::Terrain::Wall;
+	fixture.dungeon_system[1u].getTerrain({2u, 1u}) = core::Terrain::Wall;
 
 	auto found = core::focus_impl::traverseCells(dungeon, {1u, 1u}, {1, 0}, 5.f,
 		[&](core::ObjectID other, int) { return other != id; });
@@ -220,6 +222,130 @@ BOOST_AUTO_TEST_CASE(traversal_finds_object_on_diagonal) {
 	BOOST_CHECK_EQUAL(found, second);
 }
 
+BOOST_AUTO_TEST_CASE(sight_index_only_lists_object_at_its_lanes) {
+	auto& fixture = Singleton<FocusFixture>::get();
+	fixture.reset();
+
+	auto const& dungeon = fixture.dungeon_system[1];
+	auto id = fixture.add_object({2u, 3u}, {1, 0}, 5.f);
+	auto event = fixture.move_object(id, {4u, 3u}, {1, 0});
+	core::focus_impl::onMove(
+		fixture.context, fixture.focus_manager.query(id), event);
+
+	unsigned int coord;
+	auto row = fixture.sight_index.getLane(dungeon, {0u, 3u}, {1, 0}, coord);
+	BOOST_REQUIRE(row != nullptr);
+	BOOST_REQUIRE_EQUAL(row->size(), 1u);
+	BOOST_CHECK_EQUAL(row->front().first, 4u);
+	BOOST_CHECK_EQUAL(row->front().second, id);
+	auto old_column =
+		fixture.sight_index.getLane(dungeon, {2u, 0u}, {0, 1}, coord);
+	BOOST_REQUIRE(old_column != nullptr);
+	BOOST_CHECK(old_column->empty());
+	auto new_column =
+		fixture.sight_index.getLane(dungeon, {4u, 0u}, {0, 1}, coord);
+	BOOST_REQUIRE(new_column != nullptr);
+	BOOST_CHECK_EQUAL(new_column->size(), 1u);
+	auto diagonal =
+		fixture.sight_index.getLane(dungeon, {5u, 4u}, {-1, -1}, coord);
+	BOOST_REQUIRE(diagonal != nullptr);
+	BOOST_CHECK_EQUAL(coord, 5u);
+	BOOST_CHECK_EQUAL(diagonal->size(), 1u);
+	auto anti_diagonal =
+		fixture.sight_index.getLane(dungeon, {6u, 1u}, {-1, 1}, coord);
+	BOOST_REQUIRE(anti_diagonal != nullptr);
+	BOOST_CHECK_EQUAL(anti_diagonal->size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(lane_traversal_equals_cell_traversal) {
+	auto& fixture = Singleton<FocusFixture>::get();
+	fixture.reset();
+
+	auto const& dungeon = fixture.dungeon_system[1];
+	auto id = fixture.add_object({5u, 5u}, {1, 0}, 5.f);
+	fixture.add_object({5u, 5u}, {0, 1}, 0.f);
+	fixture.add_object({8u, 5u}, {0, 1}, 5.f);
+	fixture.add_object({9u, 5u}, {0, 1}, 5.f);
+	fixture.add_object({2u, 5u}, {0, 1}, 5.f);
+	fixture.add_object({5u, 1u}, {0, 1}, 5.f);
+	fixture.add_object({7u, 7u}, {0, 1}, 5.f);
+	fixture.add_object({2u, 8u}, {0, 1}, 5.f);
+	fixture.add_object({8u, 2u}, {0, 1}, 5.f);
+	fixture.dungeon_system[1u].getTerrain({3u, 5u}) = core::Terrain::Wall;
+
+	auto handle = [&](core::ObjectID other, int) {
+		return other != id &&
+			   fixture.focus_manager.query(other).sight > 0.f;
+	};
+	sf::Vector2i dir;
+	for (dir.y = -1; dir.y <= 1; ++dir.y) {
+		for (dir.x = -1; dir.x <= 1; ++dir.x) {
+			if (dir.x == 0 && dir.y == 0) {
+				continue;
+			}
+			auto expected = core::focus_impl::traverseCells(
+				dungeon, {5u, 5u}, dir, 10.f, handle);
+			auto found = core::focus_impl::traverseLane(
+				dungeon, fixture.sight_index, {5u, 5u}, dir, 10.f, handle);
+			BOOST_CHECK_EQUAL(found, expected);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(lane_traversal_cannot_pass_walls) {
+	auto& fixture = Singleton<FocusFixture>::get();
+	fixture.reset();
+
+	auto const& dungeon = fixture.dungeon_system[1];
+	auto id = fixture.add_object({1u, 1u}, {1, 0}, 5.f);
+	fixture.add_object({3u, 1u}, {0, 1}, 5.f);
+	fixture.dungeon_system[1u].getTerrain({2u, 1u}) = core::Terrain::Wall;
+
+	auto found = core::focus_impl::traverseLane(dungeon, fixture.sight_index,
+		{1u, 1u}, {1, 0}, 5.f,
+		[&](core::ObjectID other, int) { return other != id; });
+	BOOST_CHECK_EQUAL(found, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(pruning_sight_index_drops_released_objects) {
+	auto& fixture = Singleton<FocusFixture>::get();
+	fixture.reset();
+
+	fixture.add_object({1u, 1u}, {1, 0}, 5.f);
+	auto second = fixture.add_object({3u, 1u}, {0, 1}, 5.f);
+	BOOST_REQUIRE_EQUAL(fixture.sight_index.size(), 2u);
+
+	fixture.focus_manager.release(second);
+	fixture.focus_manager.cleanup();
+	fixture.sight_index.prune(fixture.focus_manager);
+	BOOST_CHECK_EQUAL(fixture.sight_index.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(spawned_objects_are_indexed_without_move_event) {
+	auto& fixture = Singleton<FocusFixture>::get();
+	fixture.reset();
+
+	auto const& dungeon = fixture.dungeon_system[1];
+	fixture.add_object({1u, 1u}, {1, 0}, 5.f);
+	// spawn object silently
+	auto id = fixture.id_manager.acquire();
+	fixture.ids.push_back(id);
+	fixture.focus_manager.acquire(id);
+	auto& mve = fixture.movement_manager.acquire(id);
+	mve.pos = {2.f, 4.f};
+	mve.target = {2u, 4u};
+	mve.scene = 1u;
+	fixture.dungeon_system[1u].getCell({2u, 4u}).entities.push_back(id);
+	core::focus_impl::syncIndex(fixture.context, id);
+	BOOST_CHECK_EQUAL(fixture.sight_index.size(), 2u);
+
+	unsigned int coord;
+	auto row = fixture.sight_index.getLane(dungeon, {0u, 4u}, {1, 0}, coord);
+	BOOST_REQUIRE(row != nullptr);
+	BOOST_REQUIRE_EQUAL(row->size(), 1u);
+	BOOST_CHECK_EQUAL(row->front().second, id);
+}
+
 // ---------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(trigger_looking_sets_dirtyflag) {
@@ -24,6 +24,23 @@ struct DemoTrigger: core::BaseTrigger {
 	}
 };
 
+struct RecordTrigger: core::BaseTrigger {
+	std::vector<core::ObjectID> actors;
+	
+	RecordTrigger()
+		: core::BaseTrigger{}
+		, actors{} {
+	}
+	
+	void execute(core::ObjectID actor) override {
+		actors.push_back(actor);
+	}
+	
+	bool isExpired() const override {
+		return false;
+	}
+};
+
 struct MovementFixture {
 	sf::Texture dummy_tileset;
 	core::IdManager id_manager;
@@ -53,9 +70,9 @@ struct MovementFixture {
 		for (auto y = 0u; y < 10u; ++y) {
 			for (auto x = 0u; x < 12u; ++x) {
 				if (x == 0u || x == 11u || y == 0u || y == 9u) {
-					dungeon.getCell({x, y}).terrain = core::Terrain::Wall;
+					dungeon.getTerrain({x, y}) = core::Terrain::Wall;
 				} else {
-					dungeon.getCell({x, y}).terrain = core::Terrain::Floor;
+					dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 				}
 			}
 		}
@@ -684,4 +701,123 @@ BOOST_AUTO_TEST_CASE(reaching_tile_executes_and_expires_trigger) {
 	BOOST_CHECK(trigger == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_update_equals_sequential_update) {
+	auto& fix = Singleton<MovementFixture>::get();
+	fix.reset();
+
+	struct Run {
+		core::MoveSender move_sender;
+		core::MovementManager movement_manager;
+		core::movement_impl::Context context;
+
+		Run(MovementFixture& fix)
+			: move_sender{}
+			, movement_manager{1000u}
+			, context{fix.log, move_sender, movement_manager, fix.dungeon_system} {
+			for (core::ObjectID id = 1u; id <= 1000u; ++id) {
+				auto& data = movement_manager.acquire(id);
+				sf::Vector2u pos{1u + id % 5u, 1u + id % 8u};
+				data.pos = sf::Vector2f{pos};
+				data.target = pos;
+				data.max_speed = 100.f;
+				data.scene = 1u;
+				if (id % 3u != 0u) {
+					data.next_move = {1, 0};
+				}
+			}
+		}
+	};
+	auto& cell = fix.dungeon_system[1u].getCell({4u, 2u});
+	auto frametime = sf::milliseconds(core::MAX_FRAMETIME_MS);
+
+	// update sequentially
+	Run sequential{fix};
+	auto seq_trigger = std::make_unique<RecordTrigger>();
+	auto const& seq_actors = seq_trigger->actors;
+	cell.trigger = std::move(seq_trigger);
+	for (auto i = 0u; i < 10u; ++i) {
+		core::movement_impl::updateRange(sequential.context,
+			sequential.movement_manager.begin(),
+			sequential.movement_manager.end(), frametime);
+	}
+	auto expected_actors = seq_actors;
+
+	// update in parallel
+	Run parallel{fix};
+	auto par_trigger = std::make_unique<RecordTrigger>();
+	auto const& par_actors = par_trigger->actors;
+	cell.trigger = std::move(par_trigger);
+	utils::JobSystem jobs{3u};
+	core::movement_impl::ParallelBuffers buffers;
+	for (auto i = 0u; i < 10u; ++i) {
+		core::movement_impl::updateParallel(parallel.context, jobs, buffers,
+			parallel.movement_manager.begin(),
+			parallel.movement_manager.end(), frametime);
+	}
+	BOOST_CHECK_EQUAL(buffers.chunks.size(), 4u);
+	BOOST_CHECK_EQUAL(buffers.events.getNumProducers(), 4u);
+
+	// compare results
+	BOOST_REQUIRE(!expected_actors.empty());
+	BOOST_CHECK(expected_actors == par_actors);
+	auto const& expected = sequential.move_sender.data();
+	auto const& actual = parallel.move_sender.data();
+	BOOST_REQUIRE(!expected.empty());
+	BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+	for (auto i = 0u; i < expected.size(); ++i) {
+		BOOST_CHECK_EQUAL(expected[i].actor, actual[i].actor);
+		BOOST_CHECK(expected[i].type == actual[i].type);
+		BOOST_CHECK_VECTOR_EQUAL(expected[i].source, actual[i].source);
+		BOOST_CHECK_VECTOR_EQUAL(expected[i].target, actual[i].target);
+	}
+	for (core::ObjectID id = 1u; id <= 1000u; ++id) {
+		auto const& lhs = sequential.movement_manager.query(id);
+		auto const& rhs = parallel.movement_manager.query(id);
+		BOOST_CHECK_VECTOR_CLOSE(lhs.pos, rhs.pos, 0.0001f);
+		BOOST_CHECK_VECTOR_EQUAL(lhs.target, rhs.target);
+	}
+
+	cell.trigger = nullptr;
+}
+
+BOOST_AUTO_TEST_CASE(predicted_position_matches_interpolation) {
+	auto& fix = Singleton<MovementFixture>::get();
+	fix.reset();
+
+	auto id = fix.add_object({5u, 1u}, 5.f);
+	auto& data = fix.movement_manager.query(id);
+
+	// trigger movement
+	auto event = fix.move_object(id, {-1, 1});
+	core::movement_impl::start(fix.context, data, event);
+	fix.update(sf::milliseconds(10));
+
+	// predict without modifying the component
+	auto pos = data.pos;
+	auto predicted = core::movement_impl::predictPosition(
+		data, sf::milliseconds(20));
+	BOOST_CHECK_VECTOR_CLOSE(data.pos, pos, 0.0001f);
+
+	// trigger interpolation
+	fix.update(sf::milliseconds(20));
+	BOOST_CHECK_VECTOR_CLOSE(predicted, data.pos, 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(predicted_position_does_not_exceed_target) {
+	auto& fix = Singleton<MovementFixture>::get();
+	fix.reset();
+
+	auto id = fix.add_object({5u, 1u}, 5.f);
+	auto& data = fix.movement_manager.query(id);
+
+	// trigger movement
+	auto event = fix.move_object(id, {1, 0});
+	core::movement_impl::start(fix.context, data, event);
+	fix.update(sf::milliseconds(10));
+
+	auto predicted = core::movement_impl::predictPosition(
+		data, sf::seconds(5.f));
+	BOOST_CHECK_VECTOR_CLOSE(predicted, sf::Vector2f(6.f, 1.f), 0.0001f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
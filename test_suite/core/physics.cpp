@@ -56,9 +56,9 @@ struct PhysicsFixture {
 		for (auto y = 0u; y < 10u; ++y) {
 			for (auto x = 0u; x < 12u; ++x) {
 				if (x == 0u || x == 11u || y == 0u || y == 9u) {
-					dungeon.getCell({x, y}).terrain = core::Terrain::Wall;
+					dungeon.getTerrain({x, y}) = core::Terrain::Wall;
 				} else {
-					dungeon.getCell({x, y}).terrain = core::Terrain::Floor;
+					dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 				}
 			}
 		}
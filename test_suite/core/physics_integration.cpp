@@ -63,12 +63,12 @@ struct PhysicsFixture
 		auto& d = dungeon[scene];
 		for (auto y = 0u; y < grid_size.y; ++y) {
 			for (auto x = 0u; x < grid_size.x; ++x) {
-				auto& cell = d.getCell({x, y});
+				auto& terrain = d.getTerrain({x, y});
 				if (x == 0u || x == grid_size.x - 1u || y == 0u ||
 					y == grid_size.y - 1u) {
-					cell.terrain = core::Terrain::Wall;
+					terrain = core::Terrain::Wall;
 				} else {
-					cell.terrain = core::Terrain::Floor;
+					terrain = core::Terrain::Floor;
 				}
 			}
 		}
@@ -966,6 +966,29 @@ BOOST_AUTO_TEST_CASE(object_is_stopped_after_teleport) {
 	BOOST_CHECK_VECTOR_CLOSE(move_data.target, sf::Vector2f(3.f, 5.f), 0.0001f);
 }
 
+BOOST_AUTO_TEST_CASE(bullet_collides_with_teleported_object) {
+	auto& fix = Singleton<PhysicsFixture>::get();
+	fix.reset();
+
+	// create teleport trigger
+	fix.addTeleport(1u, {4u, 1u}, 1u, {3u, 5u});
+
+	auto mover = fix.add_object(fix.scene, {1u, 1u}, {1, 0}, 1.f, 5.f);
+	fix.move_object(mover, {1, 0}, {-1, 1});
+	fix.update(sf::seconds(16.f));
+	BOOST_REQUIRE_EQUAL(fix.teleports.size(), 1u);
+	fix.collisions.clear();
+
+	// shoot at the object's new position
+	auto bullet = fix.add_bullet(fix.scene, {5u, 5u}, {-1, 0}, 1.f, 5.f);
+	fix.update(sf::seconds(6.f));
+
+	auto const& colls = fix.collisions;
+	BOOST_REQUIRE_EQUAL(colls.size(), 1u);
+	BOOST_CHECK_EQUAL(colls[0].actor, bullet);
+	BOOST_CHECK_EQUAL(colls[0].collider, mover);
+}
+
 BOOST_AUTO_TEST_CASE(bullet_is_not_effected_by_teleport) {
 	auto& fix = Singleton<PhysicsFixture>::get();
 	fix.reset();
@@ -45,9 +45,8 @@ struct RenderFixture {
 		auto& dungeon = dungeon_system[1u];
 		for (auto y = 0u; y < map_size.y; ++y) {
 			for (auto x = 0u; x < map_size.x; ++x) {
-				auto& cell = dungeon.getCell({x, y});
-				cell.terrain = core::Terrain::Floor;
-				cell.tile.refresh(sf::Vector2u(x, y), {32u, 32u}, {},
+				dungeon.getTerrain({x, y}) = core::Terrain::Floor;
+				dungeon.getColdCell({x, y}).tile.refresh(sf::Vector2u(x, y), {32u, 32u}, {},
 					{64u, 64u}, utils::ShadeTopLeft, true);
 			}
 		}
@@ -107,7 +106,12 @@ struct RenderFixture {
 		sf::Vector2u const& pos, sf::Vector2i const& look) {
 		auto id = id_manager.acquire();
 		ids.push_back(id);
-		render_manager.acquire(id);
+		auto& render_data = render_manager.acquire(id);
+		// occupy base layers to make the object visible
+		render_data.legs[core::SpriteLegLayer::Base].setTexture(dummy_texture);
+		render_data.legs[core::SpriteLegLayer::Base].setTextureRect({0, 0, 10, 5});
+		render_data.torso[core::SpriteTorsoLayer::Base].setTexture(dummy_texture);
+		render_data.torso[core::SpriteTorsoLayer::Base].setTextureRect({0, 5, 10, 5});
 		auto& move_data = movement_manager.acquire(id);
 		move_data.pos = sf::Vector2f{pos};
 		move_data.scene = 1u;
@@ -129,9 +133,9 @@ struct RenderFixture {
 
 BOOST_AUTO_TEST_SUITE(render_test)
 
-BOOST_AUTO_TEST_CASE(culling_buffer_draws_quads_per_tile) {
-	core::render_impl::CullingBuffer buffer;
-	for (auto const& pair : buffer.terrain) {
+BOOST_AUTO_TEST_CASE(terrain_chunk_draws_quads_per_tile) {
+	core::TerrainChunk chunk;
+	for (auto const& pair : chunk.terrain) {
 		BOOST_REQUIRE(pair.second.getPrimitiveType() == sf::Triangles);
 	}
 }
@@ -540,11 +544,11 @@ BOOST_AUTO_TEST_CASE(culling_makes_buffer_contain_all_visible_ambiences) {
 	auto a = fix.add_object({15u, 12u}, {0, 1});
 	fix.add_object({50u, 19u}, {0, 1});
 	auto& dungeon = fix.dungeon_system[1];
-	auto& cell1 = dungeon.getCell({50u, 19u});
+	auto& cell1 = dungeon.getColdCell({50u, 19u});
 	cell1.ambiences.emplace_back();
-	auto& cell2 = dungeon.getCell({12u, 13u});
+	auto& cell2 = dungeon.getColdCell({12u, 13u});
 	cell2.ambiences.emplace_back();
-	auto& cell3 = dungeon.getCell({15u, 13u});
+	auto& cell3 = dungeon.getColdCell({15u, 13u});
 	cell3.ambiences.emplace_back();
 	// prepare camera
 	fix.context.buffers.resize(1);
@@ -689,6 +693,7 @@ BOOST_AUTO_TEST_CASE(
 	auto id = fix.add_object({}, {0, 1});
 	auto& render_data = fix.render_manager.query(id);
 	render_data.light = std::make_unique<utils::Light>();
+	render_data.light->cast_shadow = true;
 	auto& dungeon = fix.dungeon_system[1];
 	// prepare camera
 	fix.context.buffers.resize(1);
@@ -702,6 +707,157 @@ BOOST_AUTO_TEST_CASE(
 	BOOST_CHECK(!fix.context.buffers[0].lights.empty());
 }
 
+BOOST_AUTO_TEST_CASE(culling_passes_only_edges_within_the_light_range) {
+	auto& fix = Singleton<RenderFixture>::get();
+	fix.reset();
+
+	fix.lighting_system.setLevelOfDetails(1u);
+	fix.context.stats = core::render_impl::Stats{};
+	// prepare scene
+	auto a = fix.add_object({}, {0, 1});
+	auto b = fix.add_object({1u, 0u}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	auto& light_a = fix.render_manager.query(a).light;
+	light_a = std::make_unique<utils::Light>();
+	light_a->pos = dungeon.toScreen({0.f, 0.f});
+	light_a->cast_shadow = true;
+	auto& light_b = fix.render_manager.query(b).light;
+	light_b = std::make_unique<utils::Light>();
+	light_b->pos = dungeon.toScreen({1.f, 0.f});
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({0.f, 0.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	// shadows of light a are limited to 3x3 cells, light b has no shadows
+	// note: the tiles' 36 edges are merged to 4 horizontal and 4 vertical
+	auto const & buffer = fix.context.buffers[0];
+	BOOST_REQUIRE_EQUAL(buffer.lights.size(), 2u);
+	BOOST_REQUIRE_EQUAL(buffer.shadows.size(), 2u);
+	BOOST_CHECK_EQUAL(buffer.edges.size(), 8u);
+	BOOST_CHECK_EQUAL(buffer.edge_indices.size(), 8u);
+	BOOST_CHECK_EQUAL(buffer.shadows[0].first, 0u);
+	BOOST_CHECK_EQUAL(buffer.shadows[0].last, 8u);
+	BOOST_CHECK_EQUAL(buffer.shadows[1].first, 8u);
+	BOOST_CHECK_EQUAL(buffer.shadows[1].last, 8u);
+	BOOST_CHECK_EQUAL(fix.context.stats.edges, 8u);
+	BOOST_CHECK_EQUAL(fix.context.stats.light_edges, 8u);
+	BOOST_CHECK_EQUAL(fix.context.stats.lights, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(culling_shares_merged_edges_between_overlapping_lights) {
+	auto& fix = Singleton<RenderFixture>::get();
+	fix.reset();
+
+	fix.lighting_system.setLevelOfDetails(1u);
+	fix.context.stats = core::render_impl::Stats{};
+	// prepare scene
+	auto a = fix.add_object({}, {0, 1});
+	auto b = fix.add_object({1u, 0u}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	auto& light_a = fix.render_manager.query(a).light;
+	light_a = std::make_unique<utils::Light>();
+	light_a->pos = dungeon.toScreen({0.f, 0.f});
+	light_a->cast_shadow = true;
+	auto& light_b = fix.render_manager.query(b).light;
+	light_b = std::make_unique<utils::Light>();
+	light_b->pos = dungeon.toScreen({1.f, 0.f});
+	light_b->cast_shadow = true;
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({0.f, 0.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	// both lights cover 4x3 cells: 4 horizontal and 5 vertical edges
+	auto const & buffer = fix.context.buffers[0];
+	BOOST_REQUIRE_EQUAL(buffer.shadows.size(), 2u);
+	BOOST_REQUIRE_EQUAL(buffer.edges.size(), 9u);
+	// each light refers to the shared edges near it
+	auto const & range_a = buffer.shadows[0];
+	auto const & range_b = buffer.shadows[1];
+	BOOST_CHECK_EQUAL(range_a.last - range_a.first, 8u);
+	BOOST_CHECK_EQUAL(range_b.last - range_b.first, 9u);
+	BOOST_CHECK_EQUAL(range_b.first, range_a.last);
+	for (auto i = range_a.first; i < range_a.last; ++i) {
+		auto const & edge = buffer.edges[buffer.edge_indices[i]];
+		// the vertical edge at the far right is out of light a's range
+		BOOST_CHECK_LT(std::min(edge.u.x, edge.v.x), 112.f);
+	}
+	BOOST_CHECK_EQUAL(fix.context.stats.edges, 9u);
+	BOOST_CHECK_EQUAL(fix.context.stats.light_edges, 17u);
+}
+
+BOOST_AUTO_TEST_CASE(culling_keeps_non_casting_lights_without_edges) {
+	auto& fix = Singleton<RenderFixture>::get();
+	fix.reset();
+
+	fix.lighting_system.setLevelOfDetails(1u);
+	// prepare scene lit by a torch only
+	auto id = fix.add_object({}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	auto& light = fix.render_manager.query(id).light;
+	light = std::make_unique<utils::Light>();
+	light->pos = dungeon.toScreen({0.f, 0.f});
+	light->cast_shadow = false;
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(id);
+	cam.scene.setCenter(dungeon.toScreen({0.f, 0.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	// the light still darkens its surrounding via the shadow map
+	auto const & buffer = fix.context.buffers[0];
+	BOOST_CHECK(buffer.edges.empty());
+	BOOST_CHECK(buffer.edge_indices.empty());
+	BOOST_REQUIRE_EQUAL(buffer.lights.size(), 1u);
+	BOOST_REQUIRE_EQUAL(buffer.shadows.size(), 1u);
+	BOOST_CHECK_EQUAL(buffer.shadows[0].first, buffer.shadows[0].last);
+	BOOST_CHECK(utils::lighting_impl::needsShadowMap(
+		buffer.lights, fix.lighting_system.getLevelOfDetails()));
+}
+
+BOOST_AUTO_TEST_CASE(culling_discards_lights_which_do_not_influence_the_view) {
+	auto& fix = Singleton<RenderFixture>::get();
+	fix.reset();
+
+	fix.lighting_system.setLevelOfDetails(1u);
+	fix.context.stats = core::render_impl::Stats{};
+	// prepare scene
+	auto a = fix.add_object({}, {0, 1});
+	auto b = fix.add_object({5u, 5u}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	auto& light = fix.render_manager.query(b).light;
+	light = std::make_unique<utils::Light>();
+	light->pos = dungeon.toScreen({5.f, 5.f});
+	light->cast_shadow = true;
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({0.f, 0.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	BOOST_CHECK(fix.context.buffers[0].lights.empty());
+	BOOST_CHECK(fix.context.buffers[0].edges.empty());
+	BOOST_CHECK_EQUAL(fix.context.stats.discarded, 1u);
+
+	// a larger light reaches the view
+	light->radius = 3.f;
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	BOOST_CHECK_EQUAL(fix.context.buffers[0].lights.size(), 1u);
+	BOOST_CHECK(!fix.context.buffers[0].edges.empty());
+}
+
 BOOST_AUTO_TEST_CASE(
 	culling_neither_contains_edges_nor_lights_borders_if_lighting_details_equal_zero) {
 	auto& fix = Singleton<RenderFixture>::get();
@@ -749,6 +905,94 @@ BOOST_AUTO_TEST_CASE(culling_can_handle_multiple_scenes_via_multiple_buffers) {
 	BOOST_CHECK(obj1 != obj2);
 }
 
+BOOST_AUTO_TEST_CASE(culling_rejects_objects_which_are_not_visible) {
+	RenderFixture fix{{60u, 20u}};
+	// prepare scene
+	auto a = fix.add_object({15u, 12u}, {0, 1});
+	auto b = fix.add_object({14u, 12u}, {0, 1});
+	auto c = fix.add_object({16u, 12u}, {0, 1});
+	auto d = fix.add_object({15u, 11u}, {0, 1});
+	for (auto id: {b, c, d}) {
+		// keep sprites as they are
+		fix.animation_manager.query(id).has_changed = false;
+	}
+	// b has no occupied layers
+	auto& b_data = fix.render_manager.query(b);
+	b_data.legs[core::SpriteLegLayer::Base].setTextureRect({});
+	b_data.torso[core::SpriteTorsoLayer::Base].setTextureRect({});
+	// c is fully transparent
+	auto& c_data = fix.render_manager.query(c);
+	c_data.legs[core::SpriteLegLayer::Base].setColor(sf::Color::Transparent);
+	c_data.torso[core::SpriteTorsoLayer::Base].setColor(sf::Color::Transparent);
+	// d is drawn outside the view
+	fix.movement_manager.query(d).has_changed = false;
+	auto& dungeon = fix.dungeon_system[1];
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({15.f, 12.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	// expect only a to be culled
+	auto const& objects =
+		fix.context.buffers[0].objects[core::ObjectLayer::Bottom];
+	BOOST_REQUIRE_EQUAL(1u, objects.size());
+	BOOST_CHECK_EQUAL(objects[0]->id, a);
+	BOOST_CHECK_EQUAL(fix.context.stats.objects, 1u);
+	BOOST_CHECK_EQUAL(fix.context.stats.rejected, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(culling_fetches_only_chunks_intersecting_the_view) {
+	RenderFixture fix{{60u, 20u}};
+	auto a = fix.add_object({15u, 12u}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({15.f, 12.f}));
+	// cull scene
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	// expect some but not all of the 4x2 chunks
+	auto const & chunks = fix.context.buffers[0].chunks;
+	BOOST_REQUIRE(!chunks.empty());
+	BOOST_CHECK_LT(chunks.size(), 8u);
+	BOOST_CHECK_EQUAL(chunks.size(), fix.context.stats.chunks);
+	for (auto ptr: chunks) {
+		BOOST_CHECK(!ptr->dirty);
+		BOOST_CHECK_NE(ptr->terrain[core::Terrain::Floor].getVertexCount(), 0u);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(culling_reuses_terrain_chunks_until_invalidated) {
+	RenderFixture fix{{60u, 20u}};
+	auto a = fix.add_object({5u, 5u}, {0, 1});
+	auto& dungeon = fix.dungeon_system[1];
+	// prepare camera
+	fix.context.buffers.resize(1);
+	auto cam = fix.camera_system.acquire();
+	cam.objects.push_back(a);
+	cam.scene.setCenter(dungeon.toScreen({5.f, 5.f}));
+	// first culling fetches the tiles
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	BOOST_CHECK_GT(fix.context.stats.terrain_vertices, 0u);
+	// second culling reuses them
+	fix.context.stats = core::render_impl::Stats{};
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	BOOST_CHECK_EQUAL(fix.context.stats.terrain_vertices, 0u);
+	// invalidating a tile fetches its chunk (16x16 tiles) again
+	fix.dungeon_system.getTerrain(1u).invalidate({3u, 4u});
+	fix.context.stats = core::render_impl::Stats{};
+	core::render_impl::cullScene(
+		fix.context, fix.context.buffers[0], cam, dungeon);
+	BOOST_CHECK_EQUAL(fix.context.stats.terrain_vertices, 16u * 16u * 6u);
+}
+
 // ---------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(leg_sprite_texture_can_be_changed_via_event) {
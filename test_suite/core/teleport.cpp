@@ -33,13 +33,12 @@ struct TeleportFixture {
 			auto& d = dungeon[1u + i];
 			for (auto y = 0u; y < 10u; ++y) {
 				for (auto x = 0u; x < 12u; ++x) {
-					auto& cell = d.getCell({x, y});
 					if (x == 0u || y == 0u) {
-						cell.terrain = core::Terrain::Wall;
+						d.getTerrain({x, y}) = core::Terrain::Wall;
 					} else {
-						cell.terrain = core::Terrain::Floor;
+						d.getTerrain({x, y}) = core::Terrain::Floor;
 					}
-					cell.entities.clear();
+					d.getCell({x, y}).entities.clear();
 				}
 			}
 		}
@@ -152,6 +151,21 @@ BOOST_AUTO_TEST_CASE(vanish_sets_dirtyflag) {
 	BOOST_CHECK(data.has_changed);
 }
 
+BOOST_AUTO_TEST_CASE(spawn_and_vanish_touch_the_dungeon) {
+	auto& fix = Singleton<TeleportFixture>::get();
+	fix.reset();
+
+	auto& data = fix.add_object();
+	data.scene = 0u;
+	auto& dungeon = fix.dungeon[1u];
+	auto revision = dungeon.getRevision();
+	core::spawn(dungeon, data, {1u, 2u});
+	BOOST_CHECK_NE(dungeon.getRevision(), revision);
+	revision = dungeon.getRevision();
+	core::vanish(dungeon, data);
+	BOOST_CHECK_NE(dungeon.getRevision(), revision);
+}
+
 // ---------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(given_position_can_be_detected_as_free_position) {
@@ -175,7 +189,7 @@ BOOST_AUTO_TEST_CASE(wall_tile_is_avoided) {
 	auto& coll = fix.collision.query(data.id);
 	auto& dungeon = fix.dungeon[1u];
 	sf::Vector2u pos{3, 3};
-	dungeon.getCell(pos).terrain = core::Terrain::Wall;
+	dungeon.getTerrain(pos) = core::Terrain::Wall;
 	core::SpawnHelper helper{fix.collision, dungeon, coll};
 	BOOST_CHECK(!core::getFreePosition(helper, pos));
 	BOOST_CHECK(core::getFreePosition(helper, pos, 1));
@@ -190,7 +204,7 @@ BOOST_AUTO_TEST_CASE(void_tile_is_avoided) {
 	auto& coll = fix.collision.query(data.id);
 	auto& dungeon = fix.dungeon[1u];
 	sf::Vector2u pos{3, 3};
-	dungeon.getCell(pos).terrain = core::Terrain::Void;
+	dungeon.getTerrain(pos) = core::Terrain::Void;
 	core::SpawnHelper helper{fix.collision, dungeon, coll};
 	BOOST_CHECK(!core::getFreePosition(helper, pos));
 	BOOST_CHECK(core::getFreePosition(helper, pos, 1));
@@ -221,7 +235,7 @@ BOOST_AUTO_TEST_CASE(finding_free_pos_can_fail) {
 	auto& dungeon = fix.dungeon[1u];
 	for (auto y = 0u; y < 10u; ++y) {
 		for (auto x = 0u; x < 12u; ++x) {
-			dungeon.getCell({x, y}).terrain = core::Terrain::Wall;
+			dungeon.getTerrain({x, y}) = core::Terrain::Wall;
 		}
 	}
 
@@ -240,12 +254,12 @@ BOOST_AUTO_TEST_CASE(finding_free_pos_can_find_rare_spots) {
 	auto& dungeon = fix.dungeon[1u];
 	for (auto y = 0u; y < 10u; ++y) {
 		for (auto x = 0u; x < 12u; ++x) {
-			dungeon.getCell({x, y}).terrain = core::Terrain::Wall;
+			dungeon.getTerrain({x, y}) = core::Terrain::Wall;
 		}
 	}
 
-	dungeon.getCell({1, 1}).terrain = core::Terrain::Floor;
-	dungeon.getCell({1, 3}).terrain = core::Terrain::Floor;
+	dungeon.getTerrain({1, 1}) = core::Terrain::Floor;
+	dungeon.getTerrain({1, 3}) = core::Terrain::Floor;
 
 	auto& data = fix.add_object();
 	auto& coll = fix.collision.query(data.id);
@@ -353,6 +367,26 @@ BOOST_AUTO_TEST_CASE(teleport_trigger_propagates_tile_reached) {
 	BOOST_CHECK(events[0].type == core::MoveEvent::Left);
 }
 
+BOOST_AUTO_TEST_CASE(teleport_trigger_restores_evicted_target) {
+	auto& fix = Singleton<TeleportFixture>::get();
+	fix.reset();
+
+	auto& data = fix.add_object();
+	core::MoveSender move;
+	core::TeleportSender teleport_sender;
+	core::TeleportTrigger trigger{move, teleport_sender, fix.movement,
+		fix.collision, fix.dungeon, 2u, {5u, 7u}};
+	core::spawn(fix.dungeon[1u], data, {1u, 1u});
+	fix.dungeon.evict(2u);
+	BOOST_REQUIRE(!fix.dungeon.isResident(2u));
+
+	trigger.execute(data.id);
+
+	BOOST_CHECK_EQUAL(data.scene, 2u);
+	BOOST_CHECK(fix.dungeon.isResident(2u));
+	BOOST_CHECK(fix.dungeon[2u].hasColdCells());
+}
+
 BOOST_AUTO_TEST_CASE(teleport_trigger_fails_if_position_unaccessable) {
 	auto& fix = Singleton<TeleportFixture>::get();
 	fix.reset();
@@ -369,7 +403,7 @@ BOOST_AUTO_TEST_CASE(teleport_trigger_fails_if_position_unaccessable) {
 	auto& dungeon = fix.dungeon[2u];
 	for (auto y = 0u; y < 10u; ++y) {
 		for (auto x = 0u; x < 12u; ++x) {
-			dungeon.getCell({x, y}).terrain = core::Terrain::Wall;
+			dungeon.getTerrain({x, y}) = core::Terrain::Wall;
 		}
 	}
 
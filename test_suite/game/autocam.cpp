@@ -38,12 +38,12 @@ struct AutoCamFixture {
 			auto& d = dungeon[scene];
 			for (auto y = 0u; y < grid_size.y; ++y) {
 				for (auto x = 0u; x < grid_size.x; ++x) {
-					auto& cell = d.getCell({x, y});
+					auto& terrain = d.getTerrain({x, y});
 					if (x == 0u || x == grid_size.x - 1u || y == 0u ||
 						y == grid_size.y - 1u) {
-						cell.terrain = core::Terrain::Wall;
+						terrain = core::Terrain::Wall;
 					} else {
-						cell.terrain = core::Terrain::Floor;
+						terrain = core::Terrain::Floor;
 					}
 				}
 			}
@@ -24,9 +24,8 @@ struct BuilderFixture {
 	void reset() {
 		for (auto y = 0u; y < 15u; ++y) {
 			for (auto x = 0u; x < 15u; ++x) {
-				auto& cell = dungeon.getCell({x, y});
-				cell.terrain = core::Terrain::Void;
-				cell.tile = utils::OrthoTile{};
+				dungeon.getTerrain({x, y}) = core::Terrain::Void;
+				dungeon.getColdCell({x, y}).tile = utils::OrthoTile{};
 			}
 		}
 		settings = game::BuildSettings{};
@@ -39,7 +38,7 @@ struct BuilderFixture {
 		std::string s;
 		for (auto y = 0u; y < 15u; ++y) {
 			for (auto x = 0u; x < 15u; ++x) {
-				switch (dungeon.getCell({x, y}).terrain) {
+				switch (dungeon.getTerrain({x, y})) {
 					case core::Terrain::Void:
 						s += ".";
 						break;
@@ -71,7 +70,7 @@ BOOST_AUTO_TEST_CASE(floor_tile_will_not_be_wall) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({2u, 3u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 3u}) = core::Terrain::Floor;
 	BOOST_CHECK(!game::dungeon_impl::shouldBeWall(fix.dungeon, {2u, 3u}));
 }
 
@@ -79,7 +78,7 @@ BOOST_AUTO_TEST_CASE(void_tile_with_floor_neighbor_will_be_wall) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({2u, 3u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 3u}) = core::Terrain::Floor;
 	BOOST_CHECK(game::dungeon_impl::shouldBeWall(fix.dungeon, {2u, 2u}));
 }
 
@@ -87,8 +86,8 @@ BOOST_AUTO_TEST_CASE(void_tile_with_floor_and_wall_neighbor_will_be_wall) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({2u, 3u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 3u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
 	BOOST_CHECK(game::dungeon_impl::shouldBeWall(fix.dungeon, {2u, 2u}));
 }
 
@@ -96,7 +95,7 @@ BOOST_AUTO_TEST_CASE(void_tile_with_only_and_wall_neighbor_will_not_be_wall) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
 	BOOST_CHECK(!game::dungeon_impl::shouldBeWall(fix.dungeon, {2u, 2u}));
 }
 
@@ -114,7 +113,7 @@ BOOST_AUTO_TEST_CASE(floor_tile_will_not_cause_shading) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Floor;
 	BOOST_CHECK(
 		!game::dungeon_impl::shouldBeShaded(fix.dungeon, {2u, 2u}, {-1, -1}));
 }
@@ -123,7 +122,7 @@ BOOST_AUTO_TEST_CASE(wall_tile_will_not_cause_shading) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
 
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
 	BOOST_CHECK(
 		!game::dungeon_impl::shouldBeShaded(fix.dungeon, {2u, 2u}, {-1, -1}));
 }
@@ -137,14 +136,14 @@ BOOST_AUTO_TEST_CASE(tile_can_be_topleft_edge_shaded) {
 	//	.	#	~
 	//	#	X	~
 	//	~	~	~
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeTopLeft);
@@ -157,14 +156,14 @@ BOOST_AUTO_TEST_CASE(tile_can_be_topright_edge_shaded) {
 	//	~	#	.
 	//	~	X	#
 	//	~	~	~
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeTopRight);
@@ -177,14 +176,14 @@ BOOST_AUTO_TEST_CASE(tile_can_be_bottomright_edge_shaded) {
 	//	~	~	~
 	//	~	X	#
 	//	~	#	.
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeBottomRight);
@@ -197,14 +196,14 @@ BOOST_AUTO_TEST_CASE(tile_can_be_bottomleft_edge_shaded) {
 	//	~	~	~
 	//	#	X	~
 	//	.	#	~
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeBottomLeft);
@@ -217,10 +216,10 @@ BOOST_AUTO_TEST_CASE(tile_can_be_topleft_corner_shaded) {
 	//	.	.	.
 	//	.	X	#
 	//	.	#	~
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading,
@@ -234,10 +233,10 @@ BOOST_AUTO_TEST_CASE(tile_can_be_topright_corner_shaded) {
 	//	.	.	.
 	//	#	X	.
 	//	~	#	.
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading,
@@ -251,10 +250,10 @@ BOOST_AUTO_TEST_CASE(tile_can_be_bottomright_corner_shaded) {
 	//	~	#	.
 	//	#	X	.
 	//	.	.	.
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeBottomRight |
@@ -269,10 +268,10 @@ BOOST_AUTO_TEST_CASE(tile_can_be_bottomleft_corner_shaded) {
 	//	.	#	~
 	//	.	X	#
 	//	.	.	.
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading,
@@ -286,12 +285,12 @@ BOOST_AUTO_TEST_CASE(tile_can_be_top_shaded) {
 	//	.	.	.
 	//	#	X	#
 	//	~	~	~
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeTopLeft | utils::ShadeTopRight);
@@ -304,12 +303,12 @@ BOOST_AUTO_TEST_CASE(tile_can_be_bottom_shaded) {
 	//	~	~	~
 	//	#	X	#
 	//	.	.	.
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(
@@ -323,12 +322,12 @@ BOOST_AUTO_TEST_CASE(tile_can_be_right_shaded) {
 	//	~	#	.
 	//	~	X	.
 	//	~	#	.
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({0u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({0u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({0u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({0u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeTopRight | utils::ShadeBottomRight);
@@ -341,12 +340,12 @@ BOOST_AUTO_TEST_CASE(tile_can_be_left_shaded) {
 	//	.	#	~
 	//	.	X	~
 	//	.	#	~
-	fix.dungeon.getCell({1u, 0u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 1u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({1u, 2u}).terrain = core::Terrain::Wall;
-	fix.dungeon.getCell({2u, 0u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 1u}).terrain = core::Terrain::Floor;
-	fix.dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
+	fix.dungeon.getTerrain({1u, 0u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 1u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({1u, 2u}) = core::Terrain::Wall;
+	fix.dungeon.getTerrain({2u, 0u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 1u}) = core::Terrain::Floor;
+	fix.dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
 	auto shading = game::dungeon_impl::getShadingCase(fix.dungeon, {1u, 1u});
 
 	BOOST_CHECK_EQUAL(shading, utils::ShadeTopLeft | utils::ShadeBottomLeft);
@@ -914,6 +913,36 @@ BOOST_AUTO_TEST_CASE(
 
 // --------------------------------------------------------------------
 
+BOOST_AUTO_TEST_CASE(walls_can_be_searched_in_stripes) {
+	auto& fix = Singleton<BuilderFixture>::get();
+	fix.reset();
+
+	game::RoomTemplate room;
+	room.create({1u, 1u});
+	room.create({2u, 1u});
+	room.create({1u, 2u});
+	
+	game::DungeonBuilder builder({15u, 15u});
+	builder.rooms.emplace_back(2u, 5u, room);
+	builder.paths.emplace_back(3u, 6u, 10u, 12u);
+	builder.placeFloors(fix.dungeon, fix.settings);
+	
+	std::vector<sf::Vector2u> whole, striped;
+	game::dungeon_impl::findWalls(fix.dungeon, 0u, 15u, whole);
+	game::dungeon_impl::findWalls(fix.dungeon, 0u, 7u, striped);
+	game::dungeon_impl::findWalls(fix.dungeon, 7u, 9u, striped);
+	game::dungeon_impl::findWalls(fix.dungeon, 9u, 15u, striped);
+	BOOST_CHECK(!whole.empty());
+	BOOST_CHECK(whole == striped);
+	
+	// dungeon was not modified
+	for (auto const & pos: whole) {
+		BOOST_CHECK(fix.dungeon.getTerrain(pos) == core::Terrain::Void);
+	}
+}
+
+// --------------------------------------------------------------------
+
 BOOST_AUTO_TEST_CASE(corridors_do_not_replace_inner_wall_of_rooms) {
 	auto& fix = Singleton<BuilderFixture>::get();
 	fix.reset();
@@ -246,7 +246,7 @@ struct FactoryFixture : utils::EventListener<core::InputEvent,
 				auto& c = d.getCell({x, y});
 				c.trigger = nullptr;
 				c.entities.clear();
-				c.ambiences.clear();
+				d.getColdCell({x, y}).ambiences.clear();
 			}
 		}
 		// reset objects
@@ -299,8 +299,7 @@ BOOST_AUTO_TEST_CASE(dungeon_is_built_on_creation) {
 	auto const& d = fix.dungeon[1u];
 	for (auto y = 0u; y < 10u; ++y) {
 		for (auto x = 0u; x < 30u; ++x) {
-			auto const& c = d.getCell({x, y});
-			switch (c.terrain) {
+			switch (d.getTerrain({x, y})) {
 				case core::Terrain::Void:
 					found += ' ';
 					break;
@@ -425,7 +424,7 @@ BOOST_AUTO_TEST_CASE(flying_object_is_spawned_moving) {
 
 	BOOST_REQUIRE(fix.animation.has(id));
 	auto const & data = fix.animation.query(id);
-	BOOST_CHECK(data.flying);
+	BOOST_CHECK(fix.animation.query(id).flying);
 	BOOST_CHECK(data.is_moving);
 }
 
@@ -1874,7 +1873,7 @@ BOOST_AUTO_TEST_CASE(character_death_causes_blood_if_entity_if_textures_and_colo
 	data.layer = core::ObjectLayer::Top;
 
 	fix.onCharacterDied(id);
-	auto& blood = fix.dungeon[1u].getCell(spawn.pos).ambiences;
+	auto& blood = fix.dungeon[1u].getColdCell(spawn.pos).ambiences;
 	BOOST_REQUIRE_EQUAL(blood.size(), 1u);
 	BOOST_CHECK_EQUAL(blood[0].getTexture(), &fix.dummy);
 }
@@ -1897,7 +1896,7 @@ BOOST_AUTO_TEST_CASE(character_death_does_not_cause_blood_if_no_textures_are_pro
 	data.layer = core::ObjectLayer::Top;
 
 	fix.onCharacterDied(id);
-	auto& blood = fix.dungeon[1u].getCell(spawn.pos).ambiences;
+	auto& blood = fix.dungeon[1u].getColdCell(spawn.pos).ambiences;
 	BOOST_CHECK(blood.empty());
 }
 
@@ -1956,8 +1955,8 @@ BOOST_AUTO_TEST_CASE(powerup_cannot_be_spawned_if_not_a_floor_tile) {
 	spawn.pos = {0u, 0u};
 	spawn.direction = {1, 0};
 	
-	auto const & cell = fix.dungeon[spawn.scene].getCell(spawn.pos);
-	BOOST_REQUIRE(cell.terrain != core::Terrain::Floor);
+	auto terrain = fix.dungeon[spawn.scene].getTerrain(spawn.pos);
+	BOOST_REQUIRE(terrain != core::Terrain::Floor);
 	
 	auto result = game::factory_impl::canHoldPowerup(fix.session, spawn.scene, spawn.pos);
 	BOOST_CHECK(!result);
@@ -2312,4 +2311,44 @@ BOOST_AUTO_TEST_CASE(bot_is_not_hostile_if_respawned_by_allied_bot) {
 	BOOST_CHECK(!script.api->hostile);
 }
 
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(multiple_dungeons_can_be_created_in_parallel) {
+	auto& fix = Singleton<FactoryFixture>::get();
+	fix.reset();
+	utils::JobSystem jobs{2u};
+	game::Factory factory{fix.log, fix.session, fix.mod, &jobs};
+	
+	rpg::TilesetTemplate tileset;
+	tileset.tileset_name = "demo";
+	tileset.tilesize = {16u, 16u};
+	tileset.floors.emplace_back(0u, 0u);
+	tileset.walls.emplace_back(16u, 0u);
+	tileset.tileset = &fix.dummy;
+	std::vector<game::DungeonRequest> requests(3u);
+	for (auto& request: requests) {
+		request.tileset = &tileset;
+		request.grid_size = {30u, 10u};
+		request.settings.path_width = 2u;
+		request.settings.random_transform = false;
+	}
+	auto ids = factory.createDungeons(requests);
+	BOOST_REQUIRE_EQUAL(ids.size(), 3u);
+	
+	// layout is unique due to room density, so all equal the first dungeon
+	auto const & expected = fix.dungeon[1u];
+	for (auto id: ids) {
+		auto const & d = fix.dungeon[id];
+		BOOST_REQUIRE(d.getSize() == expected.getSize());
+		for (auto y = 0u; y < 10u; ++y) {
+			for (auto x = 0u; x < 30u; ++x) {
+				BOOST_CHECK(d.getTerrain({x, y})
+					== expected.getTerrain({x, y}));
+			}
+		}
+		BOOST_CHECK_NO_THROW(fix.navigation[id]);
+		BOOST_CHECK_EQUAL(fix.generator[id].builder.info.rooms.size(), 3u);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -79,7 +79,7 @@ struct LuaFixture
 	rpg::ItemTemplate sword_tpl, bow_tpl, armor_tpl, potion_tpl;
 	rpg::PerkTemplate fireball_tpl, heal_tpl;
 	rpg::Keybinding keys_tpl;
-	utils::Script script_dummy;
+	game::AiScript script_dummy;
 
 	LuaFixture()
 		: utils::EventListener<core::InputEvent, rpg::ActionEvent,
@@ -138,7 +138,6 @@ struct LuaFixture
 		factory.bind<rpg::ActionEvent>(*this);
 		factory.bind<rpg::ItemEvent>(*this);
 
-		utils::bindAll(script_dummy);
 		script_dummy.loadFromMemory("onInit = function(self)\nend\n");
 
 		rpg::TilesetTemplate tileset;
@@ -1,3 +1,4 @@
+#include <limits>
 #include <boost/test/unit_test.hpp>
 #include <testsuite/sfml_system.hpp>
 #include <testsuite/singleton.hpp>
@@ -79,20 +80,20 @@ BOOST_AUTO_TEST_CASE(can_navigate_at_narrowphase) {
 	//	.   .
 	//	.....
 	//	.
-	dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({2u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({2u, 4u}).terrain = core::Terrain::Wall;
-	dungeon.getCell({2u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({2u, 6u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({3u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({4u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({5u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 4u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({5u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({4u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({3u, 5u}).terrain = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 4u}) = core::Terrain::Wall;
+	dungeon.getTerrain({2u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 6u}) = core::Terrain::Floor;
+	dungeon.getTerrain({3u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({4u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({5u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 4u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({5u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({4u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({3u, 5u}) = core::Terrain::Floor;
 
 	auto& astar = navigator.narrowphase;
 	auto path = astar(17u, {2u, 3u}, {2u, 5u}, 20u);
@@ -118,26 +119,26 @@ BOOST_AUTO_TEST_CASE(teleport_triggers_are_avoided_at_narrowphase) {
 	//	.   .
 	//	.....
 	//	.
-	dungeon.getCell({2u, 2u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({2u, 3u}).terrain = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 2u}) = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 3u}) = core::Terrain::Floor;
 	{
+		dungeon.getTerrain({2u, 4u}) = core::Terrain::Floor;
 		auto& cell = dungeon.getCell({2u, 4u});
-		cell.terrain = core::Terrain::Floor;
 		cell.trigger = std::make_unique<core::TeleportTrigger>(move_sender,
 			teleport_sender, movement, collision, dungeonsystem, dungeon.id,
 			sf::Vector2u{3u, 3u});
 	}
-	dungeon.getCell({2u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({2u, 6u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({3u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({4u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({5u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 3u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 4u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({6u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({5u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({4u, 5u}).terrain = core::Terrain::Floor;
-	dungeon.getCell({3u, 5u}).terrain = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({2u, 6u}) = core::Terrain::Floor;
+	dungeon.getTerrain({3u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({4u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({5u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 3u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 4u}) = core::Terrain::Floor;
+	dungeon.getTerrain({6u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({5u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({4u, 5u}) = core::Terrain::Floor;
+	dungeon.getTerrain({3u, 5u}) = core::Terrain::Floor;
 
 	auto& astar = navigator.narrowphase;
 	auto path = astar(17u, {2u, 3u}, {2u, 5u}, 20u);
@@ -161,7 +162,7 @@ BOOST_AUTO_TEST_CASE(diagonal_movements_have_higher_priority_for_going_south_eas
 	sf::Vector2u pos;
 	for (pos.y = 2u; pos.y <= 6u; ++pos.y) {
 		for (pos.x = 2u; pos.x <= 3u; ++pos.x) {
-			dungeon.getCell(pos).terrain = core::Terrain::Floor;
+			dungeon.getTerrain(pos) = core::Terrain::Floor;
 		}
 	}
 
@@ -190,7 +191,7 @@ BOOST_AUTO_TEST_CASE(diagonal_movements_have_higher_priority_for_going_south_wes
 	sf::Vector2u pos;
 	for (pos.y = 2u; pos.y <= 6u; ++pos.y) {
 		for (pos.x = 2u; pos.x <= 3u; ++pos.x) {
-			dungeon.getCell(pos).terrain = core::Terrain::Floor;
+			dungeon.getTerrain(pos) = core::Terrain::Floor;
 		}
 	}
 
@@ -216,7 +217,7 @@ BOOST_AUTO_TEST_CASE(diagonal_movements_have_higher_priority_for_going_north_eas
 	sf::Vector2u pos;
 	for (pos.y = 2u; pos.y <= 3u; ++pos.y) {
 		for (pos.x = 2u; pos.x <= 6u; ++pos.x) {
-			dungeon.getCell(pos).terrain = core::Terrain::Floor;
+			dungeon.getTerrain(pos) = core::Terrain::Floor;
 		}
 	}
 
@@ -242,7 +243,7 @@ BOOST_AUTO_TEST_CASE(diagonal_movements_have_higher_priority_north_west) {
 	sf::Vector2u pos;
 	for (pos.y = 2u; pos.y <= 3u; ++pos.y) {
 		for (pos.x = 2u; pos.x <= 6u; ++pos.x) {
-			dungeon.getCell(pos).terrain = core::Terrain::Floor;
+			dungeon.getTerrain(pos) = core::Terrain::Floor;
 		}
 	}
 
@@ -254,4 +255,341 @@ BOOST_AUTO_TEST_CASE(diagonal_movements_have_higher_priority_north_west) {
 	BOOST_CHECK_VECTOR_EQUAL(path[2], sf::Vector2u(4u, 2u));
 }
 
+// ---------------------------------------------------------------------------
+
+namespace navigator_test_impl {
+
+/// Build a 3x2 layout with cell size 5 and 1-tile-wide corridors
+/**
+ *	X---X---X
+ *	        |
+ *	        X
+ */
+void prepareHierarchy(game::DungeonGraph& grid, core::Dungeon& dungeon) {
+	grid.addNode({2u, 2u});
+	grid.addNode({7u, 2u});
+	grid.addNode({12u, 2u});
+	grid.addNode({12u, 7u});
+	grid.addPath({2u, 2u}, {7u, 2u});
+	grid.addPath({7u, 2u}, {12u, 2u});
+	grid.addPath({12u, 2u}, {12u, 7u});
+	for (auto x = 0u; x <= 12u; ++x) {
+		dungeon.getTerrain({x, 2u}) = core::Terrain::Floor;
+	}
+	for (auto y = 3u; y <= 7u; ++y) {
+		dungeon.getTerrain({12u, y}) = core::Terrain::Floor;
+	}
+}
+
+}  // ::navigator_test_impl
+
+BOOST_AUTO_TEST_CASE(hierarchical_path_is_not_limited_by_max_length) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+
+	// direct narrowphase cannot reach the target
+	auto direct = navigator.narrowphase(17u, {1u, 2u}, {12u, 6u}, 5u);
+	BOOST_REQUIRE(!direct.empty());
+	BOOST_CHECK(direct.front() != sf::Vector2u(12u, 6u));
+
+	auto path = navigator(17u, {1u, 2u}, {12u, 6u}, 5u);
+	auto expected = navigator.narrowphase(17u, {1u, 2u}, {12u, 6u}, 0u);
+	BOOST_REQUIRE_EQUAL(path.size(), expected.size());
+	BOOST_CHECK_VECTOR_EQUAL(path.front(), sf::Vector2u(12u, 6u));
+	BOOST_CHECK_VECTOR_EQUAL(path.back(), sf::Vector2u(1u, 2u));
+	for (auto i = 1u; i < path.size(); ++i) {
+		BOOST_CHECK_LE(game::navigator_impl::distance(path[i - 1u], path[i]), 1.5f);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(hierarchical_corridor_legs_are_cached) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+
+	auto path = navigator(17u, {1u, 2u}, {12u, 6u}, 5u);
+	// portals: (4,2), (9,2), (12,4) --> two cached legs
+	BOOST_CHECK_EQUAL(navigator.routes.size(), 1u);
+	BOOST_CHECK_EQUAL(navigator.corridors.size(), 2u);
+
+	auto other = navigator(17u, {0u, 2u}, {12u, 7u}, 5u);
+	BOOST_CHECK_EQUAL(navigator.routes.size(), 1u);
+	BOOST_CHECK_EQUAL(navigator.corridors.size(), 2u);
+	BOOST_REQUIRE_EQUAL(other.size(), path.size() + 2u);
+	BOOST_CHECK_VECTOR_EQUAL(other.front(), sf::Vector2u(12u, 7u));
+	BOOST_CHECK_VECTOR_EQUAL(other.back(), sf::Vector2u(0u, 2u));
+}
+
+BOOST_AUTO_TEST_CASE(hierarchical_pathfinding_uses_narrowphase_within_a_cell) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+
+	auto path = navigator(17u, {12u, 5u}, {12u, 7u}, 5u);
+	BOOST_REQUIRE_EQUAL(path.size(), 3u);
+	BOOST_CHECK_VECTOR_EQUAL(path[0], sf::Vector2u(12u, 7u));
+	BOOST_CHECK_VECTOR_EQUAL(path[1], sf::Vector2u(12u, 6u));
+	BOOST_CHECK_VECTOR_EQUAL(path[2], sf::Vector2u(12u, 5u));
+	BOOST_CHECK(navigator.routes.empty());
+	BOOST_CHECK(navigator.corridors.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hierarchical_pathfinding_can_be_resumed) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+
+	auto expected = navigator(17u, {1u, 2u}, {12u, 6u}, 5u);
+
+	navigator.start(17u, {1u, 2u}, {12u, 6u}, 5u);
+	auto path = navigator.getPath();
+	BOOST_REQUIRE_EQUAL(path.size(), 1u);
+	BOOST_CHECK_VECTOR_EQUAL(path[0], sf::Vector2u(1u, 2u));
+	std::size_t n{0u};
+	bool done{false};
+	while (!done) {
+		std::size_t budget{1u};
+		done = navigator.resume(budget);
+		n += 1u - budget;
+		BOOST_REQUIRE_LE(n, 1000u);
+	}
+	BOOST_CHECK_GT(n, 1u);
+	BOOST_CHECK(navigator.getPath() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(hierarchical_pathfinding_falls_back_if_target_is_not_reached) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+	// block the last leg between the last portal and the target
+	collision.acquire(18u);
+	dungeon.getCell({12u, 5u}).entities.push_back(18u);
+
+	auto plan = navigator.plan({1u, 2u}, {12u, 6u}, 5u);
+	BOOST_REQUIRE(!plan.direct);
+	auto path = navigator(17u, {1u, 2u}, {12u, 6u}, 5u);
+	auto expected = navigator.narrowphase(17u, {1u, 2u}, {12u, 6u}, 5u);
+	BOOST_CHECK(path == expected);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_scene_provides_same_neighbors_as_navigation_scene) {
+	sf::Texture dummy;
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	for (auto y = 1u; y < 9u; ++y) {
+		for (auto x = 1u; x < 14u; ++x) {
+			dungeon.getTerrain({x, y}) = core::Terrain::Floor;
+		}
+	}
+	game::NavigationScene scene{collision, dungeon};
+	auto& actor = collision.acquire(17u);
+	actor.ignore.push_back(19u);
+	collision.acquire(18u);
+	collision.acquire(19u);
+	collision.acquire(20u).is_projectile = true;
+	dungeon.getCell({3u, 3u}).entities.push_back(17u);
+	dungeon.getCell({4u, 3u}).entities.push_back(18u);
+	dungeon.getCell({3u, 4u}).entities.push_back(19u);
+	dungeon.getCell({2u, 2u}).entities.push_back(20u);
+	dungeon.getCell({2u, 4u}).entities.push_back(21u);
+
+	auto snapshot = std::make_shared<game::NavigationSnapshot const>(
+		scene.createSnapshot());
+	BOOST_CHECK_EQUAL(snapshot->occupants.size(), 3u);
+	game::SnapshotScene other{dungeon.getSize()};
+	other.setSnapshot(snapshot);
+	sf::Vector2u pos;
+	for (pos.y = 0u; pos.y < 10u; ++pos.y) {
+		for (pos.x = 0u; pos.x < 15u; ++pos.x) {
+			auto expected = scene.getNeighbors(17u, pos);
+			auto actual = other.getNeighbors(17u, pos, actor.ignore);
+			BOOST_CHECK(actual == expected);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(snapshots_share_walkable_tiles_but_copy_occupants) {
+	sf::Texture dummy;
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	dungeon.getTerrain({3u, 3u}) = core::Terrain::Floor;
+	game::NavigationScene scene{collision, dungeon};
+	collision.acquire(17u);
+
+	auto first = scene.createSnapshot();
+	dungeon.getCell({3u, 3u}).entities.push_back(17u);
+	auto second = scene.createSnapshot();
+	BOOST_CHECK(first.walkable == second.walkable);
+	BOOST_CHECK((*first.walkable)[3u + 3u * 15u]);
+	BOOST_CHECK(first.occupants.empty());
+	BOOST_REQUIRE_EQUAL(second.occupants.size(), 1u);
+	BOOST_CHECK_EQUAL(second.occupants[0].second, 17u);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_is_reused_until_the_dungeon_is_touched) {
+	sf::Texture dummy;
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	dungeon.getTerrain({3u, 3u}) = core::Terrain::Floor;
+	game::NavigationScene scene{collision, dungeon};
+	collision.acquire(17u);
+
+	auto first = scene.getSnapshot();
+	BOOST_CHECK(scene.getSnapshot() == first);
+	dungeon.getCell({3u, 3u}).entities.push_back(17u);
+	dungeon.touch();
+	auto second = scene.getSnapshot();
+	BOOST_CHECK(second != first);
+	BOOST_CHECK(first->occupants.empty());
+	BOOST_REQUIRE_EQUAL(second->occupants.size(), 1u);
+	BOOST_CHECK_EQUAL(second->occupants[0].second, 17u);
+}
+
+BOOST_AUTO_TEST_CASE(plan_can_be_searched_using_a_snapshot) {
+	sf::Texture dummy;
+	game::DungeonGraph grid{{15u, 10u}};
+	core::CollisionManager collision;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::NavigationScene scene{collision, dungeon};
+	game::Navigator navigator{std::move(grid), std::move(scene), 5u};
+	collision.acquire(17u);
+
+	auto expected = navigator(17u, {1u, 2u}, {12u, 6u}, 5u);
+	auto plan = navigator.plan({1u, 2u}, {12u, 6u}, 5u);
+	BOOST_CHECK(!plan.direct);
+
+	game::SnapshotScene other{dungeon.getSize()};
+	other.setSnapshot(std::make_shared<game::NavigationSnapshot const>(
+		navigator.scene.createSnapshot()));
+	utils::GridPathfinder<game::SnapshotScene, core::ObjectID> finder{other};
+	game::PlanSearch<utils::GridPathfinder<game::SnapshotScene,
+		core::ObjectID>> search{finder};
+	search.start(17u, plan);
+	auto budget = std::numeric_limits<std::size_t>::max();
+	BOOST_REQUIRE(search.resume(budget));
+	BOOST_CHECK(search.getPath() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(flow_field_leads_to_target) {
+	sf::Texture dummy;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	game::DungeonGraph grid{{15u, 10u}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::TerrainScene terrain{dungeon};
+	game::FlowField field{terrain, 30.f};
+	BOOST_CHECK(!field.isValid());
+
+	field.setTarget({12u, 6u});
+	BOOST_CHECK(field.isPending());
+	auto budget = std::numeric_limits<std::size_t>::max();
+	BOOST_REQUIRE(field.resume(budget));
+	BOOST_REQUIRE(field.isValid());
+	BOOST_CHECK_VECTOR_EQUAL(field.getTarget(), sf::Vector2u(12u, 6u));
+	BOOST_CHECK_CLOSE(field.getDistance({12u, 6u}), 0.f, 0.0001f);
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({12u, 6u}), sf::Vector2i());
+	BOOST_CHECK_EQUAL(field.getDistance({0u, 0u}), std::numeric_limits<float>::infinity());
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({0u, 0u}), sf::Vector2i());
+
+	// follow field step by step
+	sf::Vector2u pos{1u, 2u};
+	auto expected = field.getDistance(pos);
+	std::size_t steps{0u};
+	while (pos != sf::Vector2u(12u, 6u)) {
+		auto dir = field.getDirection(pos);
+		BOOST_REQUIRE(dir != sf::Vector2i());
+		auto next = sf::Vector2u{sf::Vector2i{pos} + dir};
+		BOOST_REQUIRE(game::navigator_impl::canTraverse(dungeon, next));
+		BOOST_CHECK_LT(field.getDistance(next), field.getDistance(pos));
+		pos = next;
+		BOOST_REQUIRE_LE(++steps, 20u);
+	}
+	// path: 10 straight steps along y=2, 1 diagonal step, 3 straight steps
+	BOOST_CHECK_EQUAL(steps, 14u);
+	BOOST_CHECK_CLOSE(expected, 13.f + 1.414f, 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(flow_field_is_limited_by_range) {
+	sf::Texture dummy;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	game::DungeonGraph grid{{15u, 10u}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::TerrainScene terrain{dungeon};
+	game::FlowField field{terrain, 5.f};
+
+	field.setTarget({12u, 6u});
+	auto budget = std::numeric_limits<std::size_t>::max();
+	BOOST_REQUIRE(field.resume(budget));
+	BOOST_CHECK(field.getDirection({12u, 2u}) != sf::Vector2i());
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({1u, 2u}), sf::Vector2i());
+}
+
+BOOST_AUTO_TEST_CASE(flow_field_is_used_while_recalculated) {
+	sf::Texture dummy;
+	core::Dungeon dungeon{1u, dummy, {15u, 10u}, {8.f, 8.f}};
+	game::DungeonGraph grid{{15u, 10u}};
+	navigator_test_impl::prepareHierarchy(grid, dungeon);
+	game::TerrainScene terrain{dungeon};
+	game::FlowField field{terrain, 30.f};
+
+	field.setTarget({12u, 6u});
+	auto budget = std::numeric_limits<std::size_t>::max();
+	BOOST_REQUIRE(field.resume(budget));
+
+	// same target does not trigger a calculation
+	field.setTarget({12u, 6u});
+	BOOST_CHECK(!field.isPending());
+
+	// target moved: old field is used until calculation is finished
+	field.setTarget({12u, 7u});
+	BOOST_REQUIRE(field.isPending());
+	budget = 3u;
+	BOOST_CHECK(!field.resume(budget));
+	BOOST_CHECK_EQUAL(budget, 0u);
+	BOOST_CHECK_VECTOR_EQUAL(field.getTarget(), sf::Vector2u(12u, 6u));
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({12u, 7u}), sf::Vector2i(0, -1));
+
+	std::size_t n{0u};
+	while (!field.resume(budget)) {
+		budget = 3u;
+		BOOST_REQUIRE_LE(++n, 100u);
+	}
+	BOOST_CHECK_VECTOR_EQUAL(field.getTarget(), sf::Vector2u(12u, 7u));
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({12u, 7u}), sf::Vector2i());
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({12u, 6u}), sf::Vector2i(0, 1));
+
+	// recalculating the previous target yields the previous field
+	field.setTarget({12u, 6u});
+	budget = std::numeric_limits<std::size_t>::max();
+	BOOST_REQUIRE(field.resume(budget));
+	BOOST_CHECK_CLOSE(field.getDistance({1u, 2u}), 13.f + 1.414f, 0.0001f);
+	BOOST_CHECK_VECTOR_EQUAL(field.getDirection({12u, 7u}), sf::Vector2i(0, -1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
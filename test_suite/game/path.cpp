@@ -79,6 +79,7 @@ struct PathFixture {
 		objects.push_back(id);
 		collision.acquire(id);
 		dungeon.getCell(pos).entities.push_back(id);
+		dungeon.touch();
 		return id;
 	}
 
@@ -89,6 +90,7 @@ struct PathFixture {
 				dungeon.getCell({x, y}).entities.clear();
 			}
 		}
+		dungeon.touch();
 		// remove components
 		for (auto id : objects) {
 			collision.release(id);
@@ -217,4 +219,144 @@ BOOST_AUTO_TEST_CASE(can_calculate_two_paths) {
 }
 */
 
+BOOST_AUTO_TEST_CASE(calculation_can_be_suspended) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem system{fix.log};
+	system.addScene(1u, *fix.navi);
+	auto id = fix.addActor({2u, 3u});
+	auto future =
+		system.schedule(id, 1u, {1u, 3u}, {2, 7});
+	// expect a single slice even without any time left
+	auto n = system.calculate(sf::Time::Zero);
+	BOOST_CHECK_GT(system.getStats().expanded, 0u);
+	BOOST_CHECK_LE(system.getStats().expanded, game::path_impl::EXPANSION_SLICE);
+	BOOST_CHECK_EQUAL(n + system.getStats().pending, 1u);
+
+	system.calculate(sf::milliseconds(1000u));
+	BOOST_CHECK_EQUAL(system.getStats().pending, 0u);
+	BOOST_REQUIRE(future.valid());
+	auto path = future.get();
+	BOOST_REQUIRE_EQUAL(path.size(), 5u);
+	BOOST_CHECK_VECTOR_EQUAL(path.at(4), sf::Vector2u(1u, 3u));
+	BOOST_CHECK_VECTOR_EQUAL(path.at(0), sf::Vector2u(2u, 7u));
+}
+
+BOOST_AUTO_TEST_CASE(requests_are_calculated_round_robin) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem system{fix.log};
+	system.addScene(1u, *fix.navi);
+	auto id = fix.addActor({2u, 3u});
+	auto other = fix.addActor({12u, 3u});
+	// note: the target cannot be reached, so the whole area is searched
+	auto slow = system.schedule(id, 1u, {1u, 3u}, {19u, 14u});
+	auto fast = system.schedule(other, 1u, {12u, 3u}, {12u, 4u});
+	// each call calculates a single slice
+	system.calculate(sf::Time::Zero);
+	system.calculate(sf::Time::Zero);
+	auto status = fast.wait_for(std::chrono::milliseconds(0));
+	BOOST_CHECK(status == std::future_status::ready);
+	status = slow.wait_for(std::chrono::milliseconds(0));
+	BOOST_CHECK(status != std::future_status::ready);
+
+	system.calculate(sf::milliseconds(1000u));
+	status = slow.wait_for(std::chrono::milliseconds(0));
+	BOOST_CHECK(status == std::future_status::ready);
+}
+
+BOOST_AUTO_TEST_CASE(rescheduling_replaces_pending_request) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem system{fix.log};
+	system.addScene(1u, *fix.navi);
+	auto id = fix.addActor({2u, 3u});
+	auto other = fix.addActor({12u, 3u});
+	system.schedule(id, 1u, {1u, 3u}, {2, 7});
+	system.schedule(other, 1u, {12u, 3u}, {12, 7});
+	auto future =
+		system.schedule(id, 1u, {1u, 3u}, {1, 5});
+	auto n = system.calculate(sf::milliseconds(1000u));
+	BOOST_CHECK_EQUAL(n, 2u);
+	BOOST_REQUIRE(future.valid());
+	auto path = future.get();
+	BOOST_REQUIRE(!path.empty());
+	BOOST_CHECK_VECTOR_EQUAL(path.front(), sf::Vector2u(1u, 5u));
+}
+
+BOOST_AUTO_TEST_CASE(workers_calculate_same_path_as_synchronous_calculation) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem sync{fix.log}, async{fix.log};
+	sync.addScene(1u, *fix.navi);
+	async.addScene(1u, *fix.navi);
+	async.start(2u);
+	auto id = fix.addActor({2u, 3u});
+	fix.addActor({1u, 5u});
+	auto expected = sync.schedule(id, 1u, {1u, 3u}, {2, 7});
+	auto future = async.schedule(id, 1u, {1u, 3u}, {2, 7});
+	sync.calculate(sf::milliseconds(1000u));
+	async.calculate(sf::milliseconds(1000u));
+	BOOST_REQUIRE(future.valid());
+	auto path = future.get();
+	auto other = expected.get();
+	BOOST_REQUIRE_EQUAL(path.size(), other.size());
+	for (auto i = 0u; i < path.size(); ++i) {
+		BOOST_CHECK_VECTOR_EQUAL(path[i], other[i]);
+	}
+	// workload is reported by the next calculation
+	async.calculate(sf::milliseconds(1000u));
+	BOOST_CHECK_EQUAL(async.getStats().completed, 1u);
+	BOOST_CHECK_EQUAL(async.getStats().pending, 0u);
+	BOOST_CHECK_GT(async.getStats().expanded, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(workers_and_synchronous_calculation_ignore_the_same_objects) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem sync{fix.log}, async{fix.log};
+	sync.addScene(1u, *fix.navi);
+	async.addScene(1u, *fix.navi);
+	async.start(1u);
+	auto id = fix.addActor({2u, 3u});
+	auto unblocked = sync.schedule(id, 1u, {1u, 3u}, {2, 7});
+	sync.calculate(sf::milliseconds(1000u));
+	// ignored object does not block the actor in either mode
+	auto other = fix.addActor({2u, 6u});
+	fix.collision.query(id).ignore.push_back(other);
+	auto expected = sync.schedule(id, 1u, {1u, 3u}, {2, 7});
+	auto future = async.schedule(id, 1u, {1u, 3u}, {2, 7});
+	sync.calculate(sf::milliseconds(1000u));
+	async.calculate(sf::milliseconds(1000u));
+	auto reference = unblocked.get();
+	auto path = expected.get();
+	BOOST_CHECK(path == reference);
+	BOOST_CHECK(future.get() == reference);
+}
+
+BOOST_AUTO_TEST_CASE(workers_read_the_scene_at_calculation_time) {
+	auto& fix = Singleton<PathFixture>::get();
+	fix.reset();
+
+	game::PathSystem system{fix.log};
+	system.addScene(1u, *fix.navi);
+	system.start(1u);
+	auto id = fix.addActor({2u, 3u});
+	auto future = system.schedule(id, 1u, {1u, 3u}, {2, 7});
+	system.calculate(sf::milliseconds(1000u));
+	// note: blocking the path afterwards does not affect the worker
+	fix.addActor({2u, 6u});
+	fix.addActor({1u, 6u});
+	BOOST_REQUIRE(future.valid());
+	auto path = future.get();
+	BOOST_REQUIRE_EQUAL(path.size(), 5u);
+	BOOST_CHECK_VECTOR_EQUAL(path.at(1), sf::Vector2u(2u, 6u));
+	BOOST_CHECK_VECTOR_EQUAL(path.at(0), sf::Vector2u(2u, 7u));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,6 +15,7 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_generator_settings_iterates_all_data) {
 	settings.deadend_density = 0.1f;
 	settings.ambience_density = 0.6f;
 	settings.redundant_paths_ratio = 0.3f;
+	settings.seed = 1234u;
 	
 	// save
 	utils::ptree_type ptree;
@@ -31,6 +32,7 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_generator_settings_iterates_all_data) {
 	BOOST_CHECK_CLOSE(settings.deadend_density, loaded.deadend_density, 0.0001f);
 	BOOST_CHECK_CLOSE(settings.ambience_density, loaded.ambience_density, 0.0001f);
 	BOOST_CHECK_CLOSE(settings.redundant_paths_ratio, loaded.redundant_paths_ratio, 0.0001f);
+	BOOST_CHECK_EQUAL(settings.seed, loaded.seed);
 }
 
 // ---------------------------------------------------------------------------
@@ -48,6 +50,7 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_bot_iterates_all_data) {
 	bot.items.emplace_back("potion", 5.f, nullptr);
 	bot.items.emplace_back("longbow", 1.f, nullptr);
 	bot.perks.emplace_back("fireball", 3.f, nullptr);
+	bot.tick_rate = 400u;
 
 	// save
 	utils::ptree_type ptree;
@@ -62,6 +65,7 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_bot_iterates_all_data) {
 	BOOST_CHECK_EQUAL(loaded.display_name, bot.display_name);
 	BOOST_CHECK_EQUAL(loaded.entity_name, bot.entity_name);
 	BOOST_CHECK_COLOR_EQUAL(loaded.color, bot.color);
+	BOOST_CHECK_EQUAL(loaded.tick_rate, bot.tick_rate);
 	BOOST_CHECK_CLOSE(loaded.attributes[rpg::Attribute::Strength], 45.f, 0.0001f);
 	BOOST_CHECK(loaded.defense == bot.defense);
 	BOOST_CHECK(loaded.properties == bot.properties);
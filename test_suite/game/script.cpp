@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 #include <testsuite/sfml_system.hpp>
 #include <testsuite/singleton.hpp>
@@ -39,9 +40,10 @@ struct ScriptFixture {
 	rpg::ActionSender action_sender;
 	rpg::ItemSender item_sender;
 	game::PathSystem pathfinder;
+	game::NavigationSystem navigation;
 	game::ScriptManager scriptman;
 
-	utils::Script script;
+	game::AiScript script;
 	game::ScriptData& data;
 
 	rpg::EffectTemplate effect;
@@ -76,11 +78,11 @@ struct ScriptFixture {
 		, action_sender{}
 		, item_sender{}
 		, pathfinder{log}
+		, navigation{}
 		, scriptman{}
 		, script{}
 		, data{script_manager.acquire(1u)}
 		, effect{} {
-		utils::bindAll(script);
 		std::string luacode = 
 			"called = '';\n"
 			"args = {};\n"
@@ -254,7 +256,8 @@ struct ScriptFixture {
 		core::ObjectID id{1u};
 		movement.acquire(id);
 		data.api = std::make_unique<game::LuaApi>(log, id, true, session,
-			scriptman, input_sender, action_sender, item_sender, pathfinder);
+			scriptman, input_sender, action_sender, item_sender, pathfinder,
+			navigation);
 		data.script = &script;
 		
 		effect.internal_name = "dummy";
@@ -603,16 +606,151 @@ BOOST_AUTO_TEST_CASE(cycling_update_triggers_onUpdate) {
 	BOOST_REQUIRE_EQUAL(fix.script.get<std::string>("called"), "onUpdate");
 }
 
-/*
+BOOST_AUTO_TEST_CASE(ai_script_resolves_defined_callbacks_only) {
+	game::AiScript script;
+	BOOST_REQUIRE(script.loadFromMemory("calls = 0\n"
+		"onUpdate = function(self)\n"
+		"	calls = calls + 1\n"
+		"end\n"
+		"onIdle = 5\n"));
+	BOOST_CHECK(script.has(game::AiCallback::onUpdate));
+	BOOST_CHECK(!script.has(game::AiCallback::onIdle));
+	BOOST_CHECK(!script.has(game::AiCallback::onTileReached));
+
+	script(game::AiCallback::onUpdate, 0);
+	script(game::AiCallback::onIdle, 0);
+	script(game::AiCallback::onTileReached, 0);
+	BOOST_CHECK_EQUAL(script.get<int>("calls"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ai_script_refreshes_callbacks_on_reload) {
+	game::AiScript script;
+	BOOST_REQUIRE(script.loadFromMemory("called = ''\n"));
+	BOOST_CHECK(!script.has(game::AiCallback::onTileReached));
+
+	BOOST_REQUIRE(script.loadFromMemory("onTileReached = function(self, pos)\n"
+		"	called = 'onTileReached'\n"
+		"end\n"));
+	BOOST_REQUIRE(script.has(game::AiCallback::onTileReached));
+	script(game::AiCallback::onTileReached, 0, sf::Vector2u{1u, 2u});
+	BOOST_CHECK_EQUAL(script.get<std::string>("called"), "onTileReached");
+}
+
+BOOST_AUTO_TEST_CASE(update_phases_are_spread_across_buckets) {
+	auto max = sf::milliseconds(game::script_impl::UPDATE_DELAY);
+	std::vector<sf::Int64> phases;
+	for (core::ObjectID id = 1u; id <= game::script_impl::NUM_BUCKETS; ++id) {
+		auto phase = game::script_impl::getPhase(id);
+		BOOST_CHECK(phase > sf::Time::Zero);
+		BOOST_CHECK(phase <= max);
+		phases.push_back(phase.asMicroseconds());
+	}
+	std::sort(phases.begin(), phases.end());
+	BOOST_CHECK(std::unique(phases.begin(), phases.end()) == phases.end());
+}
+
+BOOST_AUTO_TEST_CASE(first_update_is_delayed_by_bucket_phase) {
+	auto& fix = Singleton<ScriptFixture>::get();
+	fix.reset();
+	fix.context.time = sf::Time::Zero;
+	fix.data.next_update = sf::Time::Zero;
+
+	auto phase = game::script_impl::getPhase(fix.data.id);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::Time::Zero), 0u);
+	BOOST_CHECK_EQUAL(fix.data.next_update.asMicroseconds(), phase.asMicroseconds());
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, phase - sf::microseconds(1)), 0u);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::microseconds(1)), 1u);
+	BOOST_CHECK_EQUAL(fix.script.get<std::string>("called"), "onUpdate");
+}
+
 BOOST_AUTO_TEST_CASE(updates_do_not_take_place_each_frame) {
 	auto& fix = Singleton<ScriptFixture>::get();
 	fix.reset();
+	fix.context.time = sf::Time::Zero;
+	fix.data.next_update = sf::milliseconds(10);
+
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::milliseconds(10)), 1u);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::milliseconds(100)), 0u);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::milliseconds(100)), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_can_declare_its_tick_rate) {
+	auto& fix = Singleton<ScriptFixture>::get();
+	fix.reset();
+
+	fix.data.api->tick_rate = sf::Time::Zero;
+	BOOST_CHECK_EQUAL(game::script_impl::getTickRate(fix.data).asMilliseconds(),
+		game::script_impl::UPDATE_DELAY);
+	BOOST_REQUIRE(fix.script.loadFromMemory("setRate = function(self, ms)\n"
+		"	self:setTickRate(ms);\n"
+		"end"));
+	fix.script("setRate", fix.data.api.get(), 500u);
+	BOOST_CHECK_EQUAL(game::script_impl::getTickRate(fix.data).asMilliseconds(), 500);
+	fix.data.api->tick_rate = sf::Time::Zero;
+}
+
+BOOST_AUTO_TEST_CASE(far_away_actors_are_updated_less_often) {
+	auto& fix = Singleton<ScriptFixture>::get();
+	fix.reset();
+	fix.data.api->tick_rate = sf::Time::Zero;
+	auto& actor = fix.movement.query(fix.data.id);
+	actor.scene = 1u;
+	actor.pos = {2.f, 2.f};
+
+	// no players at all
+	BOOST_CHECK(!game::script_impl::isFar(fix.data));
+
+	core::ObjectID player{2u};
+	fix.player.acquire(player);
+	auto& other = fix.movement.acquire(player);
+	other.scene = 1u;
+	other.pos = {2.f + game::script_impl::FAR_DISTANCE, 2.f};
+	BOOST_CHECK(!game::script_impl::isFar(fix.data));
+	BOOST_CHECK_EQUAL(game::script_impl::getTickRate(fix.data).asMilliseconds(),
+		game::script_impl::UPDATE_DELAY);
+
+	other.pos.x += 1.f;
+	BOOST_CHECK(game::script_impl::isFar(fix.data));
+	BOOST_CHECK_EQUAL(game::script_impl::getTickRate(fix.data).asMilliseconds(),
+		game::script_impl::UPDATE_DELAY * game::script_impl::FAR_TICK_FACTOR);
+
+	// other scene
+	other.pos.x = 2.f;
+	other.scene = 2u;
+	BOOST_CHECK(game::script_impl::isFar(fix.data));
+
+	fix.player.release(player);
+	fix.movement.release(player);
+	fix.player.cleanup();
+	fix.movement.cleanup();
+}
 
-	game::script_impl::update(fix.context, sf::milliseconds(300u));
-	BOOST_CHECK_EQUAL(fix.context.update_delay.asMilliseconds(), 100u);
-	game::script_impl::update(fix.context, sf::milliseconds(80u));
-	BOOST_CHECK_EQUAL(fix.context.update_delay.asMilliseconds(), 180u);
+BOOST_AUTO_TEST_CASE(exceeded_budget_postpones_updates_to_next_frame) {
+	auto& fix = Singleton<ScriptFixture>::get();
+	fix.reset();
+	core::ObjectID id{2u};
+	auto& other = fix.script_manager.acquire(id);
+	other.api = std::make_unique<game::LuaApi>(fix.log, id, true,
+		fix.session, fix.scriptman, fix.input_sender, fix.action_sender,
+		fix.item_sender, fix.pathfinder, fix.navigation);
+	other.script = &fix.script;
+
+	fix.context.time = sf::Time::Zero;
+	fix.context.budget = sf::Time::Zero;
+	fix.data.next_update = sf::milliseconds(10);
+	other.next_update = sf::milliseconds(10);
+
+	// both are due, but only one fits into the budget
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::milliseconds(10)), 1u);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::Time::Zero), 1u);
+	BOOST_CHECK_EQUAL(game::script_impl::update(fix.context, sf::Time::Zero), 0u);
+	BOOST_CHECK(fix.data.next_update > fix.context.time);
+	BOOST_CHECK(other.next_update > fix.context.time);
+
+	fix.context.budget = sf::milliseconds(game::script_impl::UPDATE_BUDGET);
+	fix.context.cursor = 0u;
+	fix.script_manager.release(id);
+	fix.script_manager.cleanup();
 }
-*/
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -66,7 +66,7 @@ struct DelayFixture {
 		auto& d = dungeon[1u];
 		for (auto y = 1u; y < 10u; ++y) {
 			for (auto x = 1u; x < 12u; ++x) {
-				d.getCell({x, y}).terrain = core::Terrain::Floor;
+				d.getTerrain({x, y}) = core::Terrain::Floor;
 			}
 		}
 
@@ -238,12 +238,12 @@ struct GameplayFixture
 			auto& d = dungeon[i];
 			for (auto y = 0u; y < grid_size.y; ++y) {
 				for (auto x = 0u; x < grid_size.x; ++x) {
-					auto& cell = d.getCell({x, y});
+					auto& terrain = d.getTerrain({x, y});
 					if (x == 0u || x == grid_size.x - 1u || y == 0u ||
 						y == grid_size.y - 1u) {
-						cell.terrain = core::Terrain::Wall;
+						terrain = core::Terrain::Wall;
 					} else {
-						cell.terrain = core::Terrain::Floor;
+						terrain = core::Terrain::Floor;
 					}
 				}
 			}
@@ -368,9 +368,9 @@ struct GameplayFixture
 					cell.entities.clear();
 					cell.trigger = nullptr;
 					if (x == 0u || x == 9u || y == 0u || y == 9u) {
-						cell.terrain = core::Terrain::Wall;
+						d.getTerrain({x, y}) = core::Terrain::Wall;
 					} else {
-						cell.terrain = core::Terrain::Floor;
+						d.getTerrain({x, y}) = core::Terrain::Floor;
 					}
 				}
 			}
@@ -679,30 +679,34 @@ BOOST_AUTO_TEST_CASE(equip_helmet_triggers_sprite_update) {
 BOOST_AUTO_TEST_CASE(cannot_drop_if_ratio_is_negative) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 
 	BOOST_CHECK_ASSERT(
-		rpg::dropItems(actor, corpse, 1u, -0.1f, rpg::drop::byQuantity));
+		rpg::dropItems(actor, corpse, 1u, -0.1f, rpg::drop::byQuantity, rng));
 }
 
 BOOST_AUTO_TEST_CASE(cannot_drop_if_ratio_is_larger_than_1) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 
 	BOOST_CHECK_ASSERT(
-		rpg::dropItems(actor, corpse, 1u, 1.1f, rpg::drop::byQuantity));
+		rpg::dropItems(actor, corpse, 1u, 1.1f, rpg::drop::byQuantity, rng));
 }
 
 BOOST_AUTO_TEST_CASE(can_drop_if_preconditions_satisfied) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 
 	BOOST_CHECK_NO_ASSERT(
-		rpg::dropItems(actor, corpse, 1u, 0.7f, rpg::drop::byQuantity));
+		rpg::dropItems(actor, corpse, 1u, 0.7f, rpg::drop::byQuantity, rng));
 }
 
 BOOST_AUTO_TEST_CASE(all_items_can_be_dropped) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 	rpg::ItemTemplate foo, bar;
 
 	// prepare loot
@@ -710,7 +714,7 @@ BOOST_AUTO_TEST_CASE(all_items_can_be_dropped) {
 	actor.inventory[rpg::ItemType::Potion].emplace_back(bar, 11u);
 
 	// drop items
-	rpg::dropItems(actor, corpse, 1u, 1.f, rpg::drop::byQuantity);
+	rpg::dropItems(actor, corpse, 1u, 1.f, rpg::drop::byQuantity, rng);
 
 	// expect all items
 	BOOST_REQUIRE_EQUAL(corpse.loot[0].size(), 2u);
@@ -729,6 +733,7 @@ BOOST_AUTO_TEST_CASE(all_items_can_be_dropped) {
 BOOST_AUTO_TEST_CASE(only_some_items_can_be_dropped) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 	rpg::ItemTemplate foo, bar;
 
 	// prepare loot
@@ -736,7 +741,7 @@ BOOST_AUTO_TEST_CASE(only_some_items_can_be_dropped) {
 	actor.inventory[rpg::ItemType::Potion].emplace_back(bar, 5u);
 
 	// drop items
-	rpg::dropItems(actor, corpse, 1u, 0.65f, rpg::drop::byQuantity);
+	rpg::dropItems(actor, corpse, 1u, 0.65f, rpg::drop::byQuantity, rng);
 
 	// count items
 	std::size_t total = 0u;
@@ -749,9 +754,10 @@ BOOST_AUTO_TEST_CASE(only_some_items_can_be_dropped) {
 BOOST_AUTO_TEST_CASE(nothing_is_dropped_if_no_items_given) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 
 	// drop items
-	rpg::dropItems(actor, corpse, 1u, 1.f, rpg::drop::byQuantity);
+	rpg::dropItems(actor, corpse, 1u, 1.f, rpg::drop::byQuantity, rng);
 
 	BOOST_CHECK(corpse.loot[0].empty());
 }
@@ -759,6 +765,7 @@ BOOST_AUTO_TEST_CASE(nothing_is_dropped_if_no_items_given) {
 BOOST_AUTO_TEST_CASE(can_drop_equally) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 	rpg::ItemTemplate foo, bar;
 
 	// prepare loot
@@ -766,7 +773,7 @@ BOOST_AUTO_TEST_CASE(can_drop_equally) {
 	actor.inventory[rpg::ItemType::Potion].emplace_back(bar, 5u);
 
 	// drop items
-	rpg::dropItems(actor, corpse, 3u, 1.f, rpg::drop::byQuantity);
+	rpg::dropItems(actor, corpse, 3u, 1.f, rpg::drop::byQuantity, rng);
 
 	// count items
 	std::array<std::size_t, 3u> num_items;
@@ -784,6 +791,7 @@ BOOST_AUTO_TEST_CASE(can_drop_equally) {
 BOOST_AUTO_TEST_CASE(can_drop_nearly_equal) {
 	rpg::ItemData actor;
 	rpg::InteractData corpse;
+	utils::RandomStream rng;
 	rpg::ItemTemplate foo, bar;
 
 	// prepare loot
@@ -791,7 +799,7 @@ BOOST_AUTO_TEST_CASE(can_drop_nearly_equal) {
 	actor.inventory[rpg::ItemType::Potion].emplace_back(bar, 5u);
 
 	// drop items
-	rpg::dropItems(actor, corpse, 4u, 1.f, rpg::drop::byQuantity);
+	rpg::dropItems(actor, corpse, 4u, 1.f, rpg::drop::byQuantity, rng);
 
 	// count items
 	std::array<std::size_t, 4u> num_items;
@@ -816,4 +824,32 @@ BOOST_AUTO_TEST_CASE(can_drop_nearly_equal) {
 	BOOST_CHECK_EQUAL(histo[6], 0u);  // 0x six items
 }
 
+BOOST_AUTO_TEST_CASE(same_seed_drops_same_loot) {
+	rpg::ItemTemplate foo, bar, baz;
+	std::vector<rpg::Item> expected;
+	for (auto k = 0u; k < 2u; ++k) {
+		rpg::ItemData actor;
+		rpg::InteractData corpse;
+		utils::RandomStream rng{42u};
+
+		// prepare loot
+		actor.inventory[rpg::ItemType::Weapon].emplace_back(foo, 1u);
+		actor.inventory[rpg::ItemType::Armor].emplace_back(bar, 1u);
+		actor.inventory[rpg::ItemType::Potion].emplace_back(baz, 3u);
+
+		// drop items
+		rpg::dropItems(actor, corpse, 1u, 1.f, rpg::drop::byQuantity, rng);
+		if (k == 0u) {
+			expected = corpse.loot[0];
+			continue;
+		}
+		// expect same order
+		BOOST_REQUIRE_EQUAL(corpse.loot[0].size(), expected.size());
+		for (auto i = 0u; i < expected.size(); ++i) {
+			BOOST_CHECK_EQUAL(corpse.loot[0][i].item, expected[i].item);
+			BOOST_CHECK_EQUAL(corpse.loot[0][i].quantity, expected[i].quantity);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
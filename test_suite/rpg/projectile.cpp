@@ -51,7 +51,7 @@ struct ProjectileFixture {
 		auto& dungeon = dungeon_system[1u];
 		for (auto y = 1u; y < 10u; ++y) {
 			for (auto x = 1u; x < 10u; ++x) {
-				dungeon.getCell({x, y}).terrain = core::Terrain::Floor;
+				dungeon.getTerrain({x, y}) = core::Terrain::Floor;
 			}
 		}
 		// setup bullet template
@@ -50,6 +50,8 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_global_settings_iterates_all_data) {
 	settings.ui_menu_sfx_undo = "undooo";
 	settings.player_colors = {sf::Color::Yellow, sf::Color::Black};
 	settings.max_num_objects = 100u;
+	settings.path_workers = 2u;
+	settings.tick_rate = 60u;
 	settings.max_num_players = settings.player_colors.size();
 	settings.framelimit = 200u;
 	settings.audio_poolsize = 64u;
@@ -104,6 +106,8 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_global_settings_iterates_all_data) {
 	BOOST_CHECK_EQUAL(settings.ui_menu_sfx_undo, loaded.ui_menu_sfx_undo);
 	BOOST_CHECK(settings.player_colors == loaded.player_colors);
 	BOOST_CHECK_EQUAL(settings.max_num_objects, loaded.max_num_objects);
+	BOOST_CHECK_EQUAL(settings.path_workers, loaded.path_workers);
+	BOOST_CHECK_EQUAL(settings.tick_rate, loaded.tick_rate);
 	BOOST_CHECK_EQUAL(settings.max_num_players, loaded.max_num_players);
 	BOOST_CHECK_EQUAL(settings.framelimit, loaded.framelimit);
 	BOOST_CHECK_EQUAL(settings.audio_poolsize, loaded.audio_poolsize);
@@ -126,6 +130,18 @@ BOOST_AUTO_TEST_CASE(saving_and_loading_global_settings_iterates_all_data) {
 	BOOST_CHECK(settings.difficulty == loaded.difficulty);
 }
 
+BOOST_AUTO_TEST_CASE(loading_too_slow_tick_rate_is_raised_to_minimum) {
+	state::GlobalSettings settings;
+	utils::ptree_type ptree;
+	settings.saveToTree(ptree);
+	ptree.put("engine.<xmlattr>.tick_rate", 10u);
+	
+	state::GlobalSettings loaded;
+	BOOST_REQUIRE_NO_THROW(loaded.loadFromTree(ptree));
+	BOOST_CHECK_EQUAL(loaded.tick_rate, state::getMinTickRate());
+	BOOST_CHECK_EQUAL(state::getMinTickRate(), 40u);
+}
+
 // --------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(saving_and_loading_settings_iterates_all_data) {
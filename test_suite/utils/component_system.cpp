@@ -10,6 +10,20 @@ struct TestComponent {
 using TestManager = utils::IdManager<std::size_t>;
 using TestSystem = utils::ComponentSystem<std::size_t, TestComponent>;
 
+struct TestNotifySystem : TestSystem {
+	std::vector<std::size_t> spawned, released;
+
+	TestNotifySystem(std::size_t n) : TestSystem{n}, spawned{}, released{} {}
+
+	void onSpawned(TestComponent& data) override { spawned.push_back(data.id); }
+
+	void onReleased(TestComponent const& data) override {
+		released.push_back(data.id);
+	}
+
+	using TestSystem::notifySpawned;
+};
+
 // ----------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE(component_test)
@@ -257,4 +271,44 @@ BOOST_AUTO_TEST_CASE(component_iterate_over_existing_objectset) {
 	BOOST_CHECK(i == const_sys.end());
 }
 
+BOOST_AUTO_TEST_CASE(component_notify_spawned_passes_recent_objects_once) {
+	TestNotifySystem system{10u};
+	system.acquire(3u);
+	system.acquire(1u);
+	system.notifySpawned();
+	system.acquire(5u);
+	system.notifySpawned();
+	system.notifySpawned();
+	std::vector<std::size_t> expected{3u, 1u, 5u};
+	BOOST_CHECK(expected == system.spawned);
+}
+
+BOOST_AUTO_TEST_CASE(component_cleanup_notifies_released_objects) {
+	TestNotifySystem system{10u};
+	system.acquire(3u);
+	system.acquire(1u);
+	system.release(3u);
+	BOOST_CHECK(system.released.empty());
+	system.cleanup();
+	std::vector<std::size_t> expected{3u};
+	BOOST_CHECK(expected == system.released);
+}
+
+BOOST_AUTO_TEST_CASE(component_cleanup_notifies_pending_object_moved_forward) {
+	TestNotifySystem system{10u};
+	system.acquire(3u);
+	system.acquire(1u);
+	system.notifySpawned();
+	system.acquire(5u);
+	system.release(3u);
+	system.cleanup();
+	// 5 took the place of 3
+	std::vector<std::size_t> expected{3u, 1u, 5u};
+	BOOST_CHECK(expected == system.spawned);
+	system.acquire(7u);
+	system.notifySpawned();
+	expected.push_back(7u);
+	BOOST_CHECK(expected == system.spawned);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,197 @@
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <utils/event_channel.hpp>
+#include <utils/job_system.hpp>
+
+namespace channel_test {
+
+struct Event {
+	std::size_t value;
+
+	Event(std::size_t value = 0u) : value{value} {}
+};
+
+struct Handler {
+	std::vector<std::size_t> values;
+
+	void handle(Event const& event) { values.push_back(event.value); }
+};
+
+using Channel = utils::EventChannel<Event>;
+
+}  // ::channel_test
+
+using namespace channel_test;
+
+BOOST_AUTO_TEST_SUITE(event_channel_test)
+
+BOOST_AUTO_TEST_CASE(events_are_not_visible_before_publish) {
+	Channel channel{1u};
+	Channel::Reader reader;
+	channel.bind(reader);
+
+	channel[0u].send(Event{1u});
+	channel[0u].send(Event{2u});
+	BOOST_CHECK_EQUAL(reader.size(), 0u);
+
+	channel.publish();
+	BOOST_CHECK_EQUAL(reader.size(), 2u);
+	BOOST_CHECK(channel[0u].data().empty());
+}
+
+BOOST_AUTO_TEST_CASE(events_are_published_in_producer_order) {
+	Channel channel{3u};
+	Channel::Reader reader;
+	channel.bind(reader);
+
+	channel[2u].send(Event{5u});
+	channel[0u].send(Event{1u});
+	channel[1u].send(Event{3u});
+	channel[0u].send(Event{2u});
+	channel[2u].send(Event{6u});
+	channel[1u].send(Event{4u});
+	channel.publish();
+
+	Handler handler;
+	reader.dispatch(handler);
+	std::vector<std::size_t> expected{1u, 2u, 3u, 4u, 5u, 6u};
+	BOOST_CHECK(handler.values == expected);
+}
+
+BOOST_AUTO_TEST_CASE(each_reader_receives_all_events_in_order) {
+	Channel channel{2u};
+	Channel::Reader first, second;
+	channel.bind(first);
+	channel.bind(second);
+
+	for (auto i = 0u; i < 10u; ++i) {
+		channel[i / 5u].send(Event{i});
+	}
+	channel.publish();
+
+	Handler a, b;
+	first.dispatch(a);
+	second.dispatch(b);
+	BOOST_REQUIRE_EQUAL(a.values.size(), 10u);
+	BOOST_REQUIRE_EQUAL(b.values.size(), 10u);
+	for (auto i = 0u; i < 10u; ++i) {
+		BOOST_CHECK_EQUAL(a.values[i], i);
+		BOOST_CHECK_EQUAL(b.values[i], i);
+	}
+	BOOST_CHECK_EQUAL(first.size(), 0u);
+	BOOST_CHECK_EQUAL(second.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_is_kept_until_all_readers_caught_up) {
+	Channel channel{1u};
+	Channel::Reader fast, slow;
+	channel.bind(fast);
+	channel.bind(slow);
+
+	channel[0u].send(Event{1u});
+	channel.publish();
+	Handler a;
+	fast.dispatch(a);
+
+	channel[0u].send(Event{2u});
+	channel.publish();
+	BOOST_CHECK_EQUAL(channel.data().size(), 2u);
+	BOOST_CHECK_EQUAL(fast.size(), 1u);
+	BOOST_CHECK_EQUAL(slow.size(), 2u);
+
+	Handler b;
+	fast.dispatch(a);
+	slow.dispatch(b);
+	channel[0u].send(Event{3u});
+	channel.publish();
+	BOOST_CHECK_EQUAL(channel.data().size(), 1u);
+	fast.dispatch(a);
+	slow.dispatch(b);
+	std::vector<std::size_t> expected{1u, 2u, 3u};
+	BOOST_CHECK(a.values == expected);
+	BOOST_CHECK(b.values == expected);
+}
+
+BOOST_AUTO_TEST_CASE(reader_only_sees_events_published_after_binding) {
+	Channel channel{1u};
+	Channel::Reader early, late;
+	channel.bind(early);
+
+	channel[0u].send(Event{1u});
+	channel.publish();
+	channel.bind(late);
+	BOOST_CHECK_EQUAL(late.size(), 0u);
+
+	channel[0u].send(Event{2u});
+	channel.publish();
+	Handler handler;
+	late.dispatch(handler);
+	BOOST_REQUIRE_EQUAL(handler.values.size(), 1u);
+	BOOST_CHECK_EQUAL(handler.values[0], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(unbound_reader_does_not_block_reset) {
+	Channel channel{1u};
+	Channel::Reader reader;
+	{
+		Channel::Reader other;
+		channel.bind(reader);
+		channel.bind(other);
+		channel[0u].send(Event{1u});
+		channel.publish();
+		Handler handler;
+		reader.dispatch(handler);
+	}
+	channel[0u].send(Event{2u});
+	channel.publish();
+	BOOST_CHECK_EQUAL(channel.data().size(), 1u);
+
+	channel.unbind(reader);
+	BOOST_CHECK_EQUAL(reader.size(), 0u);
+	BOOST_CHECK_ASSERT(channel.unbind(reader));
+}
+
+BOOST_AUTO_TEST_CASE(resizing_keeps_remaining_producers) {
+	Channel channel{1u};
+	Channel::Reader reader;
+	channel.bind(reader);
+
+	channel[0u].send(Event{1u});
+	channel.resize(2u);
+	BOOST_CHECK_EQUAL(channel.getNumProducers(), 2u);
+	channel[1u].send(Event{2u});
+	channel.publish();
+
+	Handler handler;
+	reader.dispatch(handler);
+	std::vector<std::size_t> expected{1u, 2u};
+	BOOST_CHECK(handler.values == expected);
+	BOOST_CHECK_ASSERT(channel[2u]);
+}
+
+BOOST_AUTO_TEST_CASE(jobs_can_send_to_their_producers_at_the_same_time) {
+	std::size_t const num_jobs = 8u, num_events = 1000u;
+	Channel channel{num_jobs};
+	Channel::Reader reader;
+	channel.bind(reader);
+	utils::JobSystem jobs{4u};
+
+	for (auto frame = 0u; frame < 3u; ++frame) {
+		jobs.run(num_jobs, [&](std::size_t i) {
+			for (auto j = 0u; j < num_events; ++j) {
+				channel[i].send(Event{i * num_events + j});
+			}
+		});
+		channel.publish();
+
+		Handler handler;
+		reader.dispatch(handler);
+		BOOST_REQUIRE_EQUAL(handler.values.size(), num_jobs * num_events);
+		for (auto i = 0u; i < handler.values.size(); ++i) {
+			BOOST_CHECK_EQUAL(handler.values[i], i);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <utils/fixed_timestep.hpp>
+
+BOOST_AUTO_TEST_SUITE(fixed_timestep_test)
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_calls_func_with_constant_step) {
+	utils::FixedTimestep sim{sf::milliseconds(10), 10u};
+	std::vector<sf::Time> steps;
+	auto n = sim.update(sf::milliseconds(35), [&](sf::Time const& t) {
+		steps.push_back(t);
+	});
+	BOOST_CHECK_EQUAL(n, 3u);
+	BOOST_REQUIRE_EQUAL(steps.size(), 3u);
+	for (auto const& t : steps) {
+		BOOST_CHECK_EQUAL(t.asMilliseconds(), 10);
+	}
+	BOOST_CHECK_EQUAL(sim.getRemainder().asMilliseconds(), 5);
+	BOOST_CHECK_CLOSE(sim.getAlpha(), 0.5f, 0.001f);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_accumulates_short_frames) {
+	utils::FixedTimestep sim{sf::milliseconds(10), 10u};
+	std::size_t ticks{0u};
+	auto func = [&](sf::Time const&) { ++ticks; };
+	BOOST_CHECK_EQUAL(sim.update(sf::milliseconds(4), func), 0u);
+	BOOST_CHECK_EQUAL(sim.update(sf::milliseconds(4), func), 0u);
+	BOOST_CHECK_EQUAL(sim.update(sf::milliseconds(4), func), 1u);
+	BOOST_CHECK_EQUAL(ticks, 1u);
+	BOOST_CHECK_EQUAL(sim.getNumTicks(), 1u);
+	BOOST_CHECK_EQUAL(sim.getRemainder().asMilliseconds(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_is_independent_of_frame_slicing) {
+	utils::FixedTimestep a{sf::milliseconds(10), 100u};
+	utils::FixedTimestep b{sf::milliseconds(10), 100u};
+	auto func = [](sf::Time const&) {};
+	a.update(sf::milliseconds(500), func);
+	for (auto i = 0u; i < 50u; ++i) {
+		b.update(sf::milliseconds(7), func);
+		b.update(sf::milliseconds(3), func);
+	}
+	BOOST_CHECK_EQUAL(a.getNumTicks(), 50u);
+	BOOST_CHECK_EQUAL(b.getNumTicks(), 50u);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_caps_catch_up_ticks) {
+	utils::FixedTimestep sim{sf::milliseconds(10), 3u};
+	std::size_t ticks{0u};
+	auto n = sim.update(sf::milliseconds(57), [&](sf::Time const&) { ++ticks; });
+	BOOST_CHECK_EQUAL(n, 3u);
+	BOOST_CHECK_EQUAL(ticks, 3u);
+	BOOST_CHECK_EQUAL(sim.getDroppedTime().asMilliseconds(), 20);
+	BOOST_CHECK_EQUAL(sim.getRemainder().asMilliseconds(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_tick_rate_sets_step) {
+	utils::FixedTimestep sim{sf::milliseconds(10), 3u};
+	sim.setTickRate(40u);
+	BOOST_CHECK_EQUAL(sim.getStep().asMilliseconds(), 25);
+	sim.setTickRate(50u);
+	BOOST_CHECK_EQUAL(sim.getStep().asMilliseconds(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_timestep_records_histogram_per_system) {
+	utils::FixedTimestep sim{sf::milliseconds(10), 3u};
+	sim.record("physics", sf::microseconds(100));
+	sim.record("physics", sf::microseconds(300));
+	sim.record("ai", sf::microseconds(50));
+	auto const& hists = sim.getHistograms();
+	BOOST_REQUIRE_EQUAL(hists.size(), 2u);
+	BOOST_CHECK_EQUAL(hists.at("physics").getCount(), 2u);
+	BOOST_CHECK_EQUAL(hists.at("ai").getCount(), 1u);
+	sim.reset();
+	BOOST_CHECK(sim.getHistograms().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
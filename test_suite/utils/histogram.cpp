@@ -0,0 +1,62 @@
+#include <boost/test/unit_test.hpp>
+
+#include <utils/histogram.hpp>
+
+BOOST_AUTO_TEST_SUITE(histogram_test)
+
+BOOST_AUTO_TEST_CASE(empty_histogram_yields_zero) {
+	utils::Histogram hist;
+	BOOST_CHECK_EQUAL(hist.getCount(), 0u);
+	BOOST_CHECK(hist.getMin() == sf::Time::Zero);
+	BOOST_CHECK(hist.getMax() == sf::Time::Zero);
+	BOOST_CHECK(hist.getMean() == sf::Time::Zero);
+	BOOST_CHECK(hist.getPercentile(0.5f) == sf::Time::Zero);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_tracks_min_max_and_mean) {
+	utils::Histogram hist;
+	hist.add(sf::microseconds(300));
+	hist.add(sf::microseconds(100));
+	hist.add(sf::microseconds(200));
+	BOOST_CHECK_EQUAL(hist.getCount(), 3u);
+	BOOST_CHECK_EQUAL(hist.getMin().asMicroseconds(), 100);
+	BOOST_CHECK_EQUAL(hist.getMax().asMicroseconds(), 300);
+	BOOST_CHECK_EQUAL(hist.getMean().asMicroseconds(), 200);
+	BOOST_CHECK_EQUAL(hist.getTotal().asMicroseconds(), 600);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_counts_samples_by_power_of_two) {
+	utils::Histogram hist;
+	hist.add(sf::Time::Zero);
+	hist.add(sf::microseconds(1));
+	hist.add(sf::microseconds(2));
+	hist.add(sf::microseconds(3));
+	hist.add(sf::microseconds(4));
+	BOOST_CHECK_EQUAL(hist.getBucket(0u), 1u);
+	BOOST_CHECK_EQUAL(hist.getBucket(1u), 1u);
+	BOOST_CHECK_EQUAL(hist.getBucket(2u), 2u);
+	BOOST_CHECK_EQUAL(hist.getBucket(3u), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_percentile_is_bounded_by_bucket) {
+	utils::Histogram hist;
+	for (auto i = 0u; i < 99u; ++i) {
+		hist.add(sf::microseconds(100));
+	}
+	hist.add(sf::milliseconds(50));
+	// 100us is located within [64, 128)
+	BOOST_CHECK_EQUAL(hist.getPercentile(0.5f).asMicroseconds(), 127);
+	BOOST_CHECK_EQUAL(hist.getPercentile(0.99f).asMicroseconds(), 127);
+	BOOST_CHECK_EQUAL(hist.getPercentile(1.f).asMicroseconds(), 50000);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_can_be_cleared) {
+	utils::Histogram hist;
+	hist.add(sf::microseconds(10));
+	hist.clear();
+	BOOST_CHECK_EQUAL(hist.getCount(), 0u);
+	BOOST_CHECK_EQUAL(hist.getBucket(4u), 0u);
+	BOOST_CHECK(hist.getMax() == sf::Time::Zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
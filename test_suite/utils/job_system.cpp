@@ -0,0 +1,48 @@
+#include <atomic>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <utils/job_system.hpp>
+
+BOOST_AUTO_TEST_SUITE(job_system_test)
+
+BOOST_AUTO_TEST_CASE(job_system_size_includes_calling_thread) {
+	utils::JobSystem none;
+	utils::JobSystem some{3u};
+	BOOST_CHECK_EQUAL(none.size(), 1u);
+	BOOST_CHECK_EQUAL(some.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(job_system_without_workers_runs_jobs_in_order) {
+	utils::JobSystem jobs;
+	std::vector<std::size_t> order;
+	jobs.run(5u, [&](std::size_t i) { order.push_back(i); });
+	BOOST_REQUIRE_EQUAL(order.size(), 5u);
+	for (auto i = 0u; i < order.size(); ++i) {
+		BOOST_CHECK_EQUAL(order[i], i);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(job_system_runs_each_job_exactly_once) {
+	utils::JobSystem jobs{3u};
+	std::vector<std::atomic<int>> calls(100u);
+	for (auto& c : calls) {
+		c = 0;
+	}
+	// several batches to reuse the workers
+	for (auto n = 0u; n < 20u; ++n) {
+		jobs.run(calls.size(), [&](std::size_t i) { ++calls[i]; });
+	}
+	for (auto const& c : calls) {
+		BOOST_CHECK_EQUAL(c.load(), 20);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(job_system_can_run_empty_batch) {
+	utils::JobSystem jobs{2u};
+	bool called{false};
+	jobs.run(0u, [&](std::size_t i) { called = true; });
+	BOOST_CHECK(!called);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
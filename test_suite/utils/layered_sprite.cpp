@@ -0,0 +1,84 @@
+#include <boost/test/unit_test.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <testsuite/sfml_system.hpp>
+
+#include <utils/layered_sprite.hpp>
+
+namespace layered_sprite_test {
+enum class Layer { Bottom = 0u, Middle, Top };
+}
+
+SET_ENUM_LIMITS(layered_sprite_test::Layer::Bottom,
+	layered_sprite_test::Layer::Top);
+
+using layered_sprite_test::Layer;
+
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(layered_sprite_test)
+
+BOOST_AUTO_TEST_CASE(layers_without_texture_or_rect_are_not_occupied) {
+	sf::Texture texture;
+	utils::LayeredSprite<Layer> sprite;
+	BOOST_CHECK_EQUAL(sprite.getMask(), 0u);
+	sprite[Layer::Middle].setTexture(texture);
+	sprite[Layer::Middle].setTextureRect({0, 0, 10, 5});
+	sprite[Layer::Top].setTexture(texture);
+	sprite[Layer::Top].setTextureRect({});
+	BOOST_CHECK_EQUAL(sprite.getMask(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(occupancy_is_updated_after_write_access) {
+	sf::Texture texture;
+	utils::LayeredSprite<Layer> sprite;
+	sprite[Layer::Bottom].setTexture(texture);
+	sprite[Layer::Bottom].setTextureRect({0, 0, 10, 5});
+	BOOST_CHECK_EQUAL(sprite.getMask(), 1u);
+	sprite[Layer::Bottom].setTextureRect({});
+	BOOST_CHECK_EQUAL(sprite.getMask(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(sprite_is_invisible_if_all_occupied_layers_are_transparent) {
+	sf::Texture texture;
+	utils::LayeredSprite<Layer> sprite;
+	BOOST_CHECK(!sprite.isVisible());
+	sprite[Layer::Bottom].setTexture(texture);
+	sprite[Layer::Bottom].setTextureRect({0, 0, 10, 5});
+	BOOST_CHECK(sprite.isVisible());
+	sprite[Layer::Bottom].setColor(sf::Color::Transparent);
+	BOOST_CHECK(!sprite.isVisible());
+	// an unoccupied layer does not count
+	sprite[Layer::Top].setColor(sf::Color::White);
+	BOOST_CHECK(!sprite.isVisible());
+}
+
+BOOST_AUTO_TEST_CASE(bounds_cover_all_occupied_layers) {
+	sf::Texture texture;
+	utils::LayeredSprite<Layer> sprite;
+	sprite[Layer::Bottom].setTexture(texture);
+	sprite[Layer::Bottom].setTextureRect({0, 0, 10, 5});
+	sprite[Layer::Top].setTexture(texture);
+	sprite[Layer::Top].setTextureRect({0, 0, 4, 20});
+	sprite[Layer::Top].setPosition(-2.f, 0.f);
+	sf::Transform matrix;
+	matrix.translate(100.f, 50.f);
+	auto bounds = sprite.getBounds(matrix);
+	BOOST_CHECK_CLOSE(bounds.left, 98.f, 0.0001f);
+	BOOST_CHECK_CLOSE(bounds.top, 50.f, 0.0001f);
+	BOOST_CHECK_CLOSE(bounds.width, 12.f, 0.0001f);
+	BOOST_CHECK_CLOSE(bounds.height, 20.f, 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(batching_skips_unoccupied_layers) {
+	sf::Texture texture;
+	utils::LayeredSprite<Layer> sprite;
+	sprite[Layer::Top].setTexture(texture);
+	sprite[Layer::Top].setTextureRect({0, 0, 10, 5});
+	utils::SpriteBatch batch;
+	sprite.batch(batch, sf::Transform::Identity);
+	BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+	BOOST_CHECK_EQUAL(batch.getNumSprites(), 1u);
+	BOOST_CHECK(batch[0].texture == &texture);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
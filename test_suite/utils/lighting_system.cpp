@@ -4,6 +4,31 @@
 #include <utils/assert.hpp>
 #include <utils/lighting_system.hpp>
 
+namespace lighting_test {
+
+void addBox(std::vector<utils::Edge>& edges, sf::FloatRect const & box) {
+	// like OrthoTile's edges
+	sf::Vector2f corners[4] = {{box.left, box.top},
+		{box.left + box.width, box.top},
+		{box.left + box.width, box.top + box.height},
+		{box.left, box.top + box.height}};
+	for (auto i = 0u; i < 4u; ++i) {
+		utils::Edge edge;
+		edge.u = corners[i];
+		edge.v = corners[(i + 1u) % 4u];
+		edges.push_back(edge);
+	}
+}
+
+utils::Edge makeEdge(sf::Vector2f const & u, sf::Vector2f const & v) {
+	utils::Edge edge;
+	edge.u = u;
+	edge.v = v;
+	return edge;
+}
+
+}  // ::lighting_test
+
 // ----------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE(LightingSystem_test)
@@ -60,4 +85,189 @@ BOOST_AUTO_TEST_CASE(
 	BOOST_CHECK_GE(result.x, 50.f);
 }
 
+BOOST_AUTO_TEST_CASE(LightingSystem_mergeEdges_joins_edges_of_adjacent_walls) {
+	std::vector<utils::Edge> edges;
+	lighting_test::addBox(edges, {0.f, 0.f, 32.f, 32.f});
+	lighting_test::addBox(edges, {32.f, 0.f, 32.f, 32.f});
+	lighting_test::addBox(edges, {64.f, 0.f, 32.f, 32.f});
+	utils::mergeEdges(edges);
+
+	// two horizontal lines, four vertical edges
+	BOOST_REQUIRE_EQUAL(edges.size(), 6u);
+	BOOST_CHECK(edges[0] == lighting_test::makeEdge({0.f, 0.f}, {96.f, 0.f}));
+	BOOST_CHECK(edges[1] == lighting_test::makeEdge({0.f, 32.f}, {96.f, 32.f}));
+	BOOST_CHECK(edges[2] == lighting_test::makeEdge({0.f, 0.f}, {0.f, 32.f}));
+	BOOST_CHECK(edges[5] == lighting_test::makeEdge({96.f, 0.f}, {96.f, 32.f}));
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_mergeEdges_keeps_separated_edges) {
+	std::vector<utils::Edge> edges;
+	edges.push_back(lighting_test::makeEdge({40.f, 10.f}, {30.f, 10.f}));
+	edges.push_back(lighting_test::makeEdge({0.f, 10.f}, {20.f, 10.f}));
+	edges.push_back(lighting_test::makeEdge({0.f, 0.f}, {20.f, 20.f}));
+	edges.push_back(lighting_test::makeEdge({5.f, 5.f}, {5.f, 5.f}));
+	utils::mergeEdges(edges);
+
+	BOOST_REQUIRE_EQUAL(edges.size(), 3u);
+	BOOST_CHECK(edges[0] == lighting_test::makeEdge({0.f, 10.f}, {20.f, 10.f}));
+	BOOST_CHECK(edges[1] == lighting_test::makeEdge({30.f, 10.f}, {40.f, 10.f}));
+	BOOST_CHECK(edges[2] == lighting_test::makeEdge({0.f, 0.f}, {20.f, 20.f}));
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_clipEdges_drops_and_clips_edges) {
+	std::vector<utils::Edge> edges, result;
+	edges.push_back(lighting_test::makeEdge({-50.f, 5.f}, {50.f, 5.f}));
+	edges.push_back(lighting_test::makeEdge({-5.f, 3.f}, {-5.f, 8.f}));
+	edges.push_back(lighting_test::makeEdge({15.f, -50.f}, {15.f, 50.f}));
+	utils::clipEdges({0.f, 0.f}, 10.f, edges, result);
+
+	BOOST_REQUIRE_EQUAL(result.size(), 2u);
+	BOOST_CHECK_VECTOR_CLOSE(result[0].u, sf::Vector2f(-10.f, 5.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(result[0].v, sf::Vector2f(10.f, 5.f), 0.0001f);
+	BOOST_CHECK(result[1] == edges[1]);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_clipEdges_uses_subset_of_indices) {
+	std::vector<utils::Edge> edges, result;
+	edges.push_back(lighting_test::makeEdge({-50.f, 5.f}, {50.f, 5.f}));
+	edges.push_back(lighting_test::makeEdge({-5.f, 3.f}, {-5.f, 8.f}));
+	edges.push_back(lighting_test::makeEdge({2.f, -3.f}, {2.f, 3.f}));
+	std::vector<std::size_t> indices{1u, 0u, 2u};
+	utils::EdgeRange subset;
+	subset.first = 1u;
+	subset.last = 3u;
+	utils::clipEdges({0.f, 0.f}, 10.f, edges, indices, subset, result);
+
+	BOOST_REQUIRE_EQUAL(result.size(), 2u);
+	BOOST_CHECK_VECTOR_CLOSE(result[0].u, sf::Vector2f(-10.f, 5.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(result[0].v, sf::Vector2f(10.f, 5.f), 0.0001f);
+	BOOST_CHECK(result[1] == edges[2]);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_selectEdges_appends_indices_of_nearby_edges) {
+	std::vector<utils::Edge> edges;
+	edges.push_back(lighting_test::makeEdge({-50.f, 5.f}, {50.f, 5.f}));
+	edges.push_back(lighting_test::makeEdge({15.f, -50.f}, {15.f, 50.f}));
+	edges.push_back(lighting_test::makeEdge({10.f, 3.f}, {10.f, 8.f}));
+	edges.push_back(lighting_test::makeEdge({-5.f, -30.f}, {5.f, -30.f}));
+	std::vector<std::size_t> indices{42u};
+	utils::selectEdges({0.f, 0.f}, 10.f, edges, indices);
+
+	// edges touching the border are selected, too
+	BOOST_REQUIRE_EQUAL(indices.size(), 3u);
+	BOOST_CHECK_EQUAL(indices[0], 42u);
+	BOOST_CHECK_EQUAL(indices[1], 0u);
+	BOOST_CHECK_EQUAL(indices[2], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_computeVisibility_without_edges_covers_square) {
+	sf::Vector2f origin{100.f, 50.f};
+	std::vector<utils::Edge> edges;
+	std::vector<sf::Vector2f> fan;
+	utils::computeVisibility(origin, 20.f, edges, fan);
+
+	// three rays per corner, plus origin and closing point
+	BOOST_REQUIRE_EQUAL(fan.size(), 14u);
+	BOOST_CHECK_VECTOR_EQUAL(fan.front(), origin);
+	BOOST_CHECK_VECTOR_EQUAL(fan.back(), fan[1u]);
+	for (auto i = 1u; i < fan.size(); ++i) {
+		auto delta = fan[i] - origin;
+		auto dist = std::max(std::abs(delta.x), std::abs(delta.y));
+		BOOST_CHECK_CLOSE(dist, 20.f, 0.01f);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_computeVisibility_hides_area_behind_edge) {
+	sf::Vector2f origin{0.f, 0.f};
+	std::vector<utils::Edge> edges;
+	edges.push_back(lighting_test::makeEdge({-10.f, -5.f}, {10.f, -5.f}));
+	std::vector<sf::Vector2f> fan;
+	utils::computeVisibility(origin, 100.f, edges, fan);
+
+	bool found_corner{false};
+	for (auto i = 1u; i < fan.size(); ++i) {
+		auto const & pos = fan[i];
+		if (pos.y < -5.01f) {
+			// outside the edge's shadow
+			BOOST_CHECK_GE(std::abs(pos.x), 2.f * std::abs(pos.y) - 0.1f);
+		}
+		if (std::abs(pos.x - 10.f) < 0.01f && std::abs(pos.y + 5.f) < 0.01f) {
+			found_corner = true;
+		}
+	}
+	BOOST_CHECK(found_corner);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_visibility_is_reused_while_nothing_moves) {
+	std::vector<utils::Edge> edges;
+	lighting_test::addBox(edges, {10.f, 10.f, 32.f, 32.f});
+	utils::VisibilityCache cache;
+	auto num_vertices = cache.query({0.f, 0.f}, 50.f, edges).size();
+	BOOST_CHECK_GT(num_vertices, 14u);
+	BOOST_CHECK_EQUAL(cache.query({0.f, 0.f}, 50.f, edges).size(), num_vertices);
+	BOOST_CHECK_EQUAL(cache.getNumHits(), 1u);
+	BOOST_CHECK_EQUAL(cache.getNumMisses(), 1u);
+
+	// far edges do not matter
+	lighting_test::addBox(edges, {200.f, 10.f, 32.f, 32.f});
+	cache.query({0.f, 0.f}, 50.f, edges);
+	BOOST_CHECK_EQUAL(cache.getNumHits(), 2u);
+	BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+	// moving light or nearby edge causes recomputation
+	cache.query({1.f, 0.f}, 50.f, edges);
+	edges[0].u.x += 1.f;
+	cache.query({0.f, 0.f}, 50.f, edges);
+	BOOST_CHECK_EQUAL(cache.getNumHits(), 2u);
+	BOOST_CHECK_EQUAL(cache.getNumMisses(), 3u);
+	BOOST_CHECK_EQUAL(cache.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_visibility_of_subset_matches_clipped_edges) {
+	std::vector<utils::Edge> edges;
+	lighting_test::addBox(edges, {200.f, 10.f, 32.f, 32.f});
+	lighting_test::addBox(edges, {10.f, 10.f, 32.f, 32.f});
+	std::vector<std::size_t> indices;
+	utils::selectEdges({0.f, 0.f}, 50.f, edges, indices);
+	BOOST_CHECK_EQUAL(indices.size(), 4u);
+	utils::EdgeRange subset;
+	subset.last = indices.size();
+	utils::VisibilityCache cache;
+	auto num_vertices = cache.query({0.f, 0.f}, 50.f, edges, indices, subset).size();
+
+	// same clipped edges as querying all of them
+	BOOST_CHECK_EQUAL(cache.query({0.f, 0.f}, 50.f, edges).size(), num_vertices);
+	BOOST_CHECK_EQUAL(cache.getNumHits(), 1u);
+	BOOST_CHECK_EQUAL(cache.getNumMisses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_visibility_cache_drops_unused_polygons) {
+	std::vector<utils::Edge> edges;
+	lighting_test::addBox(edges, {10.f, 10.f, 32.f, 32.f});
+	utils::VisibilityCache cache;
+	cache.query({0.f, 0.f}, 50.f, edges);
+	cache.query({100.f, 0.f}, 50.f, edges);
+	cache.cleanup();
+	BOOST_CHECK_EQUAL(cache.size(), 2u);
+	BOOST_CHECK_EQUAL(cache.getNumMisses(), 0u);
+
+	cache.query({100.f, 0.f}, 50.f, edges);
+	cache.cleanup();
+	BOOST_CHECK_EQUAL(cache.size(), 1u);
+	cache.query({100.f, 0.f}, 50.f, edges);
+	BOOST_CHECK_EQUAL(cache.getNumHits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(LightingSystem_shadow_map_is_needed_for_non_casting_lights) {
+	std::vector<utils::Light> lights;
+	BOOST_CHECK(!utils::lighting_impl::needsShadowMap(lights, 1u));
+	// e.g. torches and gems
+	lights.emplace_back();
+	lights.back().cast_shadow = false;
+	lights.back().lod = 2u;
+	BOOST_CHECK(!utils::lighting_impl::needsShadowMap(lights, 1u));
+	BOOST_CHECK(utils::lighting_impl::needsShadowMap(lights, 2u));
+	BOOST_CHECK(!utils::lighting_impl::needsShadowMap(lights, 0u));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -40,4 +40,21 @@ BOOST_AUTO_TEST_CASE(globals_can_be_set) {
 	BOOST_CHECK(script.get<bool>("value") == true);
 }
 
+BOOST_AUTO_TEST_CASE(math_random_is_reproducible_by_seed) {
+	std::string const code{"value = 0\nroll = function()\n\tvalue = math.random(1, 1000000)\nend\n"};
+	utils::Script a, b;
+	BOOST_REQUIRE(a.loadFromMemory(code));
+	BOOST_REQUIRE(b.loadFromMemory(code));
+	a.seed(42u);
+	b.seed(42u);
+	for (auto i = 0u; i < 10u; ++i) {
+		a("roll");
+		b("roll");
+		auto value = a.get<int>("value");
+		BOOST_CHECK_EQUAL(value, b.get<int>("value"));
+		BOOST_CHECK_GE(value, 1);
+		BOOST_CHECK_LE(value, 1000000);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -397,4 +397,18 @@ BOOST_AUTO_TEST_CASE(tile_fetch_collision_picks_quad_in_given_color) {
 		vertices[5].position, tile.vertices[3].position, 0.0001f);
 }
 
+BOOST_AUTO_TEST_CASE(tile_refresh_parameters_can_be_queried) {
+	utils::OrthoTile tile;
+	utils::ShadingCase shading = utils::ShadeTopLeft | utils::ShadeBottomRight;
+	BOOST_REQUIRE_NO_ASSERT(tile.refresh({12u, 5u}, {2u, 2u}, {3u, 2u},
+		{48u, 30u}, shading, true));
+	BOOST_CHECK(tile.getOffset({48u, 30u}) == sf::Vector2u(3u, 2u));
+	BOOST_CHECK(tile.getShading() == shading);
+	
+	BOOST_REQUIRE_NO_ASSERT(tile.refresh({12u, 5u}, {2u, 2u}, {0u, 1u},
+		{48u, 30u}));
+	BOOST_CHECK(tile.getOffset({48u, 30u}) == sf::Vector2u(0u, 1u));
+	BOOST_CHECK(tile.getShading() == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
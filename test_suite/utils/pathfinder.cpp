@@ -295,3 +295,149 @@ BOOST_AUTO_TEST_CASE(Pathfinder_avoid_walls_and_objects_with_maxlength) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// ----------------------------------------------------------------------------
+
+using GridTestfinder = utils::GridPathfinder<FakeScene, FakeEntity>;
+
+/// Check whether both paths are equivalent
+/// Ties between equally short paths may be broken differently, so only
+/// endpoints, length and connectivity are compared
+void checkEquivalentPath(FakeScene const & scene, utils::Path const & predicted,
+	utils::Path const & path) {
+	BOOST_REQUIRE_EQUAL(predicted.size(), path.size());
+	BOOST_REQUIRE(!path.empty());
+	BOOST_CHECK(predicted.front() == path.front());
+	BOOST_CHECK(predicted.back() == path.back());
+	for (auto i = 1u; i < path.size(); ++i) {
+		auto neighbors = scene.getNeighbors(1, path[i], {});
+		BOOST_CHECK(utils::contains(neighbors, path[i - 1u]));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(GridPathfinder_test)
+
+BOOST_AUTO_TEST_CASE(PathDict_clear_resets_nodes) {
+	utils::PathDict dict{{10u, 10u}};
+	auto& node = dict.at({3u, 4u});
+	node.status = utils::NodeStatus::Closed;
+	node.g = 5.f;
+	dict.clear();
+	
+	auto const & other = dict.at({3u, 4u});
+	BOOST_CHECK(other.status == utils::NodeStatus::Unknown);
+	BOOST_CHECK_CLOSE(other.g, 0.f, 0.0001f);
+	BOOST_CHECK(other.pos == sf::Vector2u(3u, 4u));
+}
+
+BOOST_AUTO_TEST_CASE(PathDict_has_respects_grid_size) {
+	utils::PathDict dict{{10u, 8u}};
+	BOOST_CHECK(dict.has({9u, 7u}));
+	BOOST_CHECK(!dict.has({10u, 7u}));
+	BOOST_CHECK(!dict.has({9u, 8u}));
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_invalid_start_pos) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+
+	auto path = pathfinder(1, {12u, 2u}, {3u, 6u}, 20u);
+	std::vector<sf::Vector2u> predicted{{12u, 2u}};
+	
+	BOOST_CHECK(path == predicted);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_invalid_target_pos) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+
+	auto path = pathfinder(1, {2u, 2u}, {11u, 6u}, 20u);
+	std::vector<sf::Vector2u> predicted{{8u, 6u}, {8u, 5u}, {8u, 4u}, {7u, 3u},
+		{6u, 2u}, {5u, 1u}, {4u, 2u}, {3u, 2u}, {2u, 2u}};
+	
+	checkEquivalentPath(scene, predicted, path);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_avoid_walls) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+
+	auto path = pathfinder(1, {2u, 2u}, {7u, 7u}, 20u);
+	std::vector<sf::Vector2u> predicted{{7u, 7u}, {6u, 7u}, {5u, 8u}, {4u, 7u},
+		{4u, 6u}, {4u, 5u}, {3u, 4u}, {3u, 3u}, {2u, 2u}};
+	
+	checkEquivalentPath(scene, predicted, path);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_target_finds_alternative_to_unreachable_target) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+
+	auto path = pathfinder(1, {2u, 2u}, {1u, 8u}, 20u);
+	std::vector<sf::Vector2u> predicted{
+		{1u, 6u}, {1u, 5u}, {1u, 4u}, {1u, 3u}, {2u, 2u}};
+	
+	checkEquivalentPath(scene, predicted, path);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_avoid_walls_and_objects_with_maxlength) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+	scene.block_pos = {5u, 8u};
+
+	auto path = pathfinder(1, {2u, 6u}, {7u, 7u}, 10u);
+	std::vector<sf::Vector2u> predicted{{4u, 7u}, {3u, 7u}, {2u, 6u}};
+	
+	checkEquivalentPath(scene, predicted, path);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_can_be_reused) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+	scene.block_pos = {5u, 8u};
+
+	auto first = pathfinder(1, {2u, 2u}, {7u, 7u}, 20u);
+	pathfinder(1, {2u, 6u}, {7u, 7u}, 10u);
+	auto second = pathfinder(1, {2u, 2u}, {7u, 7u}, 20u);
+	
+	BOOST_CHECK(first == second);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_can_be_resumed) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+	scene.block_pos = {5u, 8u};
+
+	auto expected = pathfinder(1, {2u, 2u}, {7u, 7u}, 20u);
+	
+	pathfinder.start(1, {2u, 2u}, {7u, 7u}, 20u);
+	std::size_t n{0u};
+	bool done{false};
+	while (!done) {
+		std::size_t budget{2u};
+		done = pathfinder.resume(budget);
+		n += 2u - budget;
+		BOOST_REQUIRE_LE(n, 1000u);
+	}
+	BOOST_CHECK_GT(n, 2u);
+	BOOST_CHECK(pathfinder.getPath() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(GridPathfinder_suspended_search_provides_closest_path) {
+	FakeScene scene;
+	GridTestfinder pathfinder{scene};
+
+	pathfinder.start(1, {2u, 2u}, {7u, 7u}, 20u);
+	auto path = pathfinder.getPath();
+	BOOST_REQUIRE_EQUAL(path.size(), 1u);
+	BOOST_CHECK(path[0] == sf::Vector2u(2u, 2u));
+	
+	std::size_t budget{3u};
+	BOOST_CHECK(!pathfinder.resume(budget));
+	BOOST_CHECK_EQUAL(budget, 0u);
+	path = pathfinder.getPath();
+	BOOST_REQUIRE_GE(path.size(), 2u);
+	BOOST_CHECK(path.back() == sf::Vector2u(2u, 2u));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,58 @@
+#include <boost/test/unit_test.hpp>
+
+#include <utils/random.hpp>
+
+BOOST_AUTO_TEST_SUITE(random_test)
+
+BOOST_AUTO_TEST_CASE(same_seed_yields_same_numbers) {
+	utils::RandomStream a{42u}, b{42u};
+	for (auto i = 0u; i < 100u; ++i) {
+		BOOST_CHECK_EQUAL(a.next(), b.next());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(reseeding_restarts_the_stream) {
+	utils::RandomStream rng{7u};
+	auto first = rng.next();
+	rng.next();
+	rng.seed(7u);
+	BOOST_CHECK_EQUAL(rng.next(), first);
+	BOOST_CHECK_EQUAL(rng.getSeed(), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(numbers_are_within_range) {
+	utils::RandomStream rng{1u};
+	for (auto i = 0u; i < 1000u; ++i) {
+		auto n = rng(-3, 3);
+		BOOST_CHECK_GE(n, -3);
+		BOOST_CHECK_LE(n, 3);
+		auto u = rng(5u, 9u);
+		BOOST_CHECK_GE(u, 5u);
+		BOOST_CHECK_LE(u, 9u);
+		auto f = rng(0.5f, 1.5f);
+		BOOST_CHECK_GE(f, 0.5f);
+		BOOST_CHECK_LE(f, 1.5f);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(range_bounds_can_be_drawn) {
+	utils::RandomStream rng{1u};
+	bool min{false}, max{false};
+	for (auto i = 0u; i < 1000u; ++i) {
+		auto n = rng(0, 1);
+		min = min || n == 0;
+		max = max || n == 1;
+	}
+	BOOST_CHECK(min);
+	BOOST_CHECK(max);
+	BOOST_CHECK_EQUAL(rng(4u, 4u), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(derived_streams_differ) {
+	auto a = utils::RandomStream::derive(42u, 0u);
+	auto b = utils::RandomStream::derive(42u, 1u);
+	BOOST_CHECK_NE(a, b);
+	BOOST_CHECK_EQUAL(a, utils::RandomStream::derive(42u, 0u));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
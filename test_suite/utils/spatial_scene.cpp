@@ -5,10 +5,20 @@
 
 using EntityID = std::size_t;
 
-struct TestCell {};
+struct TestCell {
+	int value;
+
+	TestCell() : value{0} {}
+};
+
+struct TestColdCell {
+	std::vector<int> data;
+};
 
 using TestScene =
 	utils::SpatialScene<TestCell, EntityID, utils::GridMode::Orthogonal>;
+using SplitScene = utils::SpatialScene<TestCell, EntityID,
+	utils::GridMode::Orthogonal, TestColdCell>;
 
 // ----------------------------------------------------------------------------
 
@@ -55,4 +65,87 @@ BOOST_AUTO_TEST_CASE(scene_throws_when_query_invalid_cell) {
 	BOOST_CHECK_THROW(const_scene.getCell({7u, 12u}), std::out_of_range);
 }
 
+BOOST_AUTO_TEST_CASE(scene_try_get_cell_returns_valid_cell) {
+	sf::Texture tileset;
+	TestScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	auto const& const_scene = scene;
+	auto ptr = scene.tryGetCell({7u, 5u});
+	BOOST_REQUIRE(ptr != nullptr);
+	BOOST_CHECK_EQUAL(ptr, &scene.getCell({7u, 5u}));
+	BOOST_CHECK_EQUAL(const_scene.tryGetCell({7u, 5u}), ptr);
+}
+
+BOOST_AUTO_TEST_CASE(scene_try_get_cell_returns_null_for_invalid_cell) {
+	sf::Texture tileset;
+	TestScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	auto const& const_scene = scene;
+	BOOST_CHECK(scene.tryGetCell({7u, 12u}) == nullptr);
+	BOOST_CHECK(scene.tryGetCell({13u, 6u}) == nullptr);
+	BOOST_CHECK(scene.tryGetCell({10u, 0u}) == nullptr);
+	BOOST_CHECK(const_scene.tryGetCell({0u, 8u}) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(scene_keeps_terrain_in_its_own_plane) {
+	sf::Texture tileset;
+	TestScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	BOOST_CHECK_EQUAL(scene.getTerrain({3u, 4u}), 0u);
+	scene.getTerrain({3u, 4u}) = 2u;
+	scene.getCell({3u, 4u}).value = 5;
+	auto const& const_scene = scene;
+	BOOST_CHECK_EQUAL(const_scene.getTerrain({3u, 4u}), 2u);
+	BOOST_CHECK_EQUAL(const_scene.getTerrain({4u, 3u}), 0u);
+	BOOST_CHECK_EQUAL(scene.getCell({3u, 4u}).value, 5);
+	BOOST_CHECK_THROW(const_scene.getTerrain({7u, 12u}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(scene_try_get_terrain_falls_back_outside_bounds) {
+	sf::Texture tileset;
+	TestScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	scene.getTerrain({9u, 7u}) = 2u;
+	BOOST_CHECK_EQUAL(scene.tryGetTerrain({9u, 7u}, 5u), 2u);
+	BOOST_CHECK_EQUAL(scene.tryGetTerrain({10u, 7u}, 5u), 5u);
+	BOOST_CHECK_EQUAL(scene.tryGetTerrain({9u, 8u}, 5u), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(scene_keeps_hot_and_cold_cells_apart) {
+	sf::Texture tileset;
+	SplitScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	scene.getCell({3u, 4u}).value = 5;
+	scene.getColdCell({3u, 4u}).data.push_back(7);
+	BOOST_CHECK_EQUAL(scene.getCell({3u, 4u}).value, 5);
+	BOOST_REQUIRE_EQUAL(scene.getColdCell({3u, 4u}).data.size(), 1u);
+	BOOST_CHECK_EQUAL(scene.getColdCell({3u, 4u}).data[0], 7);
+	BOOST_CHECK(scene.getColdCell({4u, 3u}).data.empty());
+	auto const& const_scene = scene;
+	BOOST_CHECK_THROW(const_scene.getColdCell({7u, 12u}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(scene_memory_usage_counts_all_planes) {
+	sf::Texture tileset;
+	SplitScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	scene.getCell({1u, 1u}).entities.reserve(4u);
+	auto memory = scene.getMemoryUsage();
+	BOOST_CHECK_EQUAL(memory.num_cells, 80u);
+	BOOST_CHECK_EQUAL(memory.terrain_bytes, 80u * sizeof(std::uint8_t));
+	BOOST_CHECK_EQUAL(memory.hot_bytes,
+		80u * sizeof(utils::SpatialCell<TestCell, EntityID>));
+	BOOST_CHECK_EQUAL(memory.cold_bytes, 80u * sizeof(TestColdCell));
+	BOOST_CHECK_GE(memory.entity_bytes, 4u * sizeof(EntityID));
+}
+
+BOOST_AUTO_TEST_CASE(scene_cold_cells_can_be_released_and_reallocated) {
+	sf::Texture tileset;
+	SplitScene scene{1u, tileset, {10u, 8u}, {32.f, 32.f}};
+	scene.getCell({3u, 4u}).value = 5;
+	scene.getColdCell({3u, 4u}).data.push_back(7);
+	scene.releaseColdCells();
+	BOOST_CHECK(!scene.hasColdCells());
+	BOOST_CHECK_EQUAL(scene.getMemoryUsage().cold_bytes, 0u);
+	BOOST_CHECK_THROW(scene.getColdCell({3u, 4u}), std::out_of_range);
+	BOOST_CHECK_EQUAL(scene.getCell({3u, 4u}).value, 5);
+	scene.allocateColdCells();
+	BOOST_REQUIRE(scene.hasColdCells());
+	BOOST_CHECK(scene.getColdCell({3u, 4u}).data.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+#include <boost/test/unit_test.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <testsuite/sfml_system.hpp>
+
+#include <utils/sprite_batch.hpp>
+
+BOOST_AUTO_TEST_SUITE(sprite_batch_test)
+
+BOOST_AUTO_TEST_CASE(consecutive_sprites_of_same_texture_share_a_batch) {
+	sf::Texture atlas, other;
+	sf::Sprite a{atlas, {0, 0, 10, 5}}, b{atlas, {10, 0, 10, 5}}, c{other};
+	utils::SpriteBatch batch;
+	batch.add(a, sf::Transform::Identity);
+	batch.add(b, sf::Transform::Identity);
+	batch.add(c, sf::Transform::Identity);
+	BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+	BOOST_CHECK_EQUAL(batch.getNumSprites(), 3u);
+	BOOST_CHECK(batch[0].texture == &atlas);
+	BOOST_CHECK_EQUAL(batch[0].vertices.getVertexCount(), 12u);
+	BOOST_CHECK(batch[1].texture == &other);
+	BOOST_CHECK_EQUAL(batch[1].vertices.getVertexCount(), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(batches_keep_the_drawing_order) {
+	sf::Texture atlas, other;
+	sf::Sprite a{atlas}, b{other};
+	utils::SpriteBatch batch;
+	batch.add(a, sf::Transform::Identity);
+	batch.add(b, sf::Transform::Identity);
+	batch.add(a, sf::Transform::Identity);
+	// sprite cannot join the first batch without being drawn below b
+	BOOST_REQUIRE_EQUAL(batch.size(), 3u);
+	BOOST_CHECK(batch[0].texture == &atlas);
+	BOOST_CHECK(batch[1].texture == &other);
+	BOOST_CHECK(batch[2].texture == &atlas);
+	BOOST_CHECK_EQUAL(batch[2].vertices.getVertexCount(), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(sprite_quad_is_transformed) {
+	sf::Texture atlas;
+	sf::Sprite sprite{atlas, {4, 2, 10, 5}};
+	sprite.setPosition(3.f, 4.f);
+	sf::Transform matrix;
+	matrix.translate(100.f, 0.f);
+	utils::SpriteBatch batch;
+	batch.add(sprite, matrix);
+	BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+	auto const & vertices = batch[0].vertices;
+	BOOST_REQUIRE_EQUAL(vertices.getVertexCount(), 6u);
+	BOOST_CHECK(vertices.getPrimitiveType() == sf::Triangles);
+	BOOST_CHECK_VECTOR_CLOSE(
+		vertices[0].position, sf::Vector2f(103.f, 4.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(
+		vertices[2].position, sf::Vector2f(113.f, 9.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(
+		vertices[0].texCoords, sf::Vector2f(4.f, 2.f), 0.0001f);
+	BOOST_CHECK_VECTOR_CLOSE(
+		vertices[2].texCoords, sf::Vector2f(14.f, 7.f), 0.0001f);
+}
+
+BOOST_AUTO_TEST_CASE(brightness_is_applied_to_vertex_color) {
+	sf::Texture atlas;
+	sf::Sprite dark{atlas}, bright{atlas};
+	dark.setColor(sf::Color{200u, 100u, 50u, 128u});
+	utils::SpriteBatch batch;
+	batch.add(dark, sf::Transform::Identity, 0.5f);
+	batch.add(bright, sf::Transform::Identity, 1.f);
+	// both share a batch, because the saturation is not clamped
+	BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+	BOOST_CHECK_CLOSE(batch[0].brightness, 1.f, 0.0001f);
+	auto const & vertices = batch[0].vertices;
+	BOOST_CHECK(vertices[0].color == sf::Color(100u, 50u, 25u, 128u));
+	BOOST_CHECK(vertices[6].color == sf::Color::White);
+}
+
+BOOST_AUTO_TEST_CASE(clamped_saturation_is_passed_to_the_shader) {
+	sf::Texture atlas;
+	sf::Sprite sprite{atlas};
+	utils::SpriteBatch batch;
+	batch.add(sprite, sf::Transform::Identity, 0.5f, 0.2f, 1.f);
+	batch.add(sprite, sf::Transform::Identity, 0.5f, 0.2f, 1.f);
+	batch.add(sprite, sf::Transform::Identity, 0.7f, 0.2f, 1.f);
+	BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+	BOOST_CHECK_CLOSE(batch[0].brightness, 0.5f, 0.0001f);
+	BOOST_CHECK_CLOSE(batch[0].min_saturation, 0.2f, 0.0001f);
+	BOOST_CHECK_EQUAL(batch[0].vertices.getVertexCount(), 12u);
+	BOOST_CHECK_CLOSE(batch[1].brightness, 0.7f, 0.0001f);
+	BOOST_CHECK(batch[0].vertices[0].color == sf::Color::White);
+}
+
+BOOST_AUTO_TEST_CASE(sprite_without_texture_is_ignored) {
+	sf::Sprite sprite;
+	utils::SpriteBatch batch;
+	batch.add(sprite, sf::Transform::Identity);
+	BOOST_CHECK_EQUAL(batch.size(), 0u);
+	BOOST_CHECK_EQUAL(batch.getNumSprites(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(cleared_batch_can_be_refilled) {
+	sf::Texture atlas, other;
+	sf::Sprite a{atlas}, b{other};
+	utils::SpriteBatch batch;
+	batch.add(a, sf::Transform::Identity);
+	batch.add(b, sf::Transform::Identity);
+	batch.clear();
+	BOOST_CHECK_EQUAL(batch.size(), 0u);
+	BOOST_CHECK_EQUAL(batch.getNumSprites(), 0u);
+	batch.add(b, sf::Transform::Identity);
+	BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+	BOOST_CHECK(batch[0].texture == &other);
+	BOOST_CHECK_EQUAL(batch[0].vertices.getVertexCount(), 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()